@@ -0,0 +1,45 @@
+#include <TaskSystem/Benchmark.hpp>
+
+#include <fmt/format.h>
+
+#include <array>
+#include <string_view>
+
+
+namespace
+{
+
+    struct NamedBenchmark final
+    {
+        std::string_view Name;
+        void (*Run)();
+    };
+
+    constexpr auto Benchmarks = std::array{
+        NamedBenchmark{ "layout", &TaskSystem::Benchmarks::RunLayoutBenchmarks },
+        NamedBenchmark{ "latency", &TaskSystem::Benchmarks::RunLatencyBenchmarks },
+    };
+
+}  // namespace
+
+// Usage: TaskSystem.Benchmarks [name...], runs every benchmark when no names are given
+int main(int argc, char ** argv)
+{
+    for (auto const & benchmark : Benchmarks)
+    {
+        auto selected = argc == 1;
+        for (auto i = 1; i < argc && !selected; ++i)
+        {
+            selected = benchmark.Name == argv[i];
+        }
+
+        if (selected)
+        {
+            fmt::print("## {}\n\n", benchmark.Name);
+            benchmark.Run();
+            fmt::print("\n");
+        }
+    }
+
+    return 0;
+}
\ No newline at end of file
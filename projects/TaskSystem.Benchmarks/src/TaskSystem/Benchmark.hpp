@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+
+namespace TaskSystem::Benchmarks
+{
+
+    using Clock = std::chrono::steady_clock;
+
+    /// <summary>
+    /// Calls func repeatedly for at least minDuration and returns operations per second
+    /// </summary>
+    /// <remarks>
+    /// func returns the number of operations it performed so batches can amortise the clock reads
+    /// </remarks>
+    template <typename TFunc>
+    [[nodiscard]] double Throughput(std::chrono::nanoseconds minDuration, TFunc && func)
+    {
+        auto operations = std::size_t(0u);
+        auto start = Clock::now();
+        auto elapsed = Clock::duration::zero();
+
+        do
+        {
+            operations += func();
+            elapsed = Clock::now() - start;
+        } while (elapsed < minDuration);
+
+        return static_cast<double>(operations) / std::chrono::duration<double>(elapsed).count();
+    }
+
+    // Promise and frame sizes with spawn and await throughput for each promise type
+    void RunLayoutBenchmarks();
+
+    // Schedule to resume latency percentiles of the parking and polling schedulers
+    void RunLatencyBenchmarks();
+
+}  // namespace TaskSystem::Benchmarks
\ No newline at end of file
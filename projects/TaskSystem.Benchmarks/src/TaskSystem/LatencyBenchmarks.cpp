@@ -0,0 +1,119 @@
+#include <TaskSystem/Benchmark.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+#include <TaskSystem/PollingTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/ThreadPoolTaskScheduler.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+
+namespace TaskSystem::Benchmarks
+{
+    namespace
+    {
+
+        constexpr auto SampleCount = std::size_t(2000u);
+        constexpr auto WorkerCount = std::size_t(2u);
+
+        // Long enough for a parking worker to have gone to sleep between samples
+        constexpr auto IdleGap = std::chrono::microseconds(200);
+
+        Task<void> RecordResume(std::atomic<Clock::time_point::rep> & resumed)
+        {
+            resumed.store(Clock::now().time_since_epoch().count(), std::memory_order_release);
+            co_return;
+        }
+
+        // Nanoseconds from calling Schedule on this thread to the task starting on a worker
+        // Note: needs a core per worker plus one for this thread, otherwise polling workers and this thread compete
+        [[nodiscard]] std::vector<double> ScheduleToResume(ITaskScheduler & scheduler, Clock::duration gap)
+        {
+            auto samples = std::vector<double>();
+            samples.reserve(SampleCount);
+
+            auto resumed = std::atomic<Clock::time_point::rep>(0);
+
+            for (auto i = 0u; i < SampleCount; ++i)
+            {
+                resumed.store(0, std::memory_order_relaxed);
+                auto task = RecordResume(resumed);
+
+                auto scheduled = Clock::now();
+                scheduler.Schedule(task);
+
+                task.Wait();
+
+                auto latency = Clock::time_point(Clock::duration(resumed.load(std::memory_order_acquire))) - scheduled;
+                samples.emplace_back(std::chrono::duration<double, std::nano>(latency).count());
+
+                if (gap != Clock::duration::zero())
+                {
+                    std::this_thread::sleep_for(gap);
+                }
+            }
+
+            std::sort(samples.begin(), samples.end());
+            return samples;
+        }
+
+        [[nodiscard]] double Percentile(std::vector<double> const & sorted, double percentile)
+        {
+            auto index = static_cast<std::size_t>(percentile * static_cast<double>(sorted.size() - 1u));
+            return sorted[index];
+        }
+
+        void PrintHeader()
+        {
+            fmt::print("{:<36} {:>8} {:>12} {:>12} {:>12}\n", "scheduler", "gap", "p50 ns", "p99 ns", "max ns");
+        }
+
+        void PrintLatency(std::string_view name, ITaskScheduler & scheduler)
+        {
+            for (auto gap : { Clock::duration::zero(), Clock::duration(IdleGap) })
+            {
+                auto samples = ScheduleToResume(scheduler, gap);
+
+                fmt::print("{:<36} {:>8} {:>12.0f} {:>12.0f} {:>12.0f}\n", name,
+                           gap == Clock::duration::zero() ? "none" : "idle", Percentile(samples, 0.5),
+                           Percentile(samples, 0.99), samples.back());
+            }
+        }
+
+    }  // namespace
+
+    void RunLatencyBenchmarks()
+    {
+        PrintHeader();
+
+        {
+            auto scheduler = ThreadPoolTaskScheduler(WorkerCount, IdleStrategy::PowerSaving());
+            PrintLatency("ThreadPool PowerSaving", scheduler);
+        }
+
+        {
+            auto scheduler = ThreadPoolTaskScheduler(WorkerCount, IdleStrategy::Balanced());
+            PrintLatency("ThreadPool Balanced", scheduler);
+        }
+
+        {
+            auto scheduler = ThreadPoolTaskScheduler(WorkerCount, IdleStrategy::LowLatency());
+            PrintLatency("ThreadPool LowLatency", scheduler);
+        }
+
+        {
+            auto scheduler = PollingTaskScheduler(WorkerCount);
+            PrintLatency("Polling", scheduler);
+        }
+
+        fmt::print("\ngap: idle sleeps between samples so parking workers are asleep when the next task arrives\n");
+    }
+
+}  // namespace TaskSystem::Benchmarks
\ No newline at end of file
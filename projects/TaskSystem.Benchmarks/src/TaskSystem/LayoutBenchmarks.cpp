@@ -0,0 +1,181 @@
+#include <TaskSystem/Benchmark.hpp>
+#include <TaskSystem/SynchronousTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/TaskCompletionSource.hpp>
+#include <TaskSystem/WhenAll.hpp>
+#include <TaskSystem/WhenAny.hpp>
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+
+namespace TaskSystem::Benchmarks
+{
+    namespace
+    {
+
+        constexpr auto BatchSize = std::size_t(1024u);
+        constexpr auto MinDuration = std::chrono::milliseconds(200);
+
+        // Records the size of the last allocation, used to measure coroutine frames
+        class FrameSizeResource final : public std::pmr::memory_resource
+        {
+        public:
+            std::size_t LastSize = 0u;
+
+        private:
+            void * do_allocate(std::size_t bytes, std::size_t alignment) override
+            {
+                LastSize = bytes;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void * ptr, std::size_t bytes, std::size_t alignment) override
+            {
+                std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+            }
+
+            bool do_is_equal(std::pmr::memory_resource const & other) const noexcept override
+            {
+                return this == &other;
+            }
+        };
+
+        template <typename TTask>
+        TTask Noop()
+        {
+            if constexpr (std::is_void_v<typename TTask::value_type>)
+            {
+                co_return;
+            }
+            else
+            {
+                co_return typename TTask::value_type{};
+            }
+        }
+
+        template <typename TTask>
+        TTask SizedNoop(std::allocator_arg_t, std::pmr::memory_resource *)
+        {
+            if constexpr (std::is_void_v<typename TTask::value_type>)
+            {
+                co_return;
+            }
+            else
+            {
+                co_return typename TTask::value_type{};
+            }
+        }
+
+        template <typename TTask>
+        TTask Await(TTask & inner)
+        {
+            co_return co_await inner;
+        }
+
+        template <typename TTask>
+        [[nodiscard]] std::size_t FrameSize()
+        {
+            auto resource = FrameSizeResource();
+            {
+                auto task = SizedNoop<TTask>(std::allocator_arg, &resource);
+            }
+            return resource.LastSize;
+        }
+
+        // Creates, runs and destroys a batch of tasks
+        template <typename TTask>
+        [[nodiscard]] double SpawnThroughput()
+        {
+            auto scheduler = SynchronousTaskScheduler();
+            auto tasks = std::vector<TTask>();
+            tasks.reserve(BatchSize);
+
+            return Throughput(MinDuration, [&]() {
+                for (auto i = 0u; i < BatchSize; ++i)
+                {
+                    tasks.emplace_back(Noop<TTask>());
+                    scheduler.Schedule(tasks.back());
+                }
+
+                scheduler.Run();
+                tasks.clear();
+
+                return BatchSize;
+            });
+        }
+
+        // Each outer task awaits a fresh inner task, exercising the continuation path
+        template <typename TTask>
+        [[nodiscard]] double AwaitThroughput()
+        {
+            auto scheduler = SynchronousTaskScheduler();
+            auto inner = std::vector<TTask>();
+            auto outer = std::vector<TTask>();
+            inner.reserve(BatchSize);
+            outer.reserve(BatchSize);
+
+            return Throughput(MinDuration, [&]() {
+                for (auto i = 0u; i < BatchSize; ++i)
+                {
+                    inner.emplace_back(Noop<TTask>());
+                    outer.emplace_back(Await<TTask>(inner.back()));
+                    scheduler.Schedule(outer.back());
+                }
+
+                scheduler.Run();
+                outer.clear();
+                inner.clear();
+
+                return BatchSize;
+            });
+        }
+
+        void PrintHeader()
+        {
+            fmt::print("{:<40} {:>8} {:>8} {:>8} {:>14} {:>14}\n", "promise", "sizeof", "alignof", "frame", "spawn/s",
+                       "await/s");
+        }
+
+        template <typename TPromise>
+        void PrintLayout(std::string_view name)
+        {
+            fmt::print("{:<40} {:>8} {:>8} {:>8} {:>14} {:>14}\n", name, sizeof(TPromise), alignof(TPromise), "-",
+                       "-", "-");
+        }
+
+        template <typename TTask>
+        void PrintTask(std::string_view name)
+        {
+            using promise_type = typename TTask::promise_type;
+
+            fmt::print("{:<40} {:>8} {:>8} {:>8} {:>14.0f} {:>14.0f}\n", name, sizeof(promise_type),
+                       alignof(promise_type), FrameSize<TTask>(), SpawnThroughput<TTask>(), AwaitThroughput<TTask>());
+        }
+
+    }  // namespace
+
+    void RunLayoutBenchmarks()
+    {
+        PrintHeader();
+
+        PrintTask<Task<void>>("Task<void>");
+        PrintTask<CompactTask<void>>("CompactTask<void>");
+        PrintTask<Task<int>>("Task<int>");
+        PrintTask<CompactTask<int>>("CompactTask<int>");
+
+        PrintLayout<Detail::TaskCompletionSourcePromise<int>>("TaskCompletionSourcePromise<int>");
+        PrintLayout<Detail::WhenAllPromise>("WhenAllPromise");
+        PrintLayout<Detail::WhenAnyPromise>("WhenAnyPromise");
+
+        fmt::print("\nframe: bytes allocated for a no-op coroutine, including the trailer and stored allocator\n");
+    }
+
+}  // namespace TaskSystem::Benchmarks
\ No newline at end of file
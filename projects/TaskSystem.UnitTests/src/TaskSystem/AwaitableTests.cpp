@@ -0,0 +1,136 @@
+#include <TaskSystem/Awaitable.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <utility>
+
+
+namespace TaskSystem::Tests
+{
+    namespace
+    {
+        // Ready awaitable that counts how many live copies exist
+        template <size_t TPadding>
+        class CountingAwaitable
+        {
+        private:
+            int * liveCount;
+            int value;
+            std::array<std::byte, TPadding> padding{};
+
+        public:
+            CountingAwaitable(int & liveCount, int value) noexcept : liveCount(&liveCount), value(value)
+            {
+                ++*this->liveCount;
+            }
+
+            CountingAwaitable(CountingAwaitable const & other) noexcept
+              : liveCount(other.liveCount), value(other.value)
+            {
+                ++*liveCount;
+            }
+
+            CountingAwaitable(CountingAwaitable && other) noexcept : liveCount(other.liveCount), value(other.value)
+            {
+                ++*liveCount;
+            }
+
+            ~CountingAwaitable() noexcept { --*liveCount; }
+
+            bool await_ready() const noexcept { return true; }
+            void await_suspend(std::coroutine_handle<>) const noexcept { }
+            int await_resume() const noexcept { return value; }
+        };
+
+        using SmallAwaitable = CountingAwaitable<8u>;
+        using LargeAwaitable = CountingAwaitable<Detail::AwaitableInlineSize>;
+
+    }  // namespace
+
+    TEST(AwaitableTests, smallAwaitableIsStoredInline)
+    {
+        // Arrange
+        auto liveCount = 0;
+
+        // Act
+        {
+            auto awaitable = Awaitable<int>(SmallAwaitable(liveCount, 42));
+
+            // Assert
+            EXPECT_TRUE(awaitable.IsInline());
+            EXPECT_EQ(liveCount, 1);
+            EXPECT_TRUE(awaitable.await_ready());
+            EXPECT_EQ(awaitable.await_resume(), 42);
+        }
+
+        EXPECT_EQ(liveCount, 0);
+    }
+
+    TEST(AwaitableTests, largeAwaitableFallsBackToHeap)
+    {
+        // Arrange
+        auto liveCount = 0;
+
+        // Act
+        {
+            auto awaitable = Awaitable<int>(LargeAwaitable(liveCount, 42));
+
+            // Assert
+            EXPECT_FALSE(awaitable.IsInline());
+            EXPECT_EQ(liveCount, 1);
+            EXPECT_EQ(awaitable.await_resume(), 42);
+        }
+
+        EXPECT_EQ(liveCount, 0);
+    }
+
+    TEST(AwaitableTests, moveConstructInline)
+    {
+        // Arrange
+        auto liveCount = 0;
+        auto awaitable = Awaitable<int>(SmallAwaitable(liveCount, 42));
+
+        // Act
+        auto moved = Awaitable<int>(std::move(awaitable));
+
+        // Assert
+        EXPECT_TRUE(moved.IsInline());
+        EXPECT_EQ(liveCount, 1);
+        EXPECT_EQ(moved.await_resume(), 42);
+    }
+
+    TEST(AwaitableTests, moveConstructHeap)
+    {
+        // Arrange
+        auto liveCount = 0;
+        auto awaitable = Awaitable<int>(LargeAwaitable(liveCount, 42));
+
+        // Act
+        auto moved = Awaitable<int>(std::move(awaitable));
+
+        // Assert
+        EXPECT_FALSE(moved.IsInline());
+        EXPECT_EQ(liveCount, 1);
+        EXPECT_EQ(moved.await_resume(), 42);
+    }
+
+    TEST(AwaitableTests, moveAssignDestroysPreviousAwaitable)
+    {
+        // Arrange
+        auto liveCount = 0;
+        auto awaitable = Awaitable<int>(SmallAwaitable(liveCount, 1));
+        auto other = Awaitable<int>(LargeAwaitable(liveCount, 2));
+
+        // Act
+        awaitable = std::move(other);
+
+        // Assert
+        EXPECT_FALSE(awaitable.IsInline());
+        EXPECT_EQ(liveCount, 1);
+        EXPECT_EQ(awaitable.await_resume(), 2);
+    }
+
+}  // namespace TaskSystem::Tests
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include <TaskSystem/BlockingTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <semaphore>
+#include <thread>
+
+
+namespace TaskSystem::Tests
+{
+    namespace
+    {
+        using namespace std::chrono_literals;
+
+        // Polls until the pool has count threads or a second has passed
+        bool WaitForThreadCount(BlockingTaskScheduler & scheduler, size_t count)
+        {
+            auto deadline = std::chrono::steady_clock::now() + 1s;
+            while (scheduler.ThreadCount() != count && std::chrono::steady_clock::now() < deadline)
+            {
+                std::this_thread::sleep_for(1ms);
+            }
+
+            return scheduler.ThreadCount() == count;
+        }
+
+    }  // namespace
+
+    TEST(BlockingTaskSchedulerTests, runsItemsOnPoolThreads)
+    {
+        // Arrange
+        auto scheduler = BlockingTaskScheduler();
+        auto latch = std::latch(1);
+        auto isWorkerThread = false;
+
+        // Act
+        scheduler.Schedule(ScheduleItem([&]() {
+            isWorkerThread = scheduler.IsWorkerThread();
+            latch.count_down();
+        }));
+        latch.wait();
+
+        // Assert
+        EXPECT_TRUE(isWorkerThread);
+        EXPECT_FALSE(scheduler.IsWorkerThread());
+    }
+
+    TEST(BlockingTaskSchedulerTests, startsThreadPerBlockedItemUpToMax)
+    {
+        // Arrange
+        auto options = BlockingPoolOptions();
+        options.MaxThreads = 3u;
+
+        auto scheduler = BlockingTaskScheduler(options);
+        auto release = std::counting_semaphore<5>(0);
+        auto completed = std::atomic<int>(0);
+
+        // Act
+        for (auto i = 0; i < 5; ++i)
+        {
+            scheduler.Schedule(ScheduleItem([&]() {
+                release.acquire();
+                completed.fetch_add(1);
+            }));
+        }
+
+        auto threadsWhileBlocked = scheduler.ThreadCount();
+        release.release(5);
+
+        while (completed.load() != 5)
+        {
+            std::this_thread::yield();
+        }
+
+        // Assert
+        EXPECT_EQ(threadsWhileBlocked, 3u);
+    }
+
+    TEST(BlockingTaskSchedulerTests, idleThreadsAboveMinimumExit)
+    {
+        // Arrange
+        auto options = BlockingPoolOptions();
+        options.MinThreads = 1u;
+        options.IdleTimeout = 10ms;
+
+        auto scheduler = BlockingTaskScheduler(options);
+        auto latch = std::latch(4);
+
+        // Act
+        for (auto i = 0; i < 4; ++i)
+        {
+            scheduler.Schedule(ScheduleItem([&]() { latch.arrive_and_wait(); }));
+        }
+        latch.wait();
+
+        // Assert
+        EXPECT_TRUE(WaitForThreadCount(scheduler, 1u));
+    }
+
+    TEST(BlockingTaskSchedulerTests, idleThreadIsReused)
+    {
+        // Arrange
+        auto scheduler = BlockingTaskScheduler();
+        auto latch = std::latch(1);
+        scheduler.Schedule(ScheduleItem([&]() { latch.count_down(); }));
+        latch.wait();
+
+        // Act
+        auto second = std::latch(1);
+        scheduler.Schedule(ScheduleItem([&]() { second.count_down(); }));
+        second.wait();
+
+        // Assert
+        EXPECT_EQ(scheduler.ThreadCount(), 1u);
+    }
+
+    TEST(BlockingTaskSchedulerTests, stopWaitsForRunningItemsAndDiscardsQueued)
+    {
+        // Arrange
+        auto options = BlockingPoolOptions();
+        options.MaxThreads = 1u;
+
+        auto scheduler = BlockingTaskScheduler(options);
+        auto started = std::latch(1);
+        auto executed = std::atomic<int>(0);
+
+        scheduler.Schedule(ScheduleItem([&]() {
+            started.count_down();
+            std::this_thread::sleep_for(10ms);
+            executed.fetch_add(1);
+        }));
+        scheduler.Schedule(ScheduleItem([&]() { executed.fetch_add(1); }));
+        started.wait();
+
+        // Act
+        scheduler.Stop();
+
+        // Assert
+        EXPECT_EQ(executed.load(), 1);
+        EXPECT_EQ(scheduler.ThreadCount(), 0u);
+    }
+
+    TEST(BlockingTaskSchedulerTests, scheduleAfterStopIsRefused)
+    {
+        // Arrange
+        auto scheduler = BlockingTaskScheduler();
+        auto task = []() -> Task<int> {
+            co_return 42;
+        }();
+
+        scheduler.Stop();
+
+        // Act
+        scheduler.Schedule(task);
+
+        // Assert
+        EXPECT_THROW(scheduler.Schedule(ScheduleItem([&]() { })), SchedulerStopped);
+        EXPECT_EQ(task.State(), TaskState::Error);
+        EXPECT_THROW(task.Result(), SchedulerStopped);
+    }
+
+}  // namespace TaskSystem::Tests
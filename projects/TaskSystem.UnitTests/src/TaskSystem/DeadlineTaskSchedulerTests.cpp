@@ -0,0 +1,210 @@
+#include <TaskSystem/DeadlineTaskScheduler.hpp>
+#include <TaskSystem/SynchronousTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace TaskSystem::Tests
+{
+    namespace
+    {
+        using namespace std::chrono_literals;
+
+        // Holds the only worker busy so everything scheduled meanwhile is queued when it is released
+        class Blocker final
+        {
+        private:
+            std::latch started{ 1 };
+            std::latch released{ 1 };
+
+        public:
+            void Block(DeadlineTaskScheduler & scheduler)
+            {
+                scheduler.Schedule(ScheduleItem([this]() {
+                    started.count_down();
+                    released.wait();
+                }));
+                started.wait();
+            }
+
+            void Release() { released.count_down(); }
+        };
+
+    }  // namespace
+
+    TEST(DeadlineTaskSchedulerTests, runWithLambdas)
+    {
+        // Arrange
+        constexpr auto count = 1000;
+
+        auto executed = std::atomic<int>(0);
+        auto latch = std::latch(count);
+
+        auto scheduler = DeadlineTaskScheduler(2u);
+
+        // Act
+        for (auto i = 0; i < count; ++i)
+        {
+            scheduler.Schedule(ScheduleItem([&]() {
+                executed.fetch_add(1);
+                latch.count_down();
+            }));
+        }
+
+        latch.wait();
+
+        // Assert
+        EXPECT_EQ(executed.load(), count);
+        EXPECT_EQ(scheduler.ExpiredCount(), 0u);
+    }
+
+    TEST(DeadlineTaskSchedulerTests, earliestDeadlineRunsFirst)
+    {
+        // Arrange
+        auto order = std::vector<std::string>();
+        auto latch = std::latch(4);
+        auto blocker = Blocker();
+        auto now = DeadlineClock::now();
+
+        auto scheduler = DeadlineTaskScheduler(1u);
+        blocker.Block(scheduler);
+
+        auto record = [&](std::string name) {
+            return ScheduleItem([&, name]() {
+                order.emplace_back(name);
+                latch.count_down();
+            });
+        };
+
+        // Act
+        scheduler.Schedule(record("none"));
+        scheduler.Schedule(record("later"), now + 20s);
+        scheduler.Schedule(record("soonest"), now + 5s);
+        scheduler.Schedule(record("soon"), now + 10s);
+
+        blocker.Release();
+        latch.wait();
+
+        // Assert
+        EXPECT_EQ(order, (std::vector<std::string>{ "soonest", "soon", "later", "none" }));
+    }
+
+    TEST(DeadlineTaskSchedulerTests, expiredTaskIsFaultedWithDeadlineExceeded)
+    {
+        // Arrange
+        auto executed = std::atomic<bool>(false);
+        auto scheduler = DeadlineTaskScheduler(1u);
+
+        auto task = [&]() -> Task<int> {
+            executed = true;
+            co_return 42;
+        }().WithDeadline(DeadlineClock::now() - 1ms);
+
+        // Act
+        scheduler.Schedule(task);
+        task.Wait();
+
+        // Assert
+        EXPECT_EQ(task.State(), TaskState::Error);
+        EXPECT_THROW(task.Result(), DeadlineExceeded);
+        EXPECT_FALSE(executed);
+        EXPECT_EQ(scheduler.ExpiredCount(), 1u);
+    }
+
+    TEST(DeadlineTaskSchedulerTests, taskWithinDeadlineRuns)
+    {
+        // Arrange
+        auto scheduler = DeadlineTaskScheduler(1u);
+
+        auto task = []() -> Task<int> { co_return 42; }().WithDeadline(DeadlineClock::now() + 10s);
+
+        // Act
+        scheduler.Schedule(task);
+
+        // Assert
+        EXPECT_EQ(task.Result(), 42);
+        EXPECT_EQ(scheduler.ExpiredCount(), 0u);
+    }
+
+    TEST(DeadlineTaskSchedulerTests, awaiterSeesDeadlineExceeded)
+    {
+        // Arrange
+        auto scheduler = DeadlineTaskScheduler(1u);
+        auto awaiterScheduler = SynchronousTaskScheduler();
+
+        auto inner = []() -> Task<int> { co_return 42; }().WithDeadline(DeadlineClock::now() - 1ms);
+        inner.ScheduleOn(scheduler);
+
+        auto outer = [&]() -> Task<bool> {
+            try
+            {
+                co_await inner;
+            }
+            catch (DeadlineExceeded const &)
+            {
+                co_return true;
+            }
+            co_return false;
+        }();
+
+        // Act
+        awaiterScheduler.Schedule(outer);
+        awaiterScheduler.Run();
+        inner.Wait();
+        awaiterScheduler.Run();
+
+        // Assert
+        EXPECT_TRUE(outer.Result());
+    }
+
+    TEST(DeadlineTaskSchedulerTests, expiredItemIsDropped)
+    {
+        // Arrange
+        auto executed = std::atomic<bool>(false);
+        auto latch = std::latch(1);
+        auto blocker = Blocker();
+
+        auto scheduler = DeadlineTaskScheduler(1u);
+        blocker.Block(scheduler);
+
+        // Act
+        scheduler.Schedule(ScheduleItem([&]() { executed = true; }), DeadlineClock::now() + 1ms);
+        scheduler.Schedule(ScheduleItem([&]() { latch.count_down(); }));
+
+        std::this_thread::sleep_for(5ms);
+        blocker.Release();
+        latch.wait();
+
+        // Assert
+        EXPECT_FALSE(executed);
+        EXPECT_EQ(scheduler.ExpiredCount(), 1u);
+    }
+
+    TEST(DeadlineTaskSchedulerTests, stopFaultsPendingPromises)
+    {
+        // Arrange
+        auto scheduler = DeadlineTaskScheduler(1u);
+        auto taskFn = []() -> Task<int> { co_return 42; };
+        auto task = taskFn().WithDeadline(DeadlineClock::now() - 1ms);
+
+        // Act
+        scheduler.Stop();
+        scheduler.Schedule(task);
+        scheduler.Stop();
+
+        // Assert
+        EXPECT_EQ(task.State(), TaskState::Error);
+        EXPECT_THROW(task.Result(), SchedulerStopped);
+        EXPECT_EQ(scheduler.ExpiredCount(), 0u);
+    }
+
+}  // namespace TaskSystem::Tests
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include <TaskSystem/Delay.hpp>
+#include <TaskSystem/PollingTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/ThreadPoolTaskScheduler.hpp>
+#include <TaskSystem/TimerService.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+
+namespace TaskSystem::Tests
+{
+    using namespace std::chrono_literals;
+
+    TEST(DelayTests, delayResumesAfterDuration)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(2u);
+        auto service = TimerService();
+
+        auto taskFn = [](TimerService & service) -> Task<DeadlineClock::duration> {
+            auto start = DeadlineClock::now();
+            co_await Delay(20ms, service);
+            co_return DeadlineClock::now() - start;
+        };
+
+        auto task = taskFn(service);
+
+        // Act
+        scheduler.Schedule(task);
+
+        // Assert
+        EXPECT_GE(task.Result(), 20ms);
+        EXPECT_EQ(task.State(), TaskState::Completed);
+    }
+
+    TEST(DelayTests, delayUntilPastDoesNotSuspend)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(1u);
+        auto service = TimerService();
+
+        auto taskFn = [](TimerService & service) -> Task<int> {
+            co_await DelayUntil(DeadlineClock::now() - 1s, service);
+            co_return 42;
+        };
+
+        auto task = taskFn(service);
+
+        // Act
+        scheduler.Schedule(task);
+
+        // Assert
+        EXPECT_EQ(task.Result(), 42);
+    }
+
+    TEST(DelayTests, delayResumesOnCallersScheduler)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(2u);
+        auto service = TimerService();
+
+        auto taskFn = [](TimerService & service, ThreadPoolTaskScheduler & scheduler) -> Task<bool> {
+            co_await Delay(1ms, service);
+            co_return scheduler.IsWorkerThread();
+        };
+
+        auto task = taskFn(service, scheduler);
+
+        // Act
+        scheduler.Schedule(task);
+
+        // Assert
+        EXPECT_TRUE(task.Result());
+    }
+
+    TEST(DelayTests, manyConcurrentDelaysAllResume)
+    {
+        // Arrange
+        constexpr auto count = 1000;
+
+        auto scheduler = ThreadPoolTaskScheduler(4u);
+        auto service = TimerService();
+        auto resumed = std::atomic<int>(0);
+
+        auto taskFn = [](TimerService & service, std::atomic<int> & resumed, int i) -> Task<> {
+            co_await Delay(std::chrono::microseconds(i * 13 % 5000), service);
+            resumed.fetch_add(1);
+        };
+
+        auto tasks = std::vector<Task<>>();
+        tasks.reserve(count);
+
+        // Act
+        for (auto i = 0; i < count; ++i)
+        {
+            tasks.emplace_back(taskFn(service, resumed, i));
+            scheduler.Schedule(tasks.back());
+        }
+
+        for (auto & task : tasks)
+        {
+            task.Wait();
+        }
+
+        // Assert
+        EXPECT_EQ(resumed.load(), count);
+    }
+
+    TEST(DelayTests, delayDrivenByPollingScheduler)
+    {
+        // Arrange
+        auto options = TimerOptions();
+        options.DedicatedThread = false;
+
+        auto service = TimerService(options);
+        auto scheduler = PollingTaskScheduler(1u);
+        scheduler.AddPoller(service);
+
+        auto taskFn = [](TimerService & service) -> Task<int> {
+            co_await Delay(5ms, service);
+            co_return 42;
+        };
+
+        auto task = taskFn(service);
+
+        // Act
+        scheduler.Schedule(task);
+
+        // Assert
+        EXPECT_EQ(task.Result(), 42);
+
+        scheduler.Stop();
+    }
+
+}  // namespace TaskSystem::Tests
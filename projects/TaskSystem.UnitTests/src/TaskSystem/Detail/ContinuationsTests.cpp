@@ -6,6 +6,11 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <latch>
+#include <thread>
+#include <vector>
+
 
 namespace TaskSystem::Detail::Tests
 {
@@ -26,132 +31,126 @@ namespace TaskSystem::Detail::Tests
         auto continuations = Continuations();
 
         // Assert
-        EXPECT_EQ(continuations.Size(), 0u);
         EXPECT_TRUE(continuations.Empty());
-
-        EXPECT_EQ(continuations.begin(), continuations.end());
-        EXPECT_EQ(continuations.begin() + 1, continuations.end());
+        EXPECT_FALSE(continuations.IsClosed());
     }
 
     TEST(ContinuationsTests, addOne)
     {
         // Arrange
         auto continuations = Continuations();
+        auto node = ContinuationNode();
 
         // Act
-        continuations.Add(Continuation());
+        auto result = continuations.TryAdd(node);
 
         // Assert
-        EXPECT_EQ(continuations.Size(), 1u);
+        EXPECT_TRUE(result);
         EXPECT_FALSE(continuations.Empty());
-
-        EXPECT_NE(continuations.begin(), continuations.end());
-        EXPECT_EQ(++continuations.begin(), continuations.end());
-        EXPECT_EQ(continuations.begin() + 1, continuations.end());
+        EXPECT_FALSE(continuations.IsClosed());
     }
 
-    TEST(ContinuationsTests, addSix)
+    TEST(ContinuationsTests, closeReturnsElementsInOrderAdded)
     {
         // Arrange
         auto continuations = Continuations();
+        auto promise0 = Promise<int, DummyPromisePolicy>();
+        auto promise1 = Promise<int, DummyPromisePolicy>();
+        auto promise2 = Promise<int, DummyPromisePolicy>();
+        auto node0 = ContinuationNode(Continuation(promise0));
+        auto node1 = ContinuationNode(Continuation(promise1));
+        auto node2 = ContinuationNode(Continuation(promise2));
+
+        EXPECT_TRUE(continuations.TryAdd(node0));
+        EXPECT_TRUE(continuations.TryAdd(node1));
+        EXPECT_TRUE(continuations.TryAdd(node2));
 
         // Act
-        continuations.Add(Continuation{});
-        continuations.Add(Continuation{});
-        continuations.Add(Continuation{});
-        continuations.Add(Continuation{});
-        continuations.Add(Continuation{});
-        continuations.Add(Continuation{});
+        auto pending = continuations.Close();
 
         // Assert
-        EXPECT_EQ(continuations.Size(), 6u);
-        EXPECT_FALSE(continuations.Empty());
+        EXPECT_TRUE(continuations.IsClosed());
+        EXPECT_TRUE(continuations.Empty());
 
-        EXPECT_NE(continuations.begin() + 0, continuations.end());
-        EXPECT_NE(continuations.begin() + 1, continuations.end());
-        EXPECT_NE(continuations.begin() + 2, continuations.end());
-        EXPECT_NE(continuations.begin() + 3, continuations.end());
-        EXPECT_NE(continuations.begin() + 4, continuations.end());
-        EXPECT_NE(continuations.begin() + 5, continuations.end());
-        EXPECT_EQ(continuations.begin() + 6, continuations.end());
+        EXPECT_EQ(&pending.Pop().Promise(), &promise0);
+        EXPECT_EQ(&pending.Pop().Promise(), &promise1);
+        EXPECT_EQ(&pending.Pop().Promise(), &promise2);
+        EXPECT_TRUE(pending.Empty());
     }
 
-    TEST(ContinuationsTests, accessElement)
+    TEST(ContinuationsTests, addAfterCloseFails)
     {
         // Arrange
         auto continuations = Continuations();
         auto promise = Promise<int, DummyPromisePolicy>();
+        auto node = ContinuationNode(Continuation(promise));
 
-        // Act
-        continuations.Add(Continuation(promise));
-
-        // Assert
-        EXPECT_EQ(&continuations.begin()->Promise(), &promise);
-    }
-
-    TEST(ContinuationsTests, accessInvalidElement)
-    {
-        // Arrange
-        auto continuations = Continuations();
+        [[maybe_unused]] auto _ = continuations.Close();
 
         // Act
-        continuations.Add(Continuation());
+        auto result = continuations.TryAdd(node);
 
         // Assert
-        EXPECT_THROW((++continuations.begin())->Promise(), std::exception);
+        EXPECT_FALSE(result);
+        EXPECT_TRUE(continuations.Close().Empty());
     }
 
-    TEST(ContinuationsTests, accessElementInVec)
+    TEST(ContinuationsTests, popFromEmptyReturnsNullContinuation)
     {
         // Arrange
-        auto continuations = Continuations();
-        auto promise0 = Promise<int, DummyPromisePolicy>();
-        auto promise1 = Promise<int, DummyPromisePolicy>();
-        auto promise2 = Promise<int, DummyPromisePolicy>();
-        auto promise3 = Promise<int, DummyPromisePolicy>();
-        auto promise4 = Promise<int, DummyPromisePolicy>();
-        auto promise5 = Promise<int, DummyPromisePolicy>();
+        auto pending = PendingContinuations();
 
         // Act
-        continuations.Add(Continuation(promise0));
-        continuations.Add(Continuation(promise1));
-        continuations.Add(Continuation(promise2));
-        continuations.Add(Continuation(promise3));
-        continuations.Add(Continuation(promise4));
-        continuations.Add(Continuation(promise5));
+        auto continuation = pending.Pop();
 
         // Assert
-        auto it = continuations.begin();
-
-        EXPECT_EQ(&(it++)->Promise(), &promise0);
-        EXPECT_EQ(&(it++)->Promise(), &promise1);
-        EXPECT_EQ(&(it++)->Promise(), &promise2);
-        EXPECT_EQ(&(it++)->Promise(), &promise3);
-        EXPECT_EQ(&(it++)->Promise(), &promise4);
-        EXPECT_EQ(&(it++)->Promise(), &promise5);
+        EXPECT_FALSE(continuation);
     }
 
-    TEST(ContinuationsTests, forLoopCountsElements)
+    TEST(ContinuationsTests, concurrentAddsRacingCloseAreEitherClosedOrRejected)
     {
         // Arrange
+        constexpr auto threadCount = 8u;
+        constexpr auto nodesPerThread = 256u;
+
         auto continuations = Continuations();
+        auto nodes = std::vector<ContinuationNode>(threadCount * nodesPerThread);
+        auto addedCount = std::atomic<size_t>(0u);
+        auto start = std::latch(threadCount + 1u);
+        auto threads = std::vector<std::thread>();
 
-        continuations.Add(Continuation{});
-        continuations.Add(Continuation{});
-        continuations.Add(Continuation{});
-        continuations.Add(Continuation{});
-        continuations.Add(Continuation{});
-        continuations.Add(Continuation{});
+        for (auto i = 0u; i < threadCount; ++i)
+        {
+            threads.emplace_back([&, i]() {
+                start.arrive_and_wait();
+                for (auto j = 0u; j < nodesPerThread; ++j)
+                {
+                    if (continuations.TryAdd(nodes[i * nodesPerThread + j]))
+                    {
+                        addedCount.fetch_add(1u);
+                    }
+                }
+            });
+        }
 
         // Act
-        auto count = 0u;
-        for ([[maybe_unused]] auto const & _ : continuations)
+        start.arrive_and_wait();
+        auto pending = continuations.Close();
+
+        for (auto & thread : threads)
         {
-            ++count;
+            thread.join();
         }
 
         // Assert
-        EXPECT_EQ(count, continuations.Size());
+        auto closedCount = 0u;
+        while (!pending.Empty())
+        {
+            [[maybe_unused]] auto _ = pending.Pop();
+            ++closedCount;
+        }
+
+        EXPECT_EQ(closedCount, addedCount.load());
     }
 
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include <TaskSystem/Detail/CpuQuota.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+
+namespace TaskSystem::Detail::Tests
+{
+
+    TEST(CpuQuotaTests, parsesCgroupV2Quota)
+    {
+        // Act
+        auto quota = ParseCgroupCpuMax("150000 100000\n");
+
+        // Assert
+        ASSERT_TRUE(quota.has_value());
+        EXPECT_DOUBLE_EQ(*quota, 1.5);
+    }
+
+    TEST(CpuQuotaTests, cgroupV2MaxIsUnlimited)
+    {
+        // Act
+        auto quota = ParseCgroupCpuMax("max 100000\n");
+
+        // Assert
+        EXPECT_FALSE(quota.has_value());
+    }
+
+    TEST(CpuQuotaTests, malformedCgroupV2QuotaIsIgnored)
+    {
+        // Act
+        auto empty = ParseCgroupCpuMax("");
+        auto missingPeriod = ParseCgroupCpuMax("150000");
+        auto zeroPeriod = ParseCgroupCpuMax("150000 0");
+
+        // Assert
+        EXPECT_FALSE(empty.has_value());
+        EXPECT_FALSE(missingPeriod.has_value());
+        EXPECT_FALSE(zeroPeriod.has_value());
+    }
+
+    TEST(CpuQuotaTests, parsesCgroupV1Quota)
+    {
+        // Act
+        auto quota = ParseCgroupCfsQuota("200000\n", "100000\n");
+        auto unlimited = ParseCgroupCfsQuota("-1\n", "100000\n");
+
+        // Assert
+        ASSERT_TRUE(quota.has_value());
+        EXPECT_DOUBLE_EQ(*quota, 2.0);
+        EXPECT_FALSE(unlimited.has_value());
+    }
+
+    TEST(CpuQuotaTests, availableParallelismIsWithinHardwareThreads)
+    {
+        // Act
+        auto count = AvailableParallelism();
+
+        // Assert
+        EXPECT_GE(count, 1u);
+        EXPECT_LE(count, std::max(std::thread::hardware_concurrency(), 1u));
+    }
+
+}  // namespace TaskSystem::Detail::Tests
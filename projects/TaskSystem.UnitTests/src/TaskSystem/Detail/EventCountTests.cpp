@@ -0,0 +1,168 @@
+#include <TaskSystem/Detail/EventCount.hpp>
+#include <TaskSystem/Detail/SpinWait.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+namespace TaskSystem::Detail::Tests
+{
+
+    TEST(EventCountTests, notifyWithoutWaitersDoesNotAdvance)
+    {
+        // Arrange
+        auto eventCount = EventCount();
+
+        // Act
+        eventCount.NotifyOne();
+        eventCount.NotifyAll();
+        auto key = eventCount.PrepareWait();
+        eventCount.CancelWait();
+
+        // Assert
+        EXPECT_EQ(key, 0u);
+        EXPECT_EQ(eventCount.Waiters(), 0u);
+    }
+
+    TEST(EventCountTests, notifyAfterPrepareEndsWait)
+    {
+        // Arrange
+        auto eventCount = EventCount();
+        auto key = eventCount.PrepareWait();
+
+        // Act
+        eventCount.NotifyOne();
+        eventCount.Wait(key);
+
+        // Assert
+        EXPECT_EQ(eventCount.Waiters(), 0u);
+    }
+
+    TEST(EventCountTests, notifyWakesParkedWaiter)
+    {
+        // Arrange
+        auto eventCount = EventCount();
+        auto ready = std::atomic<bool>(false);
+        auto observed = std::atomic<bool>(false);
+
+        auto waiter = std::thread([&]() {
+            while (true)
+            {
+                auto key = eventCount.PrepareWait();
+                if (ready.load())
+                {
+                    eventCount.CancelWait();
+                    break;
+                }
+                eventCount.Wait(key);
+            }
+            observed = true;
+        });
+
+        // Act
+        while (eventCount.Waiters() == 0u)
+        {
+            std::this_thread::yield();
+        }
+
+        ready = true;
+        eventCount.NotifyOne();
+        waiter.join();
+
+        // Assert
+        EXPECT_TRUE(observed);
+    }
+
+    TEST(EventCountTests, noWakeupsAreMissed)
+    {
+        // Arrange
+        constexpr auto itemCount = 20000u;
+        constexpr auto consumerCount = 4u;
+
+        auto eventCount = EventCount();
+        auto available = std::atomic<int>(0);
+        auto consumed = std::atomic<unsigned>(0u);
+        auto consumers = std::vector<std::thread>();
+
+        auto tryTake = [&]() {
+            auto value = available.load();
+            while (value > 0)
+            {
+                if (available.compare_exchange_weak(value, value - 1))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        for (auto i = 0u; i < consumerCount; ++i)
+        {
+            consumers.emplace_back([&, i]() {
+                while (consumed.load() < itemCount)
+                {
+                    if (tryTake())
+                    {
+                        consumed.fetch_add(1u);
+                        continue;
+                    }
+
+                    auto key = eventCount.PrepareWait();
+                    if (available.load() > 0 || consumed.load() >= itemCount)
+                    {
+                        eventCount.CancelWait();
+                        continue;
+                    }
+
+                    // Note: consumers alternate between parking straight away and spinning first
+                    eventCount.Wait(key, i % 2u == 0u ? 0u : 64u, i % 2u == 0u ? 0u : 2u);
+                }
+            });
+        }
+
+        // Act
+        for (auto i = 0u; i < itemCount; ++i)
+        {
+            available.fetch_add(1);
+            eventCount.NotifyOne();
+        }
+
+        while (consumed.load() < itemCount)
+        {
+            std::this_thread::yield();
+        }
+        eventCount.NotifyAll();
+
+        for (auto & consumer : consumers)
+        {
+            consumer.join();
+        }
+
+        // Assert
+        EXPECT_EQ(consumed.load(), itemCount);
+        EXPECT_EQ(available.load(), 0);
+    }
+
+    TEST(EventCountTests, spinWaitYieldsAfterThreshold)
+    {
+        // Arrange
+        auto spin = SpinWait();
+
+        // Act
+        for (auto i = 0u; i < SpinWait::YieldThreshold; ++i)
+        {
+            EXPECT_FALSE(spin.NextSpinWillYield());
+            spin.SpinOnce();
+        }
+
+        // Assert
+        EXPECT_TRUE(spin.NextSpinWillYield());
+
+        spin.Reset();
+        EXPECT_FALSE(spin.NextSpinWillYield());
+    }
+
+}  // namespace TaskSystem::Detail::Tests
\ No newline at end of file
@@ -0,0 +1,248 @@
+#include <TaskSystem/Detail/FrameAllocator.hpp>
+#include <TaskSystem/SynchronousTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+
+namespace TaskSystem::Detail::Tests
+{
+    namespace
+    {
+        class CountingResource final : public std::pmr::memory_resource
+        {
+        public:
+            size_t Allocations = 0u;
+            size_t Deallocations = 0u;
+
+        private:
+            void * do_allocate(size_t bytes, size_t alignment) override
+            {
+                ++Allocations;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void * ptr, size_t bytes, size_t alignment) override
+            {
+                ++Deallocations;
+                std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+            }
+
+            bool do_is_equal(std::pmr::memory_resource const & other) const noexcept override { return this == &other; }
+        };
+
+        Task<int> AllocatorTask(std::allocator_arg_t, std::pmr::polymorphic_allocator<> alloc, int value)
+        {
+            co_return value;
+        }
+
+        Task<int> StdAllocatorTask(std::allocator_arg_t, std::allocator<int> alloc) { co_return 42; }
+
+    }  // namespace
+
+    TEST(FrameAllocatorTests, freedBlockIsReused)
+    {
+        // Arrange
+        auto * first = PooledFrameAllocator::Allocate(200u);
+        PooledFrameAllocator::Deallocate(first, 200u);
+        auto before = PooledFrameAllocator::ThreadStats();
+
+        // Act
+        auto * second = PooledFrameAllocator::Allocate(200u);
+
+        // Assert
+        auto after = PooledFrameAllocator::ThreadStats();
+
+        EXPECT_EQ(second, first);
+        EXPECT_EQ(after.Allocations, before.Allocations + 1u);
+        EXPECT_EQ(after.PoolHits, before.PoolHits + 1u);
+
+        PooledFrameAllocator::Deallocate(second, 200u);
+    }
+
+    TEST(FrameAllocatorTests, blocksAreAligned)
+    {
+        // Act
+        auto * small = PooledFrameAllocator::Allocate(1u);
+        auto * medium = PooledFrameAllocator::Allocate(1000u);
+        auto * large = PooledFrameAllocator::Allocate(PooledFrameAllocator::LargestSizeClass + 1u);
+
+        // Assert
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(small) % PooledFrameAllocator::Alignment, 0u);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(medium) % PooledFrameAllocator::Alignment, 0u);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(large) % PooledFrameAllocator::Alignment, 0u);
+
+        PooledFrameAllocator::Deallocate(small, 1u);
+        PooledFrameAllocator::Deallocate(medium, 1000u);
+        PooledFrameAllocator::Deallocate(large, PooledFrameAllocator::LargestSizeClass + 1u);
+    }
+
+    TEST(FrameAllocatorTests, largeAllocationBypassesPool)
+    {
+        // Arrange
+        constexpr auto size = PooledFrameAllocator::LargestSizeClass * 2u;
+        auto before = PooledFrameAllocator::ThreadStats();
+
+        // Act
+        auto * ptr = PooledFrameAllocator::Allocate(size);
+        PooledFrameAllocator::Deallocate(ptr, size);
+
+        // Assert
+        auto after = PooledFrameAllocator::ThreadStats();
+
+        EXPECT_EQ(after.LargeAllocations, before.LargeAllocations + 1u);
+        EXPECT_EQ(after.PoolHits, before.PoolHits);
+    }
+
+    TEST(FrameAllocatorTests, remoteFreeIsReclaimedByOwner)
+    {
+        // Arrange
+        constexpr auto size = 3000u;
+        auto * remote = PooledFrameAllocator::Allocate(size);
+        auto remoteFrees = std::size_t(0u);
+
+        // Act
+        auto thread = std::thread([&]() {
+            // Note: allocating gives this thread a cache so the free is counted
+            PooledFrameAllocator::Deallocate(PooledFrameAllocator::Allocate(size), size);
+
+            auto before = PooledFrameAllocator::ThreadStats().RemoteFrees;
+            PooledFrameAllocator::Deallocate(remote, size);
+            remoteFrees = PooledFrameAllocator::ThreadStats().RemoteFrees - before;
+        });
+        thread.join();
+
+        // Allocate until the local free list runs dry and the remote free list is reclaimed
+        auto allocated = std::vector<void *>();
+        auto reclaimed = false;
+        for (auto i = 0u; i < 10000u && !reclaimed; ++i)
+        {
+            allocated.emplace_back(PooledFrameAllocator::Allocate(size));
+            reclaimed = allocated.back() == remote;
+        }
+
+        // Assert
+        EXPECT_EQ(remoteFrees, 1u);
+        EXPECT_TRUE(reclaimed);
+
+        for (auto * ptr : allocated)
+        {
+            PooledFrameAllocator::Deallocate(ptr, size);
+        }
+    }
+
+    TEST(FrameAllocatorTests, taskFramesUseThePool)
+    {
+        // Arrange
+        auto before = PooledFrameAllocator::ThreadStats();
+
+        // Act
+        {
+            auto task = []() -> Task<int> { co_return 42; }();
+        }
+
+        // Assert
+        auto after = PooledFrameAllocator::ThreadStats();
+
+        EXPECT_EQ(after.Allocations, before.Allocations + 1u);
+        EXPECT_GE(PooledFrameAllocator::Stats().Allocations, after.Allocations);
+    }
+
+    TEST(FrameAllocatorTests, hitRate)
+    {
+        // Arrange
+        auto stats = FrameAllocatorStats();
+        stats.Allocations = 4u;
+        stats.PoolHits = 3u;
+
+        // Act
+        auto result = stats.HitRate();
+
+        // Assert
+        EXPECT_DOUBLE_EQ(result, 0.75);
+        EXPECT_DOUBLE_EQ(FrameAllocatorStats().HitRate(), 0.0);
+    }
+
+    TEST(FrameAllocatorTests, taskFrameAllocatedFromPassedAllocator)
+    {
+        // Arrange
+        auto resource = CountingResource();
+        auto scheduler = SynchronousTaskScheduler();
+
+        // Act
+        {
+            auto task = AllocatorTask(std::allocator_arg, &resource, 42);
+            scheduler.Schedule(task);
+            scheduler.Run();
+
+            // Assert
+            EXPECT_EQ(task.Result(), 42);
+            EXPECT_EQ(resource.Allocations, 1u);
+            EXPECT_EQ(resource.Deallocations, 0u);
+        }
+
+        EXPECT_EQ(resource.Deallocations, 1u);
+    }
+
+    TEST(FrameAllocatorTests, lambdaTaskFrameAllocatedFromMemoryResource)
+    {
+        // Arrange
+        auto resource = CountingResource();
+        auto lambda = [](std::allocator_arg_t, std::pmr::memory_resource *) -> Task<int> { co_return 42; };
+
+        // Act
+        {
+            auto task = lambda(std::allocator_arg, &resource);
+
+            // Assert
+            EXPECT_EQ(resource.Allocations, 1u);
+        }
+
+        EXPECT_EQ(resource.Deallocations, 1u);
+    }
+
+    TEST(FrameAllocatorTests, taskFramesAllocatedFromMonotonicArena)
+    {
+        // Arrange
+        auto upstream = CountingResource();
+        auto buffer = std::array<std::byte, 16u * 1024u>();
+        auto arena = std::pmr::monotonic_buffer_resource(buffer.data(), buffer.size(), &upstream);
+        auto scheduler = SynchronousTaskScheduler();
+
+        // Act
+        auto task1 = AllocatorTask(std::allocator_arg, &arena, 1);
+        auto task2 = AllocatorTask(std::allocator_arg, &arena, 2);
+
+        scheduler.Schedule(task1);
+        scheduler.Schedule(task2);
+        scheduler.Run();
+
+        // Assert
+        EXPECT_EQ(task1.Result(), 1);
+        EXPECT_EQ(task2.Result(), 2);
+        EXPECT_EQ(upstream.Allocations, 0u);
+    }
+
+    TEST(FrameAllocatorTests, taskFrameAllocatedFromStdAllocator)
+    {
+        // Arrange
+        auto before = PooledFrameAllocator::ThreadStats();
+
+        // Act
+        {
+            auto task = StdAllocatorTask(std::allocator_arg, std::allocator<int>());
+        }
+
+        // Assert
+        auto after = PooledFrameAllocator::ThreadStats();
+
+        EXPECT_EQ(after.Allocations, before.Allocations);
+    }
+
+}  // namespace TaskSystem::Detail::Tests
\ No newline at end of file
@@ -0,0 +1,185 @@
+#include <TaskSystem/Detail/HillClimbing.hpp>
+
+#include <gtest/gtest.h>
+
+
+namespace TaskSystem::Detail::Tests
+{
+    namespace
+    {
+
+        PoolSample Sample(double throughput, std::size_t workers, std::size_t blocked, bool backlog)
+        {
+            auto sample = PoolSample();
+            sample.Throughput = throughput;
+            sample.Workers = workers;
+            sample.Blocked = blocked;
+            sample.Backlog = backlog;
+            return sample;
+        }
+
+    }  // namespace
+
+    TEST(HillClimbingTests, keepsMinimumWhileNothingIsBlocked)
+    {
+        // Arrange
+        auto climbing = HillClimbing(4u, 16u, 8u);
+
+        // Act
+        auto target1 = climbing.Update(Sample(1000.0, 4u, 0u, true));
+        auto target2 = climbing.Update(Sample(500.0, 4u, 0u, true));
+
+        // Assert
+        EXPECT_EQ(target1, 4u);
+        EXPECT_EQ(target2, 4u);
+    }
+
+    TEST(HillClimbingTests, replacesBlockedWorkersWhileWorkIsWaiting)
+    {
+        // Arrange
+        auto climbing = HillClimbing(4u, 16u, 8u);
+
+        // Act
+        auto target = climbing.Update(Sample(0.0, 4u, 3u, true));
+
+        // Assert
+        EXPECT_EQ(target, 7u);
+    }
+
+    TEST(HillClimbingTests, doesNotReplaceBlockedWorkersWithoutBacklog)
+    {
+        // Arrange
+        auto climbing = HillClimbing(4u, 16u, 8u);
+
+        // Act
+        auto target = climbing.Update(Sample(0.0, 4u, 3u, false));
+
+        // Assert
+        EXPECT_EQ(target, 4u);
+    }
+
+    TEST(HillClimbingTests, replacementsAreCappedAtMaxWorkers)
+    {
+        // Arrange
+        auto climbing = HillClimbing(4u, 6u, 8u);
+
+        // Act
+        auto target = climbing.Update(Sample(0.0, 4u, 4u, true));
+
+        // Assert
+        EXPECT_EQ(target, 6u);
+    }
+
+    TEST(HillClimbingTests, runningWorkersAreCappedAtQuota)
+    {
+        // Arrange
+        auto climbing = HillClimbing(4u, 16u, 2u);
+
+        // Act
+        auto whileRunningWithinQuota = climbing.Update(Sample(0.0, 4u, 2u, true));
+        auto whileRunningBelowQuota = climbing.Update(Sample(0.0, 4u, 3u, true));
+
+        // Assert
+        EXPECT_EQ(whileRunningWithinQuota, 4u);
+        EXPECT_EQ(whileRunningBelowQuota, 5u);
+    }
+
+    TEST(HillClimbingTests, keepsReplacementsWhileWorkersAreBlocked)
+    {
+        // Arrange
+        auto climbing = HillClimbing(2u, 16u, 8u);
+        [[maybe_unused]] auto _ = climbing.Update(Sample(0.0, 2u, 1u, true));
+
+        // Act
+        auto target1 = climbing.Update(Sample(1000.0, 3u, 1u, true));
+        auto target2 = climbing.Update(Sample(1000.0, 3u, 1u, true));
+
+        // Assert
+        EXPECT_EQ(target1, 3u);
+        EXPECT_EQ(target2, 3u);
+    }
+
+    TEST(HillClimbingTests, retiresSurplusOncePastBlocking)
+    {
+        // Arrange
+        auto climbing = HillClimbing(2u, 16u, 8u);
+        [[maybe_unused]] auto _ = climbing.Update(Sample(0.0, 2u, 2u, true));
+
+        // Act
+        auto target1 = climbing.Update(Sample(1000.0, 4u, 0u, true));
+        auto target2 = climbing.Update(Sample(1000.0, 4u, 0u, true));
+        auto target3 = climbing.Update(Sample(1000.0, 3u, 0u, true));
+        auto target4 = climbing.Update(Sample(1000.0, 2u, 0u, true));
+
+        // Assert
+        EXPECT_EQ(target1, 4u);
+        EXPECT_EQ(target2, 3u);
+        EXPECT_EQ(target3, 2u);
+        EXPECT_EQ(target4, 2u);
+    }
+
+    TEST(HillClimbingTests, keepsAddedWorkerUntilThroughputStopsImproving)
+    {
+        // Arrange
+        auto climbing = HillClimbing(2u, 16u, 8u);
+        [[maybe_unused]] auto _ = climbing.Update(Sample(0.0, 2u, 1u, true));
+
+        // Act
+        auto improving = climbing.Update(Sample(1000.0, 3u, 0u, true));
+        auto flat = climbing.Update(Sample(1000.0, 3u, 0u, true));
+
+        // Assert
+        EXPECT_EQ(improving, 3u);
+        EXPECT_EQ(flat, 2u);
+    }
+
+    TEST(HillClimbingTests, stepsBackUpWhenRetiringCostsThroughputThenHolds)
+    {
+        // Arrange
+        auto climbing = HillClimbing(2u, 16u, 8u);
+        [[maybe_unused]] auto _ = climbing.Update(Sample(1000.0, 3u, 0u, true));
+
+        // Act
+        auto stepBack = climbing.Update(Sample(500.0, 2u, 0u, true));
+
+        auto held = true;
+        for (auto i = 0u; i < HillClimbing::HoldSamples; ++i)
+        {
+            held = held && climbing.Update(Sample(1000.0, 3u, 0u, true)) == 3u;
+        }
+
+        auto afterHold = climbing.Update(Sample(1000.0, 3u, 0u, true));
+
+        // Assert
+        EXPECT_EQ(stepBack, 3u);
+        EXPECT_TRUE(held);
+        EXPECT_EQ(afterHold, 2u);
+    }
+
+    TEST(HillClimbingTests, doesNotStepBackUpWhenLoadGoesAway)
+    {
+        // Arrange
+        auto climbing = HillClimbing(2u, 16u, 8u);
+        [[maybe_unused]] auto _ = climbing.Update(Sample(1000.0, 3u, 0u, true));
+
+        // Act
+        auto target = climbing.Update(Sample(0.0, 2u, 0u, false));
+
+        // Assert
+        EXPECT_EQ(target, 2u);
+    }
+
+    TEST(HillClimbingTests, retiresWorkersAboveQuotaWhenBlockedWorkersReturn)
+    {
+        // Arrange
+        auto climbing = HillClimbing(2u, 16u, 2u);
+        [[maybe_unused]] auto _ = climbing.Update(Sample(0.0, 2u, 2u, true));
+
+        // Act
+        auto target = climbing.Update(Sample(1000.0, 4u, 0u, true));
+
+        // Assert
+        EXPECT_EQ(target, 3u);
+    }
+
+}  // namespace TaskSystem::Detail::Tests
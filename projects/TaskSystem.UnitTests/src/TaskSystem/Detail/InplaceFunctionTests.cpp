@@ -0,0 +1,151 @@
+#include <TaskSystem/Detail/InplaceFunction.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+
+namespace TaskSystem::Detail::Tests
+{
+    namespace
+    {
+        using Function = InplaceFunction<int(int)>;
+
+        int AddOne(int value) { return value + 1; }
+
+        // Counts live instances so tests can check nothing is leaked or destroyed twice
+        template <size_t TPadding>
+        struct CountingCallable
+        {
+            int * liveCount;
+            std::array<std::byte, TPadding> padding{};
+
+            explicit CountingCallable(int & liveCount) noexcept : liveCount(&liveCount) { ++*this->liveCount; }
+
+            CountingCallable(CountingCallable const & other) noexcept : liveCount(other.liveCount) { ++*liveCount; }
+
+            CountingCallable(CountingCallable && other) noexcept : liveCount(other.liveCount) { ++*liveCount; }
+
+            ~CountingCallable() noexcept { --*liveCount; }
+
+            int operator()(int value) const noexcept { return value * 2; }
+        };
+
+        using SmallCallable = CountingCallable<8u>;
+        using LargeCallable = CountingCallable<Function::Capacity>;
+
+    }  // namespace
+
+    TEST(InplaceFunctionTests, defaultIsEmpty)
+    {
+        // Act
+        auto function = Function();
+        auto fromNullptr = Function(nullptr);
+        auto fromNullFunctionPointer = Function(static_cast<int (*)(int)>(nullptr));
+
+        // Assert
+        EXPECT_FALSE(function);
+        EXPECT_FALSE(fromNullptr);
+        EXPECT_FALSE(fromNullFunctionPointer);
+    }
+
+    TEST(InplaceFunctionTests, invokeFunctionPointer)
+    {
+        // Arrange
+        auto function = Function(&AddOne);
+
+        // Act
+        auto result = function(41);
+
+        // Assert
+        EXPECT_TRUE(function);
+        EXPECT_EQ(result, 42);
+    }
+
+    TEST(InplaceFunctionTests, invokeMoveOnlyLambda)
+    {
+        // Arrange
+        auto value = std::make_unique<int>(40);
+        auto function = Function([value = std::move(value)](int add) { return *value + add; });
+
+        // Act
+        auto result = function(2);
+
+        // Assert
+        EXPECT_EQ(result, 42);
+    }
+
+    TEST(InplaceFunctionTests, smallCallableStoredInline)
+    {
+        // Arrange
+        auto liveCount = 0;
+
+        // Act
+        {
+            auto function = Function(SmallCallable(liveCount));
+
+            // Assert
+            EXPECT_TRUE(Function::FitsInline<SmallCallable>);
+            EXPECT_EQ(liveCount, 1);
+            EXPECT_EQ(function(21), 42);
+        }
+
+        EXPECT_EQ(liveCount, 0);
+    }
+
+    TEST(InplaceFunctionTests, largeCallableFallsBackToHeap)
+    {
+        // Arrange
+        auto liveCount = 0;
+
+        // Act
+        {
+            auto function = Function(LargeCallable(liveCount));
+            auto moved = std::move(function);
+
+            // Assert
+            EXPECT_FALSE(Function::FitsInline<LargeCallable>);
+            EXPECT_FALSE(function);
+            EXPECT_EQ(liveCount, 1);
+            EXPECT_EQ(moved(21), 42);
+        }
+
+        EXPECT_EQ(liveCount, 0);
+    }
+
+    TEST(InplaceFunctionTests, moveConstructLeavesSourceEmpty)
+    {
+        // Arrange
+        auto liveCount = 0;
+        auto function = Function(SmallCallable(liveCount));
+
+        // Act
+        auto moved = Function(std::move(function));
+
+        // Assert
+        EXPECT_FALSE(function);
+        EXPECT_TRUE(moved);
+        EXPECT_EQ(liveCount, 1);
+        EXPECT_EQ(moved(21), 42);
+    }
+
+    TEST(InplaceFunctionTests, moveAssignDestroysPreviousCallable)
+    {
+        // Arrange
+        auto liveCount = 0;
+        auto function = Function(SmallCallable(liveCount));
+        auto other = Function(LargeCallable(liveCount));
+
+        // Act
+        function = std::move(other);
+
+        // Assert
+        EXPECT_FALSE(other);
+        EXPECT_EQ(liveCount, 1);
+        EXPECT_EQ(function(21), 42);
+    }
+
+}  // namespace TaskSystem::Detail::Tests
\ No newline at end of file
@@ -0,0 +1,218 @@
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <latch>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace TaskSystem::Detail::Tests
+{
+    namespace
+    {
+        struct Item final : QueueHook
+        {
+            size_t Value = 0u;
+            std::atomic<size_t> PopCount = 0u;
+        };
+
+    }  // namespace
+
+    TEST(IntrusiveQueueTests, mpscPopEmptyReturnsNull)
+    {
+        // Arrange
+        auto queue = IntrusiveMpscQueue<Item>();
+
+        // Act
+        auto * result = queue.Pop();
+
+        // Assert
+        EXPECT_EQ(result, nullptr);
+        EXPECT_TRUE(queue.Empty());
+    }
+
+    TEST(IntrusiveQueueTests, mpscPopsInPushOrder)
+    {
+        // Arrange
+        auto queue = IntrusiveMpscQueue<Item>();
+        auto items = std::vector<Item>(3u);
+
+        // Act
+        queue.Push(items[0]);
+        queue.Push(items[1]);
+        queue.Push(items[2]);
+
+        // Assert
+        EXPECT_FALSE(queue.Empty());
+        EXPECT_EQ(queue.Pop(), &items[0]);
+        EXPECT_EQ(queue.Pop(), &items[1]);
+        EXPECT_EQ(queue.Pop(), &items[2]);
+        EXPECT_EQ(queue.Pop(), nullptr);
+        EXPECT_TRUE(queue.Empty());
+    }
+
+    TEST(IntrusiveQueueTests, mpscItemCanBePushedAgainAfterPop)
+    {
+        // Arrange
+        auto queue = IntrusiveMpscQueue<Item>();
+        auto item = Item();
+
+        // Act & Assert
+        for (auto i = 0u; i < 3u; ++i)
+        {
+            queue.Push(item);
+            EXPECT_EQ(queue.Pop(), &item);
+            EXPECT_EQ(queue.Pop(), nullptr);
+        }
+    }
+
+    TEST(IntrusiveQueueTests, mpscMultipleProducersPreservePerProducerOrder)
+    {
+        // Arrange
+        constexpr auto producerCount = 4u;
+        constexpr auto itemsPerProducer = 1000u;
+
+        auto queue = IntrusiveMpscQueue<Item>();
+        auto items = std::vector<Item>(producerCount * itemsPerProducer);
+        auto start = std::latch(producerCount);
+        auto producers = std::vector<std::thread>();
+
+        for (auto i = 0u; i < items.size(); ++i)
+        {
+            items[i].Value = i;
+        }
+
+        // Act
+        for (auto p = 0u; p < producerCount; ++p)
+        {
+            producers.emplace_back([&, p]() {
+                start.arrive_and_wait();
+                for (auto i = 0u; i < itemsPerProducer; ++i)
+                {
+                    queue.Push(items[p * itemsPerProducer + i]);
+                }
+            });
+        }
+
+        auto lastValue = std::vector<long long>(producerCount, -1);
+        auto popped = 0u;
+        while (popped != items.size())
+        {
+            if (auto * item = queue.Pop())
+            {
+                auto producer = item->Value / itemsPerProducer;
+                EXPECT_GT(static_cast<long long>(item->Value), lastValue[producer]);
+                lastValue[producer] = static_cast<long long>(item->Value);
+                ++popped;
+            }
+        }
+
+        for (auto & producer : producers)
+        {
+            producer.join();
+        }
+
+        // Assert
+        EXPECT_EQ(queue.Pop(), nullptr);
+    }
+
+    TEST(IntrusiveQueueTests, listPopsInPushOrder)
+    {
+        // Arrange
+        auto list = IntrusiveList<Item>();
+        auto items = std::vector<Item>(3u);
+
+        // Act
+        list.PushBack(items[0]);
+        list.PushBack(items[1]);
+        list.PushBack(items[2]);
+
+        // Assert
+        EXPECT_EQ(list.Size(), 3u);
+        EXPECT_EQ(list.PopFront(), &items[0]);
+        EXPECT_EQ(list.PopFront(), &items[1]);
+        EXPECT_EQ(list.PopFront(), &items[2]);
+        EXPECT_EQ(list.PopFront(), nullptr);
+        EXPECT_TRUE(list.Empty());
+    }
+
+    TEST(IntrusiveQueueTests, mpscPushListKeepsOrder)
+    {
+        // Arrange
+        auto queue = IntrusiveMpscQueue<Item>();
+        auto items = std::vector<Item>(5u);
+        auto list = IntrusiveList<Item>();
+
+        list.PushBack(items[1]);
+        list.PushBack(items[2]);
+        list.PushBack(items[3]);
+
+        // Act
+        queue.Push(items[0]);
+        queue.Push(std::move(list));
+        queue.Push(IntrusiveList<Item>());
+        queue.Push(items[4]);
+
+        // Assert
+        EXPECT_TRUE(list.Empty());
+        for (auto & item : items)
+        {
+            EXPECT_EQ(queue.Pop(), &item);
+        }
+        EXPECT_EQ(queue.Pop(), nullptr);
+        EXPECT_TRUE(queue.Empty());
+    }
+
+    TEST(IntrusiveQueueTests, mpmcEachItemPoppedOnce)
+    {
+        // Arrange
+        constexpr auto threadCount = 4u;
+        constexpr auto itemsPerProducer = 1000u;
+
+        auto queue = IntrusiveMpmcQueue<Item>();
+        auto items = std::vector<Item>(threadCount * itemsPerProducer);
+        auto popped = std::atomic<size_t>(0u);
+        auto start = std::latch(threadCount * 2u);
+        auto threads = std::vector<std::thread>();
+
+        // Act
+        for (auto p = 0u; p < threadCount; ++p)
+        {
+            threads.emplace_back([&, p]() {
+                start.arrive_and_wait();
+                for (auto i = 0u; i < itemsPerProducer; ++i)
+                {
+                    queue.Push(items[p * itemsPerProducer + i]);
+                }
+            });
+
+            threads.emplace_back([&]() {
+                start.arrive_and_wait();
+                while (popped.load() != items.size())
+                {
+                    if (auto * item = queue.Pop())
+                    {
+                        item->PopCount.fetch_add(1u);
+                        popped.fetch_add(1u);
+                    }
+                }
+            });
+        }
+
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+
+        // Assert
+        for (auto & item : items)
+        {
+            EXPECT_EQ(item.PopCount.load(), 1u);
+        }
+        EXPECT_TRUE(queue.Empty());
+    }
+
+}  // namespace TaskSystem::Detail::Tests
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include <TaskSystem/Detail/ItemInbox.hpp>
+#include <TaskSystem/Detail/Promise.hpp>
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+
+namespace TaskSystem::Detail::Tests
+{
+    namespace
+    {
+        struct InboxPromisePolicy
+        {
+            static inline constexpr bool CanSchedule = true;
+            static inline constexpr bool CanRun = true;
+            static inline constexpr bool CanSuspend = true;
+            static inline constexpr bool AllowSuspendFromCreated = false;
+        };
+
+        using TestPromise = Promise<void, InboxPromisePolicy>;
+
+    }  // namespace
+
+    TEST(ItemInboxTests, promisesAndItemsArePoppedInOrder)
+    {
+        // Arrange
+        auto inbox = MpscItemInbox();
+        auto promise = TestPromise();
+        auto ran = false;
+
+        inbox.Push(ScheduleItem([&]() { ran = true; }));
+        inbox.Push(ScheduleItem(promise));
+
+        // Act
+        auto first = inbox.Pop();
+        auto second = inbox.Pop();
+        first.Run();
+
+        // Assert
+        EXPECT_NE(first.Item(), nullptr);
+        EXPECT_TRUE(ran);
+        EXPECT_EQ(second.Promise(), &promise);
+        EXPECT_FALSE(inbox.Pop());
+        EXPECT_TRUE(inbox.Empty());
+    }
+
+    TEST(ItemInboxTests, batchIsPushedInOrder)
+    {
+        // Arrange
+        auto inbox = MpmcItemInbox();
+        auto order = std::vector<int>();
+
+        auto batch = ItemBatch();
+        for (auto i = 0; i < 3; ++i)
+        {
+            batch.Add(ScheduleItem([&order, i]() { order.push_back(i); }));
+        }
+
+        // Act
+        auto size = batch.Size();
+        inbox.Push(std::move(batch));
+
+        while (auto item = inbox.Pop())
+        {
+            item.Run();
+        }
+
+        // Assert
+        EXPECT_EQ(size, 3u);
+        EXPECT_EQ(order, (std::vector<int>{ 0, 1, 2 }));
+    }
+
+    TEST(ItemInboxTests, discardDropsItemsWithoutRunningThem)
+    {
+        // Arrange
+        auto inbox = MpscItemInbox();
+        auto promise = TestPromise();
+        auto ran = false;
+
+        inbox.Push(ScheduleItem(promise));
+        inbox.Push(ScheduleItem([&]() { ran = true; }));
+
+        // Act
+        inbox.Discard();
+
+        // Assert
+        EXPECT_FALSE(ran);
+        EXPECT_FALSE(inbox.Pop());
+    }
+
+    TEST(ItemInboxTests, rejectFaultsPromisesWithoutRunningItems)
+    {
+        // Arrange
+        auto inbox = MpscItemInbox();
+        auto promise = TestPromise();
+        auto ran = false;
+
+        [[maybe_unused]] auto _ = promise.TrySetScheduled();
+        inbox.Push(ScheduleItem(promise));
+        inbox.Push(ScheduleItem([&]() { ran = true; }));
+
+        // Act
+        inbox.Reject();
+
+        // Assert
+        EXPECT_EQ(promise.State(), TaskState::Error);
+        EXPECT_FALSE(ran);
+        EXPECT_FALSE(inbox.Pop());
+    }
+
+}  // namespace TaskSystem::Detail::Tests
\ No newline at end of file
@@ -0,0 +1,177 @@
+#include <TaskSystem/Detail/PromiseBatches.hpp>
+#include <TaskSystem/SynchronousTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/TaskCompletionSource.hpp>
+#include <TaskSystem/WhenAll.hpp>
+
+#include <gtest/gtest.h>
+
+#include <span>
+#include <utility>
+#include <vector>
+
+
+namespace TaskSystem::Detail::Tests
+{
+    namespace
+    {
+        // Forwards to a synchronous scheduler, counting how work arrives
+        class CountingScheduler final : public ITaskScheduler
+        {
+        public:
+            SynchronousTaskScheduler Inner;
+            size_t Schedules = 0u;
+            size_t Batches = 0u;
+            size_t BatchedPromises = 0u;
+
+            bool IsWorkerThread() const noexcept override { return Inner.IsWorkerThread(); }
+
+            void Schedule(ScheduleItem && item) override
+            {
+                ++Schedules;
+                Inner.Schedule(std::move(item));
+            }
+
+            void ScheduleBatch(std::span<ScheduleItem> items) override
+            {
+                ++Batches;
+                Inner.ScheduleBatch(items);
+            }
+
+            void ScheduleBatch(IntrusiveList<IPromise> && promises) override
+            {
+                ++Batches;
+                BatchedPromises += promises.Size();
+                Inner.ScheduleBatch(std::move(promises));
+            }
+        };
+
+        struct BatchedPromisePolicy
+        {
+            static inline constexpr bool CanSchedule = true;
+            static inline constexpr bool CanRun = true;
+            static inline constexpr bool CanSuspend = true;
+            static inline constexpr bool AllowSuspendFromCreated = false;
+        };
+
+        using TestPromise = Promise<void, BatchedPromisePolicy>;
+
+    }  // namespace
+
+    TEST(PromiseBatchesTests, groupsPromisesByScheduler)
+    {
+        // Arrange
+        // Note: the promises are declared first, they must outlive the schedulers they are queued on
+        auto promises = std::vector<TestPromise>(6u);
+        auto scheduler1 = CountingScheduler();
+        auto scheduler2 = CountingScheduler();
+
+        // Act
+        {
+            auto batches = PromiseBatches();
+            for (auto i = 0u; i < promises.size(); ++i)
+            {
+                batches.Add(i % 2u == 0u ? scheduler1 : scheduler2, promises[i]);
+            }
+        }
+
+        // Assert
+        EXPECT_EQ(scheduler1.Batches, 1u);
+        EXPECT_EQ(scheduler1.BatchedPromises, 3u);
+        EXPECT_EQ(scheduler1.Schedules, 0u);
+
+        EXPECT_EQ(scheduler2.Batches, 1u);
+        EXPECT_EQ(scheduler2.BatchedPromises, 3u);
+        EXPECT_EQ(scheduler2.Schedules, 0u);
+    }
+
+    TEST(PromiseBatchesTests, moreSchedulersThanGroupsFlushesEarly)
+    {
+        // Arrange
+        constexpr auto schedulerCount = PromiseBatches::GroupCount + 1u;
+
+        auto promises = std::vector<TestPromise>(schedulerCount * 2u);
+        auto schedulers = std::vector<CountingScheduler>(schedulerCount);
+
+        // Act
+        {
+            auto batches = PromiseBatches();
+            for (auto i = 0u; i < promises.size(); ++i)
+            {
+                batches.Add(schedulers[i % schedulerCount], promises[i]);
+            }
+        }
+
+        // Assert
+        auto batched = size_t(0u);
+        for (auto & scheduler : schedulers)
+        {
+            EXPECT_GE(scheduler.Batches, 1u);
+            batched += scheduler.BatchedPromises;
+        }
+        EXPECT_EQ(batched, promises.size());
+    }
+
+    TEST(PromiseBatchesTests, completionSchedulesAwaitersAsOneBatch)
+    {
+        // Arrange
+        constexpr auto count = 200u;
+
+        auto scheduler = CountingScheduler();
+        auto taskCompletionSource = TaskCompletionSource<int>();
+        auto sourceTask = taskCompletionSource.Task().ContinueOn(scheduler);
+
+        auto taskFn = [&]() -> Task<int> { co_return co_await sourceTask; };
+
+        auto tasks = std::vector<Task<int>>();
+        for (auto i = 0u; i < count; ++i)
+        {
+            tasks.emplace_back(taskFn());
+            scheduler.Schedule(tasks.back());
+        }
+        scheduler.Inner.Run();
+
+        // Act
+        taskCompletionSource.SetResult(42);
+
+        // Assert
+        EXPECT_EQ(scheduler.Schedules, count);
+        EXPECT_EQ(scheduler.Batches, 1u);
+        EXPECT_EQ(scheduler.BatchedPromises, count);
+
+        scheduler.Inner.Run();
+        for (auto & task : tasks)
+        {
+            EXPECT_EQ(task.Result(), 42);
+        }
+    }
+
+    TEST(PromiseBatchesTests, whenAllSchedulesChildrenAsOneBatch)
+    {
+        // Arrange
+        auto scheduler = CountingScheduler();
+
+        auto childFn = []() -> Task<int> { co_return 1; };
+        auto child1 = childFn();
+        auto child2 = childFn();
+        auto child3 = childFn();
+
+        child1.ScheduleOn(scheduler);
+        child2.ScheduleOn(scheduler);
+        child3.ScheduleOn(scheduler);
+
+        // Act
+        auto awaitable = WhenAll(child1, child2, child3);
+
+        // Assert
+        EXPECT_EQ(scheduler.Schedules, 0u);
+        EXPECT_EQ(scheduler.Batches, 1u);
+        EXPECT_EQ(scheduler.BatchedPromises, 3u);
+
+        scheduler.Inner.Run();
+        EXPECT_EQ(child1.State(), TaskState::Completed);
+        EXPECT_EQ(child2.State(), TaskState::Completed);
+        EXPECT_EQ(child3.State(), TaskState::Completed);
+    }
+
+}  // namespace TaskSystem::Detail::Tests
\ No newline at end of file
@@ -2,6 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <latch>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 
 namespace TaskSystem::Detail::Tests
 {
@@ -277,4 +283,110 @@ namespace TaskSystem::Detail::Tests
         EXPECT_EQ(promise.Result(), expected);
     }
 
+    TEST(PromiseTests, trySetScheduledConcurrentlyOnlyOneSucceeds)
+    {
+        // Arrange
+        constexpr auto threadCount = 8u;
+        auto promise = Promise<int, RunnablePromisePolicy>();
+        auto successCount = std::atomic<size_t>(0u);
+        auto start = std::latch(threadCount);
+        auto threads = std::vector<std::thread>();
+
+        // Act
+        for (auto i = 0u; i < threadCount; ++i)
+        {
+            threads.emplace_back([&]() {
+                start.arrive_and_wait();
+                if (promise.TrySetScheduled())
+                {
+                    successCount.fetch_add(1u);
+                }
+            });
+        }
+
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+
+        // Assert
+        EXPECT_EQ(successCount.load(), 1u);
+        EXPECT_EQ(promise.State(), TaskState::Scheduled);
+    }
+
+    TEST(PromiseTests, trySetResultRacingTrySetExceptionOnlyOneSucceeds)
+    {
+        for (auto iteration = 0u; iteration < 100u; ++iteration)
+        {
+            // Arrange
+            auto promise = Promise<int, RunnablePromisePolicy>();
+            auto start = std::latch(3);
+            auto resultSet = false;
+            auto exceptionSet = false;
+
+            // Act
+            auto resultThread = std::thread([&]() {
+                start.arrive_and_wait();
+                resultSet = static_cast<bool>(promise.TrySetResult(42));
+            });
+            auto exceptionThread = std::thread([&]() {
+                start.arrive_and_wait();
+                exceptionSet
+                    = static_cast<bool>(promise.TrySetException(std::make_exception_ptr(std::runtime_error("error"))));
+            });
+
+            start.arrive_and_wait();
+            promise.Wait();
+
+            resultThread.join();
+            exceptionThread.join();
+
+            // Assert
+            EXPECT_NE(resultSet, exceptionSet);
+            if (resultSet)
+            {
+                EXPECT_EQ(promise.State(), TaskState::Completed);
+                EXPECT_EQ(promise.Result(), 42);
+            }
+            else
+            {
+                EXPECT_EQ(promise.State(), TaskState::Error);
+                EXPECT_THROW(promise.Result(), std::runtime_error);
+            }
+        }
+    }
+
+    TEST(PromiseTests, tryAddContinuationAfterCompletedFails)
+    {
+        // Arrange
+        auto promise = Promise<int, RunnablePromisePolicy>();
+        auto awaiter = Promise<int, RunnablePromisePolicy>();
+        auto node = ContinuationNode(Continuation(awaiter));
+
+        EXPECT_TRUE(promise.TrySetResult(42));
+
+        // Act
+        auto result = promise.TryAddContinuation(node);
+
+        // Assert
+        EXPECT_EQ(result, AddContinuationError::PromiseCompleted);
+        EXPECT_EQ(awaiter.State(), TaskState::Created);
+    }
+
+    TEST(PromiseTests, tryAddContinuationAfterFaultedFails)
+    {
+        // Arrange
+        auto promise = Promise<int, RunnablePromisePolicy>();
+        auto awaiter = Promise<int, RunnablePromisePolicy>();
+        auto node = ContinuationNode(Continuation(awaiter));
+
+        EXPECT_TRUE(promise.TrySetException(std::make_exception_ptr(std::runtime_error("error"))));
+
+        // Act
+        auto result = promise.TryAddContinuation(node);
+
+        // Assert
+        EXPECT_EQ(result, AddContinuationError::PromiseFaulted);
+    }
+
 }  // namespace TaskSystem::Detail::Tests
\ No newline at end of file
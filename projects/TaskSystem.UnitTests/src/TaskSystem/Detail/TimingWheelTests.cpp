@@ -0,0 +1,173 @@
+#include <TaskSystem/Detail/TimingWheel.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+
+namespace TaskSystem::Detail::Tests
+{
+    namespace
+    {
+        TimerNode Node(std::uint64_t expiry)
+        {
+            auto node = TimerNode();
+            node.Expiry = expiry;
+            return node;
+        }
+
+    }  // namespace
+
+    TEST(TimingWheelTests, emptyWheelHasNoNextTick)
+    {
+        // Arrange
+        auto wheel = TimingWheel();
+
+        // Act
+        auto next = wheel.NextTick();
+        auto expired = wheel.Advance(1000u, [](TimerNode &) { });
+
+        // Assert
+        EXPECT_EQ(next, TimingWheel::NoExpiry);
+        EXPECT_EQ(expired, 0u);
+        EXPECT_EQ(wheel.Now(), 1000u);
+    }
+
+    TEST(TimingWheelTests, nodeExpiresAtItsTick)
+    {
+        // Arrange
+        auto wheel = TimingWheel();
+        auto node = Node(10u);
+        wheel.Insert(node);
+
+        // Act
+        auto early = wheel.Advance(9u, [](TimerNode &) { });
+        auto onTime = wheel.Advance(10u, [](TimerNode &) { });
+
+        // Assert
+        EXPECT_EQ(early, 0u);
+        EXPECT_EQ(onTime, 1u);
+        EXPECT_FALSE(node.Linked);
+        EXPECT_TRUE(wheel.Empty());
+    }
+
+    TEST(TimingWheelTests, nodeInThePastExpiresOnNextAdvance)
+    {
+        // Arrange
+        auto wheel = TimingWheel(100u);
+        auto node = Node(50u);
+        wheel.Insert(node);
+
+        // Act
+        auto next = wheel.NextTick();
+        auto expired = wheel.Advance(100u, [](TimerNode &) { });
+
+        // Assert
+        EXPECT_EQ(next, 100u);
+        EXPECT_EQ(expired, 1u);
+    }
+
+    TEST(TimingWheelTests, removedNodeDoesNotExpire)
+    {
+        // Arrange
+        auto wheel = TimingWheel();
+        auto node = Node(10u);
+        wheel.Insert(node);
+
+        // Act
+        wheel.Remove(node);
+        auto expired = wheel.Advance(100u, [](TimerNode &) { });
+
+        // Assert
+        EXPECT_EQ(expired, 0u);
+        EXPECT_TRUE(wheel.Empty());
+        EXPECT_EQ(wheel.NextTick(), TimingWheel::NoExpiry);
+    }
+
+    TEST(TimingWheelTests, nodesCascadeFromHigherLevelsAndExpireInOrder)
+    {
+        // Arrange
+        auto expiries = std::vector<std::uint64_t>{ 5u, 63u, 64u, 65u, 4095u, 4096u, 70000u, 300000u, 20000000u };
+        auto nodes = std::vector<TimerNode>();
+        nodes.reserve(expiries.size());
+        for (auto expiry : expiries)
+        {
+            nodes.emplace_back(Node(expiry));
+        }
+
+        auto wheel = TimingWheel();
+        for (auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+        {
+            wheel.Insert(*it);
+        }
+
+        // Act
+        auto fired = std::vector<std::uint64_t>();
+        while (!wheel.Empty())
+        {
+            wheel.Advance(wheel.NextTick(), [&](TimerNode & node) {
+                EXPECT_EQ(node.Expiry, wheel.Now());
+                fired.emplace_back(node.Expiry);
+            });
+        }
+
+        // Assert
+        EXPECT_EQ(fired, expiries);
+    }
+
+    TEST(TimingWheelTests, nextTickIsLowerBoundOfNextExpiry)
+    {
+        // Arrange
+        auto wheel = TimingWheel();
+        auto near = Node(100u);
+        auto far = Node(10000u);
+        wheel.Insert(far);
+        wheel.Insert(near);
+
+        // Act
+        auto next = wheel.NextTick();
+
+        // Assert
+        EXPECT_LE(next, 100u);
+        EXPECT_GT(next, 0u);
+    }
+
+    TEST(TimingWheelTests, nodeBeyondRangeExpiresOnTime)
+    {
+        // Arrange
+        auto expiry = TimingWheel::MaxDelta + 1000u;
+        auto wheel = TimingWheel();
+        auto node = Node(expiry);
+        wheel.Insert(node);
+
+        // Act
+        auto early = wheel.Advance(expiry - 1u, [](TimerNode &) { });
+        auto onTime = wheel.Advance(expiry, [](TimerNode &) { });
+
+        // Assert
+        EXPECT_EQ(early, 0u);
+        EXPECT_EQ(onTime, 1u);
+    }
+
+    TEST(TimingWheelTests, expiredNodeCanBeReinserted)
+    {
+        // Arrange
+        auto wheel = TimingWheel();
+        auto node = Node(10u);
+        wheel.Insert(node);
+
+        // Act
+        auto expired = wheel.Advance(10u, [&](TimerNode & expiredNode) {
+            expiredNode.Expiry = 20u;
+            wheel.Insert(expiredNode);
+        });
+        auto reExpired = wheel.Advance(20u, [](TimerNode &) { });
+
+        // Assert
+        EXPECT_EQ(expired, 1u);
+        EXPECT_EQ(reExpired, 1u);
+        EXPECT_TRUE(wheel.Empty());
+    }
+
+}  // namespace TaskSystem::Detail::Tests
@@ -0,0 +1,154 @@
+#include <TaskSystem/Detail/WorkStealingDeque.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+namespace TaskSystem::Detail::Tests
+{
+
+    TEST(WorkStealingDequeTests, defaultInitialization)
+    {
+        // Act
+        auto deque = WorkStealingDeque<int>();
+
+        // Assert
+        EXPECT_EQ(deque.Size(), 0u);
+        EXPECT_TRUE(deque.Empty());
+        EXPECT_FALSE(deque.Pop());
+        EXPECT_FALSE(deque.Steal());
+    }
+
+    TEST(WorkStealingDequeTests, popIsLastInFirstOut)
+    {
+        // Arrange
+        auto deque = WorkStealingDeque<int>();
+
+        // Act
+        deque.Push(1);
+        deque.Push(2);
+        deque.Push(3);
+
+        // Assert
+        EXPECT_EQ(deque.Size(), 3u);
+        EXPECT_EQ(deque.Pop(), 3);
+        EXPECT_EQ(deque.Pop(), 2);
+        EXPECT_EQ(deque.Pop(), 1);
+        EXPECT_FALSE(deque.Pop());
+    }
+
+    TEST(WorkStealingDequeTests, stealIsFirstInFirstOut)
+    {
+        // Arrange
+        auto deque = WorkStealingDeque<int>();
+
+        // Act
+        deque.Push(1);
+        deque.Push(2);
+        deque.Push(3);
+
+        // Assert
+        EXPECT_EQ(deque.Steal(), 1);
+        EXPECT_EQ(deque.Steal(), 2);
+        EXPECT_EQ(deque.Pop(), 3);
+        EXPECT_TRUE(deque.Empty());
+    }
+
+    TEST(WorkStealingDequeTests, pushBeyondCapacityGrows)
+    {
+        // Arrange
+        auto deque = WorkStealingDeque<int>(4);
+
+        // Act
+        for (auto i = 0; i < 100; ++i)
+        {
+            deque.Push(i);
+        }
+
+        // Assert
+        EXPECT_EQ(deque.Size(), 100u);
+        for (auto i = 0; i < 100; ++i)
+        {
+            EXPECT_EQ(deque.Steal(), i);
+        }
+    }
+
+    TEST(WorkStealingDequeTests, pushBatchBeyondCapacityGrows)
+    {
+        // Arrange
+        auto deque = WorkStealingDeque<int>(4);
+        auto next = 0;
+
+        deque.Push(-1);
+
+        // Act
+        deque.PushBatch(100u, [&]() { return next++; });
+
+        // Assert
+        EXPECT_EQ(deque.Size(), 101u);
+        EXPECT_EQ(deque.Steal(), -1);
+        for (auto i = 0; i < 100; ++i)
+        {
+            EXPECT_EQ(deque.Steal(), i);
+        }
+    }
+
+    TEST(WorkStealingDequeTests, concurrentStealTakesEachItemOnce)
+    {
+        // Arrange
+        constexpr auto itemCount = 100000;
+        constexpr auto thiefCount = 3u;
+
+        auto deque = WorkStealingDeque<int>(16);
+        auto taken = std::vector<std::atomic<int>>(itemCount);
+        auto done = std::atomic<bool>(false);
+
+        auto thieves = std::vector<std::thread>();
+        for (auto i = 0u; i < thiefCount; ++i)
+        {
+            thieves.emplace_back([&]() {
+                while (!done.load(std::memory_order_acquire) || !deque.Empty())
+                {
+                    if (auto item = deque.Steal())
+                    {
+                        taken[*item].fetch_add(1);
+                    }
+                }
+            });
+        }
+
+        // Act
+        for (auto i = 0; i < itemCount; ++i)
+        {
+            deque.Push(i);
+            if (i % 3 == 0)
+            {
+                if (auto item = deque.Pop())
+                {
+                    taken[*item].fetch_add(1);
+                }
+            }
+        }
+
+        while (auto item = deque.Pop())
+        {
+            taken[*item].fetch_add(1);
+        }
+
+        done.store(true, std::memory_order_release);
+        for (auto & thief : thieves)
+        {
+            thief.join();
+        }
+
+        // Assert
+        for (auto i = 0; i < itemCount; ++i)
+        {
+            EXPECT_EQ(taken[i].load(), 1) << "item " << i;
+        }
+    }
+
+}  // namespace TaskSystem::Detail::Tests
\ No newline at end of file
@@ -0,0 +1,213 @@
+#include <TaskSystem/EventLoopTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/TaskCompletionSource.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+using namespace std::chrono_literals;
+
+
+namespace TaskSystem::Tests
+{
+    namespace
+    {
+        std::atomic<int> unhandledCount = 0;
+
+        void CountException(std::exception_ptr) noexcept { ++unhandledCount; }
+
+    }  // namespace
+
+    TEST(EventLoopTaskSchedulerTests, runUntilIdleRunsScheduledItems)
+    {
+        // Arrange
+        auto executed = 0;
+        auto scheduler = EventLoopTaskScheduler();
+
+        for (auto i = 0; i < 3; ++i)
+        {
+            scheduler.Schedule(ScheduleItem([&]() { ++executed; }));
+        }
+
+        // Act
+        auto count = scheduler.RunUntilIdle();
+
+        // Assert
+        EXPECT_EQ(count, 3u);
+        EXPECT_EQ(executed, 3);
+        EXPECT_EQ(scheduler.RunUntilIdle(), 0u);
+    }
+
+    TEST(EventLoopTaskSchedulerTests, runUntilIdleRunsTasks)
+    {
+        // Arrange
+        auto expected = 42;
+        auto inner = [&]() -> Task<int> { co_return expected; }();
+        auto outer = [&]() -> Task<int> { co_return co_await inner; }();
+
+        auto scheduler = EventLoopTaskScheduler();
+        scheduler.Schedule(outer);
+
+        // Act
+        scheduler.RunUntilIdle();
+
+        // Assert
+        EXPECT_EQ(outer.State(), TaskState::Completed);
+        EXPECT_EQ(outer.Result(), expected);
+    }
+
+    TEST(EventLoopTaskSchedulerTests, isWorkerThread)
+    {
+        // Arrange
+        auto scheduler = EventLoopTaskScheduler();
+        auto isWorkerThread = false;
+
+        scheduler.Schedule(ScheduleItem([&]() { isWorkerThread = scheduler.IsWorkerThread(); }));
+
+        // Act
+        scheduler.RunUntilIdle();
+
+        // Assert
+        EXPECT_TRUE(isWorkerThread);
+        EXPECT_FALSE(scheduler.IsWorkerThread());
+    }
+
+    TEST(EventLoopTaskSchedulerTests, runForReturnsAfterDuration)
+    {
+        // Arrange
+        auto scheduler = EventLoopTaskScheduler();
+        auto start = std::chrono::steady_clock::now();
+
+        // Act
+        auto count = scheduler.RunFor(20ms);
+
+        // Assert
+        EXPECT_EQ(count, 0u);
+        EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+    }
+
+    TEST(EventLoopTaskSchedulerTests, itemsPostedFromOtherThreadsWakeTheLoop)
+    {
+        // Arrange
+        constexpr auto producerCount = 4;
+        constexpr auto itemsPerProducer = 1000;
+
+        auto scheduler = EventLoopTaskScheduler();
+        auto executed = 0;
+        auto producers = std::vector<std::thread>();
+
+        // Act
+        for (auto p = 0; p < producerCount; ++p)
+        {
+            producers.emplace_back([&]() {
+                for (auto i = 0; i < itemsPerProducer; ++i)
+                {
+                    // Note: only the loop thread touches executed
+                    scheduler.Schedule(ScheduleItem([&]() {
+                        if (++executed == producerCount * itemsPerProducer)
+                        {
+                            scheduler.Stop();
+                        }
+                    }));
+
+                    if (i % 100 == 0)
+                    {
+                        std::this_thread::sleep_for(100us);
+                    }
+                }
+            });
+        }
+
+        auto count = scheduler.RunForever();
+
+        for (auto & producer : producers)
+        {
+            producer.join();
+        }
+
+        // Assert
+        EXPECT_EQ(count, static_cast<size_t>(producerCount * itemsPerProducer));
+        EXPECT_EQ(executed, producerCount * itemsPerProducer);
+    }
+
+    TEST(EventLoopTaskSchedulerTests, stopFromOtherThreadEndsRunForever)
+    {
+        // Arrange
+        auto scheduler = EventLoopTaskScheduler();
+
+        // Act
+        auto stopper = std::thread([&]() {
+            std::this_thread::sleep_for(10ms);
+            scheduler.Stop();
+        });
+
+        scheduler.RunForever();
+        stopper.join();
+
+        // Assert
+        EXPECT_FALSE(scheduler.IsWorkerThread());
+    }
+
+    TEST(EventLoopTaskSchedulerTests, completionOnForeignThreadResumesOnLoop)
+    {
+        // Arrange
+        auto expected = 42;
+        auto taskCompletionSource = TaskCompletionSource<int>();
+        auto resumedOn = std::thread::id();
+
+        auto scheduler = EventLoopTaskScheduler();
+
+        auto task = [&]() -> Task<int> {
+            auto value = co_await taskCompletionSource.Task();
+            resumedOn = std::this_thread::get_id();
+            scheduler.Stop();
+            co_return value;
+        }();
+
+        scheduler.Schedule(task);
+        scheduler.RunUntilIdle();
+
+        // Act
+        auto completer = std::thread([&]() {
+            std::this_thread::sleep_for(10ms);
+            taskCompletionSource.SetResult(expected);
+        });
+
+        scheduler.RunForever();
+        completer.join();
+
+        // Assert
+        EXPECT_EQ(task.Result(), expected);
+        EXPECT_EQ(resumedOn, std::this_thread::get_id());
+    }
+
+    TEST(EventLoopTaskSchedulerTests, throwingItemGoesToUnhandledExceptionHandler)
+    {
+        // Arrange
+        unhandledCount = 0;
+        auto previous = SetUnhandledExceptionHandler(CountException);
+
+        auto executed = false;
+        auto scheduler = EventLoopTaskScheduler();
+        scheduler.Schedule(ScheduleItem([&]() { throw std::runtime_error("item failed"); }));
+        scheduler.Schedule(ScheduleItem([&]() { executed = true; }));
+
+        // Act
+        auto count = scheduler.RunUntilIdle();
+
+        SetUnhandledExceptionHandler(previous);
+
+        // Assert
+        EXPECT_EQ(count, 2u);
+        EXPECT_EQ(unhandledCount, 1);
+        EXPECT_TRUE(executed);
+    }
+
+}  // namespace TaskSystem::Tests
\ No newline at end of file
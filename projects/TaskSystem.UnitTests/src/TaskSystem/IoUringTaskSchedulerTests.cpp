@@ -0,0 +1,312 @@
+#if defined(__linux__)
+
+#include <TaskSystem/IoUringTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/ThreadPoolTaskScheduler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <thread>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+
+namespace TaskSystem::Tests
+{
+    namespace
+    {
+        using namespace std::chrono_literals;
+
+        IoUringOptions FallbackOptions()
+        {
+            auto options = IoUringOptions();
+            options.ForceFallback = true;
+            return options;
+        }
+
+        std::span<std::byte const> Bytes(std::string_view text)
+        {
+            return std::as_bytes(std::span(text.data(), text.size()));
+        }
+
+        std::string_view Text(std::span<std::byte const> bytes)
+        {
+            return std::string_view(reinterpret_cast<char const *>(bytes.data()), bytes.size());
+        }
+
+        class TempFile final
+        {
+        public:
+            int Fd;
+
+            TempFile() noexcept
+            {
+                char path[] = "/tmp/IoUringTaskSchedulerTestsXXXXXX";
+                Fd = ::mkstemp(path);
+                ::unlink(path);
+            }
+
+            TempFile(TempFile const &) = delete;
+            TempFile & operator=(TempFile const &) = delete;
+
+            ~TempFile() noexcept { ::close(Fd); }
+        };
+
+        // Listens on an ephemeral loopback port
+        class Listener final
+        {
+        public:
+            int Fd;
+            sockaddr_in Address;
+
+            Listener() noexcept : Fd(::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0)), Address()
+            {
+                Address.sin_family = AF_INET;
+                Address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+                auto length = socklen_t(sizeof(Address));
+                ::bind(Fd, reinterpret_cast<sockaddr const *>(&Address), length);
+                ::listen(Fd, 16);
+                ::getsockname(Fd, reinterpret_cast<sockaddr *>(&Address), &length);
+            }
+
+            Listener(Listener const &) = delete;
+            Listener & operator=(Listener const &) = delete;
+
+            ~Listener() noexcept { ::close(Fd); }
+        };
+
+        Task<std::size_t> WriteReadFsync(IoUringTaskScheduler & scheduler, int fd, std::span<std::byte> buffer)
+        {
+            auto written = co_await scheduler.WriteAsync(fd, Bytes("hello io_uring"), 0u);
+            co_await scheduler.FsyncAsync(fd);
+            auto read = co_await scheduler.ReadAsync(fd, buffer, 6u);
+            co_return written + read;
+        }
+
+        Task<std::string_view> EchoOverLoopback(
+            IoUringTaskScheduler & scheduler, Listener & listener, std::span<std::byte> buffer)
+        {
+            auto client = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            auto accepted = [](IoUringTaskScheduler & scheduler, int fd) -> Task<int> {
+                co_return co_await scheduler.AcceptAsync(fd);
+            }(scheduler, listener.Fd);
+            scheduler.Schedule(accepted);
+
+            co_await scheduler.ConnectAsync(
+                client, reinterpret_cast<sockaddr const *>(&listener.Address), sizeof(listener.Address));
+            auto server = co_await accepted;
+
+            co_await scheduler.WriteAsync(client, Bytes("ping"));
+            auto read = co_await scheduler.ReadAsync(server, buffer);
+
+            ::close(server);
+            ::close(client);
+            co_return Text(buffer.first(read));
+        }
+
+    }  // namespace
+
+    TEST(IoUringTaskSchedulerTests, writesFsyncsAndReadsFile)
+    {
+        // Arrange
+        auto scheduler = IoUringTaskScheduler();
+        auto file = TempFile();
+        auto buffer = std::array<std::byte, 64>();
+        auto task = WriteReadFsync(scheduler, file.Fd, buffer);
+        scheduler.Schedule(task);
+
+        // Act
+        scheduler.RunUntilIdle();
+
+        // Assert
+        EXPECT_EQ(task.Result(), 14u + 8u);
+        EXPECT_EQ(Text(std::span(buffer).first(8u)), "io_uring");
+    }
+
+    TEST(IoUringTaskSchedulerTests, fallbackWritesFsyncsAndReadsFile)
+    {
+        // Arrange
+        auto scheduler = IoUringTaskScheduler(FallbackOptions());
+        auto file = TempFile();
+        auto buffer = std::array<std::byte, 64>();
+        auto task = WriteReadFsync(scheduler, file.Fd, buffer);
+        scheduler.Schedule(task);
+
+        // Act
+        scheduler.RunUntilIdle();
+
+        // Assert
+        EXPECT_FALSE(scheduler.UsesIoUring());
+        EXPECT_EQ(task.Result(), 14u + 8u);
+        EXPECT_EQ(Text(std::span(buffer).first(8u)), "io_uring");
+    }
+
+    TEST(IoUringTaskSchedulerTests, acceptsConnectsAndTransfersOverLoopback)
+    {
+        // Arrange
+        auto scheduler = IoUringTaskScheduler();
+        auto listener = Listener();
+        auto buffer = std::array<std::byte, 64>();
+        auto task = EchoOverLoopback(scheduler, listener, buffer);
+        scheduler.Schedule(task);
+
+        // Act
+        scheduler.RunUntilIdle();
+
+        // Assert
+        EXPECT_EQ(task.Result(), "ping");
+    }
+
+    TEST(IoUringTaskSchedulerTests, fallbackAcceptsConnectsAndTransfersOverLoopback)
+    {
+        // Arrange
+        auto scheduler = IoUringTaskScheduler(FallbackOptions());
+        auto listener = Listener();
+        auto buffer = std::array<std::byte, 64>();
+        auto task = EchoOverLoopback(scheduler, listener, buffer);
+        scheduler.Schedule(task);
+
+        // Act
+        scheduler.RunUntilIdle();
+
+        // Assert
+        EXPECT_EQ(task.Result(), "ping");
+    }
+
+    TEST(IoUringTaskSchedulerTests, readWaitsUntilPipeIsWritten)
+    {
+        for (auto options : { IoUringOptions(), FallbackOptions() })
+        {
+            // Arrange
+            auto scheduler = IoUringTaskScheduler(options);
+            int fds[2];
+            ASSERT_EQ(::pipe(fds), 0);
+
+            auto buffer = std::array<std::byte, 16>();
+            auto task = [](IoUringTaskScheduler & scheduler, int fd, std::span<std::byte> buffer) -> Task<std::size_t> {
+                co_return co_await scheduler.ReadAsync(fd, buffer);
+            }(scheduler, fds[0], buffer);
+            scheduler.Schedule(task);
+
+            auto writer = std::thread([&]() {
+                std::this_thread::sleep_for(10ms);
+                [[maybe_unused]] auto _ = ::write(fds[1], "abc", 3u);
+            });
+
+            // Act
+            scheduler.RunUntilIdle();
+            writer.join();
+
+            // Assert
+            EXPECT_EQ(task.Result(), 3u);
+            EXPECT_EQ(Text(std::span(buffer).first(3u)), "abc");
+
+            ::close(fds[0]);
+            ::close(fds[1]);
+        }
+    }
+
+    TEST(IoUringTaskSchedulerTests, failedOperationThrowsSystemError)
+    {
+        for (auto options : { IoUringOptions(), FallbackOptions() })
+        {
+            // Arrange
+            auto scheduler = IoUringTaskScheduler(options);
+            auto buffer = std::array<std::byte, 16>();
+            auto task = [](IoUringTaskScheduler & scheduler, std::span<std::byte> buffer) -> Task<int> {
+                try
+                {
+                    co_await scheduler.ReadAsync(-1, buffer);
+                }
+                catch (std::system_error const & error)
+                {
+                    co_return error.code().value();
+                }
+
+                co_return 0;
+            }(scheduler, buffer);
+            scheduler.Schedule(task);
+
+            // Act
+            scheduler.RunUntilIdle();
+
+            // Assert
+            EXPECT_EQ(task.Result(), EBADF);
+        }
+    }
+
+    TEST(IoUringTaskSchedulerTests, acceptOnNonSocketThrowsSystemError)
+    {
+        for (auto options : { IoUringOptions(), FallbackOptions() })
+        {
+            // Arrange
+            auto scheduler = IoUringTaskScheduler(options);
+            int fds[2];
+            ASSERT_EQ(::pipe(fds), 0);
+
+            // Note: readable, so the fallback tries the accept as soon as it has waited on the fd
+            ASSERT_EQ(::write(fds[1], "abc", 3u), 3);
+
+            auto task = [](IoUringTaskScheduler & scheduler, int fd) -> Task<int> {
+                try
+                {
+                    co_await scheduler.AcceptAsync(fd);
+                }
+                catch (std::system_error const & error)
+                {
+                    co_return error.code().value();
+                }
+
+                co_return 0;
+            }(scheduler, fds[0]);
+            scheduler.Schedule(task);
+
+            // Act
+            scheduler.RunUntilIdle();
+
+            // Assert
+            EXPECT_EQ(task.Result(), ENOTSOCK);
+
+            ::close(fds[0]);
+            ::close(fds[1]);
+        }
+    }
+
+    TEST(IoUringTaskSchedulerTests, operationFromOtherSchedulerResumesOnIt)
+    {
+        // Arrange
+        auto pool = ThreadPoolTaskScheduler(1u);
+        auto scheduler = IoUringTaskScheduler();
+        auto file = TempFile();
+
+        auto task = [](IoUringTaskScheduler & scheduler, ThreadPoolTaskScheduler & pool, int fd) -> Task<bool> {
+            co_await scheduler.WriteAsync(fd, Bytes("data"));
+            co_return pool.IsWorkerThread();
+        }(scheduler, pool, file.Fd);
+
+        auto loop = std::thread([&]() { scheduler.RunForever(); });
+
+        // Act
+        pool.Schedule(task);
+        auto resumedOnPool = task.Result();
+
+        scheduler.Stop();
+        loop.join();
+
+        // Assert
+        EXPECT_TRUE(resumedOnPool);
+    }
+
+}  // namespace TaskSystem::Tests
+
+#endif
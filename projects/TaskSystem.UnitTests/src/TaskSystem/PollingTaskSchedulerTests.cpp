@@ -0,0 +1,219 @@
+#include <TaskSystem/IPoller.hpp>
+#include <TaskSystem/PollingTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/TaskCompletionSource.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <latch>
+#include <thread>
+#include <vector>
+
+
+namespace TaskSystem::Tests
+{
+    namespace
+    {
+        class CountingPoller final : public IPoller
+        {
+        public:
+            std::atomic<size_t> Polls = 0u;
+            std::atomic<std::thread::id> LastThread;
+
+            size_t Poll() noexcept override
+            {
+                LastThread = std::this_thread::get_id();
+                Polls.fetch_add(1u);
+                return 0u;
+            }
+        };
+
+    }  // namespace
+
+    TEST(PollingTaskSchedulerTests, runWithLambdas)
+    {
+        // Arrange
+        constexpr auto count = 1000;
+
+        auto executed = std::atomic<int>(0);
+        auto latch = std::latch(count);
+
+        auto scheduler = PollingTaskScheduler(2u);
+
+        // Act
+        for (auto i = 0; i < count; ++i)
+        {
+            scheduler.Schedule(ScheduleItem([&]() {
+                executed.fetch_add(1);
+                latch.count_down();
+            }));
+        }
+
+        latch.wait();
+
+        // Assert
+        EXPECT_EQ(executed.load(), count);
+    }
+
+    TEST(PollingTaskSchedulerTests, runNestedSchedulesFromWorkers)
+    {
+        // Arrange
+        constexpr auto outerCount = 16;
+        constexpr auto innerCount = 64;
+
+        auto executed = std::atomic<int>(0);
+        auto latch = std::latch(outerCount * innerCount);
+
+        auto scheduler = PollingTaskScheduler(2u);
+
+        // Act
+        for (auto i = 0; i < outerCount; ++i)
+        {
+            scheduler.Schedule(ScheduleItem([&]() {
+                for (auto j = 0; j < innerCount; ++j)
+                {
+                    // Note: scheduled from a worker so pushed onto its local deque
+                    scheduler.Schedule(ScheduleItem([&]() {
+                        executed.fetch_add(1);
+                        latch.count_down();
+                    }));
+                }
+            }));
+        }
+
+        latch.wait();
+
+        // Assert
+        EXPECT_EQ(executed.load(), outerCount * innerCount);
+    }
+
+    TEST(PollingTaskSchedulerTests, continuationsScheduledAsBatchAllComplete)
+    {
+        // Arrange
+        constexpr auto count = 200u;
+
+        auto scheduler = PollingTaskScheduler(2u);
+        auto taskCompletionSource = TaskCompletionSource<int>();
+
+        auto taskFn = [&]() -> Task<int> { co_return co_await taskCompletionSource.Task() + 1; };
+
+        auto tasks = std::vector<Task<int>>();
+        for (auto i = 0u; i < count; ++i)
+        {
+            tasks.emplace_back(taskFn());
+            scheduler.Schedule(tasks.back());
+        }
+
+        // Act
+        taskCompletionSource.SetResult(41);
+
+        // Assert
+        for (auto & task : tasks)
+        {
+            EXPECT_EQ(task.Result(), 42);
+        }
+    }
+
+    TEST(PollingTaskSchedulerTests, isWorkerThread)
+    {
+        // Arrange
+        auto isWorkerThread = std::atomic<bool>(false);
+        auto currentScheduler = std::atomic<ITaskScheduler *>(nullptr);
+        auto latch = std::latch(1);
+
+        auto scheduler = PollingTaskScheduler(1u);
+
+        // Act
+        scheduler.Schedule(ScheduleItem([&]() {
+            isWorkerThread = scheduler.IsWorkerThread();
+            currentScheduler = CurrentScheduler();
+            latch.count_down();
+        }));
+
+        latch.wait();
+
+        // Assert
+        EXPECT_FALSE(scheduler.IsWorkerThread());
+        EXPECT_TRUE(isWorkerThread);
+        EXPECT_EQ(currentScheduler.load(), &scheduler);
+    }
+
+    TEST(PollingTaskSchedulerTests, pollersArePolledByOneWorker)
+    {
+        // Arrange
+        auto poller = CountingPoller();
+        auto scheduler = PollingTaskScheduler(2u);
+
+        // Act
+        scheduler.AddPoller(poller);
+
+        while (poller.Polls.load() < 100u)
+        {
+            std::this_thread::yield();
+        }
+
+        scheduler.Stop();
+
+        // Assert
+        EXPECT_NE(poller.LastThread.load(), std::this_thread::get_id());
+        EXPECT_NE(poller.LastThread.load(), std::thread::id());
+    }
+
+    TEST(PollingTaskSchedulerTests, addPollerThrowsWhenFull)
+    {
+        // Arrange
+        auto pollers = std::array<CountingPoller, PollingTaskScheduler::MaxPollers + 1u>();
+        auto scheduler = PollingTaskScheduler(1u);
+
+        for (auto i = 0u; i < PollingTaskScheduler::MaxPollers; ++i)
+        {
+            scheduler.AddPoller(pollers[i]);
+        }
+
+        // Act & Assert
+        EXPECT_ANY_THROW(scheduler.AddPoller(pollers.back()));
+    }
+
+    TEST(PollingTaskSchedulerTests, pinnedWorkersRunItems)
+    {
+        // Arrange
+        auto cpus = std::array<size_t, 1u>{ 0u };
+        auto executed = std::atomic<bool>(false);
+        auto latch = std::latch(1);
+
+        auto scheduler = PollingTaskScheduler(cpus);
+
+        // Act
+        scheduler.Schedule(ScheduleItem([&]() {
+            executed = true;
+            latch.count_down();
+        }));
+
+        latch.wait();
+
+        // Assert
+        EXPECT_EQ(scheduler.WorkerCount(), 1u);
+        EXPECT_EQ(scheduler.PinnedWorkerCount(), 1u);
+        EXPECT_TRUE(executed);
+    }
+
+    TEST(PollingTaskSchedulerTests, stopFaultsPendingPromises)
+    {
+        // Arrange
+        auto scheduler = PollingTaskScheduler(1u);
+        auto taskFn = []() -> Task<int> { co_return 42; };
+        auto task = taskFn();
+
+        // Act
+        scheduler.Stop();
+        scheduler.Schedule(task);
+        scheduler.Stop();
+
+        // Assert
+        EXPECT_EQ(task.State(), TaskState::Error);
+        EXPECT_THROW(task.Result(), SchedulerStopped);
+    }
+
+}  // namespace TaskSystem::Tests
\ No newline at end of file
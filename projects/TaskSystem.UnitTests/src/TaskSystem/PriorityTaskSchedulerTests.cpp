@@ -0,0 +1,257 @@
+#include <TaskSystem/PriorityTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/TaskCompletionSource.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <latch>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace TaskSystem::Tests
+{
+    namespace
+    {
+        // Holds the only worker busy so everything scheduled meanwhile is queued when it is released
+        class Blocker final
+        {
+        private:
+            std::latch started{ 1 };
+            std::latch released{ 1 };
+
+        public:
+            void Block(PriorityTaskScheduler & scheduler)
+            {
+                scheduler.Schedule(ScheduleItem([this]() {
+                    started.count_down();
+                    released.wait();
+                }));
+                started.wait();
+            }
+
+            void Release() { released.count_down(); }
+        };
+
+    }  // namespace
+
+    TEST(PriorityTaskSchedulerTests, runWithLambdas)
+    {
+        // Arrange
+        constexpr auto count = 1000;
+
+        auto executed = std::atomic<int>(0);
+        auto latch = std::latch(count);
+
+        auto scheduler = PriorityTaskScheduler(2u);
+
+        // Act
+        for (auto i = 0; i < count; ++i)
+        {
+            auto item = ScheduleItem([&]() {
+                executed.fetch_add(1);
+                latch.count_down();
+            });
+
+            scheduler.Schedule(std::move(item), static_cast<TaskPriority>(i % TaskPriorityCount));
+        }
+
+        latch.wait();
+
+        // Assert
+        EXPECT_EQ(executed.load(), count);
+    }
+
+    TEST(PriorityTaskSchedulerTests, higherPriorityRunsFirst)
+    {
+        // Arrange
+        auto order = std::vector<std::string>();
+        auto latch = std::latch(3);
+        auto blocker = Blocker();
+
+        auto scheduler = PriorityTaskScheduler(1u);
+        blocker.Block(scheduler);
+
+        auto record = [&](std::string name) {
+            return ScheduleItem([&, name]() {
+                order.emplace_back(name);
+                latch.count_down();
+            });
+        };
+
+        // Act
+        scheduler.Schedule(record("low"), TaskPriority::Low);
+        scheduler.Schedule(record("normal"), TaskPriority::Normal);
+        scheduler.Schedule(record("high"), TaskPriority::High);
+
+        blocker.Release();
+        latch.wait();
+
+        // Assert
+        EXPECT_EQ(order, (std::vector<std::string>{ "high", "normal", "low" }));
+    }
+
+    TEST(PriorityTaskSchedulerTests, taskPriorityChoosesLane)
+    {
+        // Arrange
+        auto order = std::vector<std::string>();
+        auto blocker = Blocker();
+
+        auto scheduler = PriorityTaskScheduler(1u);
+        blocker.Block(scheduler);
+
+        auto taskFn = [&](std::string name) -> Task<void> {
+            order.emplace_back(name);
+            co_return;
+        };
+
+        auto lowTask = taskFn("low").WithPriority(TaskPriority::Low);
+        auto highTask = taskFn("high").WithPriority(TaskPriority::High);
+
+        // Act
+        scheduler.Schedule(lowTask);
+        scheduler.Schedule(highTask);
+
+        blocker.Release();
+        lowTask.Wait();
+        highTask.Wait();
+
+        // Assert
+        EXPECT_EQ(order, (std::vector<std::string>{ "high", "low" }));
+    }
+
+    TEST(PriorityTaskSchedulerTests, itemsScheduledByRunningItemInheritItsPriority)
+    {
+        // Arrange
+        auto order = std::vector<std::string>();
+        auto latch = std::latch(3);
+        auto blocker = Blocker();
+
+        auto scheduler = PriorityTaskScheduler(1u);
+        blocker.Block(scheduler);
+
+        auto normalItem = ScheduleItem([&]() {
+            order.emplace_back("normal");
+            latch.count_down();
+        });
+
+        auto highItem = ScheduleItem([&]() {
+            order.emplace_back("high");
+
+            // Note: no priority given, queued in the lane of the item scheduling it
+            scheduler.Schedule(ScheduleItem([&]() {
+                order.emplace_back("child");
+                latch.count_down();
+            }));
+            latch.count_down();
+        });
+
+        // Act
+        scheduler.Schedule(std::move(normalItem), TaskPriority::Normal);
+        scheduler.Schedule(std::move(highItem), TaskPriority::High);
+
+        blocker.Release();
+        latch.wait();
+
+        // Assert
+        EXPECT_EQ(order, (std::vector<std::string>{ "high", "child", "normal" }));
+    }
+
+    TEST(PriorityTaskSchedulerTests, lowLaneIsAgedIn)
+    {
+        // Arrange
+        constexpr auto highCount = 2u * PriorityTaskScheduler::AgingThreshold;
+
+        auto order = std::vector<std::string>();
+        auto latch = std::latch(highCount + 1u);
+        auto blocker = Blocker();
+
+        auto scheduler = PriorityTaskScheduler(1u);
+        blocker.Block(scheduler);
+
+        auto record = [&](std::string name) {
+            return ScheduleItem([&, name]() {
+                order.emplace_back(name);
+                latch.count_down();
+            });
+        };
+
+        // Act
+        scheduler.Schedule(record("low"), TaskPriority::Low);
+
+        for (auto i = 0u; i < highCount; ++i)
+        {
+            scheduler.Schedule(record("high"), TaskPriority::High);
+        }
+
+        blocker.Release();
+        latch.wait();
+
+        // Assert
+        ASSERT_EQ(order.size(), highCount + 1u);
+        EXPECT_EQ(order[PriorityTaskScheduler::AgingThreshold - 1u], "low");
+    }
+
+    TEST(PriorityTaskSchedulerTests, continuationsResumeAtAwaiterPriority)
+    {
+        // Arrange
+        auto order = std::vector<std::string>();
+        auto mutex = std::mutex();
+        auto blocker = Blocker();
+
+        auto scheduler = PriorityTaskScheduler(1u);
+        auto taskCompletionSource = TaskCompletionSource<int>();
+
+        auto taskFn = [&](std::string name) -> Task<void> {
+            co_await taskCompletionSource.Task();
+
+            std::lock_guard lock(mutex);
+            order.emplace_back(name);
+        };
+
+        auto highTask = taskFn("high").WithPriority(TaskPriority::High);
+        auto lowTask = taskFn("low").WithPriority(TaskPriority::Low);
+
+        scheduler.Schedule(highTask);
+        scheduler.Schedule(lowTask);
+
+        while (highTask.State() != TaskState::Suspended || lowTask.State() != TaskState::Suspended)
+        {
+            std::this_thread::yield();
+        }
+
+        blocker.Block(scheduler);
+
+        // Act
+        taskCompletionSource.SetResult(42);
+
+        blocker.Release();
+        highTask.Wait();
+        lowTask.Wait();
+
+        // Assert
+        EXPECT_EQ(order, (std::vector<std::string>{ "high", "low" }));
+    }
+
+    TEST(PriorityTaskSchedulerTests, stopFaultsPendingPromises)
+    {
+        // Arrange
+        auto scheduler = PriorityTaskScheduler(1u);
+        auto taskFn = []() -> Task<int> { co_return 42; };
+        auto task = taskFn().WithPriority(TaskPriority::Low);
+
+        // Act
+        scheduler.Stop();
+        scheduler.Schedule(task);
+        scheduler.Stop();
+
+        // Assert
+        EXPECT_EQ(task.State(), TaskState::Error);
+        EXPECT_THROW(task.Result(), SchedulerStopped);
+    }
+
+}  // namespace TaskSystem::Tests
\ No newline at end of file
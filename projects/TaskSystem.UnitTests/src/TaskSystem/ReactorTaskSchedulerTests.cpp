@@ -0,0 +1,322 @@
+#if defined(__linux__)
+
+#include <TaskSystem/ReactorTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/TcpSocket.hpp>
+#include <TaskSystem/ThreadPoolTaskScheduler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+
+namespace TaskSystem::Tests
+{
+    namespace
+    {
+        using namespace std::chrono_literals;
+
+        sockaddr_in Loopback(std::uint16_t port = 0u)
+        {
+            auto address = sockaddr_in();
+            address.sin_family = AF_INET;
+            address.sin_port = htons(port);
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            return address;
+        }
+
+        sockaddr const * AsSockaddr(sockaddr_in const & address)
+        {
+            return reinterpret_cast<sockaddr const *>(&address);
+        }
+
+        // Listens on an ephemeral loopback port and records it in address
+        TcpSocket ListenOnLoopback(ReactorTaskScheduler & reactor, sockaddr_in & address)
+        {
+            address = Loopback();
+            auto listener = TcpSocket::Listen(reactor, AsSockaddr(address), sizeof(address));
+
+            auto length = socklen_t(sizeof(address));
+            ::getsockname(listener.Fd(), reinterpret_cast<sockaddr *>(&address), &length);
+            return listener;
+        }
+
+        std::span<std::byte const> Bytes(std::string_view text)
+        {
+            return std::as_bytes(std::span(text.data(), text.size()));
+        }
+
+        Task<> EchoSession(TcpSocket connection)
+        {
+            auto buffer = std::array<std::byte, 64>();
+            while (auto count = co_await connection.ReadAsync(buffer))
+            {
+                co_await connection.WriteAsync(std::span(buffer).first(count));
+            }
+        }
+
+        // Accepts count connections, one at a time, and echoes each on its own task
+        Task<> EchoServer(ReactorTaskScheduler & reactor, TcpSocket & listener, std::vector<Task<>> & sessions, int count)
+        {
+            for (auto i = 0; i < count; ++i)
+            {
+                sessions.emplace_back(EchoSession(co_await listener.AcceptAsync()));
+                reactor.Schedule(sessions.back());
+            }
+        }
+
+        Task<std::string> EchoClient(ReactorTaskScheduler & reactor, sockaddr_in address, std::string text)
+        {
+            auto client = TcpSocket::Open(reactor);
+            co_await client.ConnectAsync(AsSockaddr(address), sizeof(address));
+            co_await client.WriteAsync(Bytes(text));
+
+            auto reply = std::string();
+            auto buffer = std::array<std::byte, 64>();
+            while (reply.size() < text.size())
+            {
+                auto count = co_await client.ReadAsync(buffer);
+                reply.append(reinterpret_cast<char const *>(buffer.data()), count);
+            }
+
+            co_return reply;
+        }
+
+    }  // namespace
+
+    TEST(ReactorTaskSchedulerTests, echoesOverLoopback)
+    {
+        // Arrange
+        auto reactor = ReactorTaskScheduler();
+        auto address = sockaddr_in();
+        auto listener = ListenOnLoopback(reactor, address);
+        auto sessions = std::vector<Task<>>();
+        auto server = EchoServer(reactor, listener, sessions, 1);
+        auto task = EchoClient(reactor, address, "hello reactor");
+        reactor.Schedule(server);
+        reactor.Schedule(task);
+
+        // Act
+        reactor.RunUntilIdle();
+
+        // Assert
+        EXPECT_EQ(task.Result(), "hello reactor");
+        EXPECT_EQ(server.State(), TaskState::Completed);
+        EXPECT_EQ(sessions.front().State(), TaskState::Completed);
+    }
+
+    TEST(ReactorTaskSchedulerTests, manyConnectionsEchoConcurrently)
+    {
+        // Arrange
+        constexpr auto count = 50;
+
+        auto reactor = ReactorTaskScheduler();
+        auto address = sockaddr_in();
+        auto listener = ListenOnLoopback(reactor, address);
+
+        auto sessions = std::vector<Task<>>();
+        sessions.reserve(count);
+        auto server = EchoServer(reactor, listener, sessions, count);
+        reactor.Schedule(server);
+
+        auto tasks = std::vector<Task<std::string>>();
+        tasks.reserve(count);
+        for (auto i = 0; i < count; ++i)
+        {
+            tasks.emplace_back(EchoClient(reactor, address, "connection " + std::to_string(i)));
+            reactor.Schedule(tasks.back());
+        }
+
+        // Act
+        reactor.RunUntilIdle();
+
+        // Assert
+        for (auto i = 0; i < count; ++i)
+        {
+            EXPECT_EQ(tasks[i].Result(), "connection " + std::to_string(i));
+        }
+
+        for (auto & session : sessions)
+        {
+            EXPECT_EQ(session.State(), TaskState::Completed);
+        }
+    }
+
+    TEST(ReactorTaskSchedulerTests, readParksUntilPeerWrites)
+    {
+        // Arrange
+        auto reactor = ReactorTaskScheduler();
+        auto address = sockaddr_in();
+        auto listener = ListenOnLoopback(reactor, address);
+
+        auto peer = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        ASSERT_EQ(::connect(peer, AsSockaddr(address), sizeof(address)), 0);
+
+        auto task = [](TcpSocket & listener) -> Task<std::size_t> {
+            auto connection = co_await listener.AcceptAsync();
+            auto buffer = std::array<std::byte, 16>();
+            co_return co_await connection.ReadAsync(buffer);
+        }(listener);
+        reactor.Schedule(task);
+
+        auto writer = std::thread([&]() {
+            std::this_thread::sleep_for(10ms);
+            ::send(peer, "abc", 3u, MSG_NOSIGNAL);
+        });
+
+        // Act
+        reactor.RunUntilIdle();
+        writer.join();
+        ::close(peer);
+
+        // Assert
+        EXPECT_EQ(task.Result(), 3u);
+    }
+
+    TEST(ReactorTaskSchedulerTests, closeCancelsPendingRead)
+    {
+        // Arrange
+        auto reactor = ReactorTaskScheduler();
+        auto address = sockaddr_in();
+        auto listener = ListenOnLoopback(reactor, address);
+
+        auto peer = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        ASSERT_EQ(::connect(peer, AsSockaddr(address), sizeof(address)), 0);
+
+        auto connection = std::optional<TcpSocket>();
+        auto task = [](ReactorTaskScheduler & reactor, TcpSocket & listener, auto & connection) -> Task<int> {
+            connection.emplace(co_await listener.AcceptAsync());
+
+            // Note: runs once the read below has parked, the peer never writes
+            reactor.Schedule(ScheduleItem([&connection]() { connection->Close(); }));
+
+            try
+            {
+                auto buffer = std::array<std::byte, 16>();
+                co_await connection->ReadAsync(buffer);
+            }
+            catch (std::system_error const & error)
+            {
+                co_return error.code().value();
+            }
+
+            co_return 0;
+        }(reactor, listener, connection);
+        reactor.Schedule(task);
+
+        // Act
+        reactor.RunUntilIdle();
+        ::close(peer);
+
+        // Assert
+        EXPECT_EQ(task.Result(), ECANCELED);
+        EXPECT_FALSE(connection->IsOpen());
+    }
+
+    TEST(ReactorTaskSchedulerTests, continueOnResumesOnTargetScheduler)
+    {
+        // Arrange
+        auto pool = ThreadPoolTaskScheduler(1u);
+        auto reactor = ReactorTaskScheduler();
+        auto address = sockaddr_in();
+        auto listener = ListenOnLoopback(reactor, address);
+
+        auto peer = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        ASSERT_EQ(::connect(peer, AsSockaddr(address), sizeof(address)), 0);
+
+        auto task = [](TcpSocket & listener, ThreadPoolTaskScheduler & pool) -> Task<bool> {
+            auto connection = co_await listener.AcceptAsync();
+            auto buffer = std::array<std::byte, 16>();
+            co_await connection.ReadAsync(buffer).ContinueOn(pool);
+            co_return pool.IsWorkerThread();
+        }(listener, pool);
+        reactor.Schedule(task);
+
+        auto loop = std::thread([&]() { reactor.RunForever(); });
+
+        // Act
+        std::this_thread::sleep_for(10ms);
+        ::send(peer, "abc", 3u, MSG_NOSIGNAL);
+        auto resumedOnPool = task.Result();
+
+        reactor.Stop();
+        loop.join();
+        ::close(peer);
+
+        // Assert
+        EXPECT_TRUE(resumedOnPool);
+    }
+
+    TEST(ReactorTaskSchedulerTests, readReturnsZeroWhenPeerCloses)
+    {
+        // Arrange
+        auto reactor = ReactorTaskScheduler();
+        auto address = sockaddr_in();
+        auto listener = ListenOnLoopback(reactor, address);
+
+        auto task = [](ReactorTaskScheduler & reactor, TcpSocket & listener, sockaddr_in address) -> Task<std::size_t> {
+            auto client = TcpSocket::Open(reactor);
+            co_await client.ConnectAsync(AsSockaddr(address), sizeof(address));
+
+            auto connection = co_await listener.AcceptAsync();
+            client.Close();
+
+            auto buffer = std::array<std::byte, 16>();
+            co_return co_await connection.ReadAsync(buffer);
+        }(reactor, listener, address);
+        reactor.Schedule(task);
+
+        // Act
+        reactor.RunUntilIdle();
+
+        // Assert
+        EXPECT_EQ(task.Result(), 0u);
+    }
+
+    TEST(ReactorTaskSchedulerTests, connectToClosedPortThrows)
+    {
+        // Arrange
+        auto reactor = ReactorTaskScheduler();
+        auto address = sockaddr_in();
+        {
+            // Note: the port is free again once the listener is closed
+            auto listener = ListenOnLoopback(reactor, address);
+        }
+
+        auto task = [](ReactorTaskScheduler & reactor, sockaddr_in address) -> Task<int> {
+            auto client = TcpSocket::Open(reactor);
+            try
+            {
+                co_await client.ConnectAsync(AsSockaddr(address), sizeof(address));
+            }
+            catch (std::system_error const & error)
+            {
+                co_return error.code().value();
+            }
+
+            co_return 0;
+        }(reactor, address);
+        reactor.Schedule(task);
+
+        // Act
+        reactor.RunUntilIdle();
+
+        // Assert
+        EXPECT_EQ(task.Result(), ECONNREFUSED);
+    }
+
+}  // namespace TaskSystem::Tests
+
+#endif
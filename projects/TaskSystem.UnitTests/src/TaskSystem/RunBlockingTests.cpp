@@ -0,0 +1,214 @@
+#include <TaskSystem/BlockingTaskScheduler.hpp>
+#include <TaskSystem/RunBlocking.hpp>
+#include <TaskSystem/SynchronousTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/ThreadPoolTaskScheduler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <latch>
+#include <semaphore>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace TaskSystem::Tests
+{
+
+    TEST(RunBlockingTests, returnsResultOnCallersScheduler)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(2u);
+        auto blocking = BlockingTaskScheduler();
+
+        auto taskFn = [](ThreadPoolTaskScheduler & scheduler, BlockingTaskScheduler & blocking) -> Task<std::pair<bool, bool>> {
+            auto ranOnBlockingPool = co_await RunBlocking([&]() { return blocking.IsWorkerThread(); }, blocking);
+            co_return std::pair(ranOnBlockingPool, scheduler.IsWorkerThread());
+        };
+
+        auto task = taskFn(scheduler, blocking);
+
+        // Act
+        scheduler.Schedule(task);
+        auto [ranOnBlockingPool, resumedOnScheduler] = task.Result();
+
+        // Assert
+        EXPECT_TRUE(ranOnBlockingPool);
+        EXPECT_TRUE(resumedOnScheduler);
+    }
+
+    TEST(RunBlockingTests, voidFunctionCompletes)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(1u);
+        auto blocking = BlockingTaskScheduler();
+        auto called = false;
+
+        auto taskFn = [](BlockingTaskScheduler & blocking, bool & called) -> Task<> {
+            co_await RunBlocking([&]() { called = true; }, blocking);
+        };
+
+        auto task = taskFn(blocking, called);
+
+        // Act
+        scheduler.Schedule(task);
+        task.Wait();
+
+        // Assert
+        EXPECT_EQ(task.State(), TaskState::Completed);
+        EXPECT_TRUE(called);
+    }
+
+    TEST(RunBlockingTests, exceptionIsRethrownToCaller)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(1u);
+        auto blocking = BlockingTaskScheduler();
+
+        auto taskFn = [](BlockingTaskScheduler & blocking) -> Task<bool> {
+            try
+            {
+                [[maybe_unused]] auto _ = co_await RunBlocking(
+                    []() -> int { throw std::runtime_error("blocking"); }, blocking);
+            }
+            catch (std::runtime_error const &)
+            {
+                co_return true;
+            }
+
+            co_return false;
+        };
+
+        auto task = taskFn(blocking);
+
+        // Act
+        scheduler.Schedule(task);
+
+        // Assert
+        EXPECT_TRUE(task.Result());
+    }
+
+    TEST(RunBlockingTests, stoppedPoolRethrowsSchedulerStopped)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(1u);
+        auto blocking = BlockingTaskScheduler();
+        blocking.Stop();
+
+        auto taskFn = [](BlockingTaskScheduler & blocking) -> Task<bool> {
+            try
+            {
+                [[maybe_unused]] auto _ = co_await RunBlocking([]() { return 42; }, blocking);
+            }
+            catch (SchedulerStopped const &)
+            {
+                co_return true;
+            }
+
+            co_return false;
+        };
+
+        auto task = taskFn(blocking);
+
+        // Act
+        scheduler.Schedule(task);
+
+        // Assert
+        EXPECT_TRUE(task.Result());
+    }
+
+    TEST(RunBlockingTests, callQueuedWhenPoolStopsRethrowsSchedulerStopped)
+    {
+        // Arrange
+        auto options = BlockingPoolOptions();
+        options.MaxThreads = 1u;
+
+        auto scheduler = SynchronousTaskScheduler();
+        auto blocking = BlockingTaskScheduler(options);
+        auto release = std::binary_semaphore(0);
+        auto stopped = std::atomic<bool>(false);
+
+        auto busyFn = [](BlockingTaskScheduler & blocking, std::binary_semaphore & release) -> Task<> {
+            co_await RunBlocking([&]() { release.acquire(); }, blocking);
+        };
+
+        auto queuedFn = [](BlockingTaskScheduler & blocking) -> Task<bool> {
+            try
+            {
+                [[maybe_unused]] auto _ = co_await RunBlocking([]() { return 42; }, blocking);
+            }
+            catch (SchedulerStopped const &)
+            {
+                co_return true;
+            }
+
+            co_return false;
+        };
+
+        // Note: the single thread is held by the first call, so the second stays queued
+        auto busy = busyFn(blocking, release);
+        auto queued = queuedFn(blocking);
+        scheduler.Schedule(busy);
+        scheduler.Schedule(queued);
+        scheduler.Run();
+
+        // Act
+        auto stopper = std::thread([&]() { blocking.Stop(); });
+
+        // Note: a call is only refused once Stop has taken the queue, the held call is released after that
+        auto onRejected = [](void * context) noexcept { static_cast<std::atomic<bool> *>(context)->store(true); };
+        while (!stopped.load())
+        {
+            blocking.ScheduleCall([](void *) {}, onRejected, &stopped);
+            std::this_thread::yield();
+        }
+
+        release.release();
+        stopper.join();
+        scheduler.Run();
+
+        // Assert
+        EXPECT_EQ(busy.State(), TaskState::Completed);
+        EXPECT_TRUE(queued.Result());
+    }
+
+    TEST(RunBlockingTests, blockingCallsDoNotStallComputeWorker)
+    {
+        // Arrange
+        constexpr auto count = 8;
+
+        // Note: every call waits for all the others, only possible if none of them holds the single compute worker
+        auto scheduler = ThreadPoolTaskScheduler(1u);
+        auto blocking = BlockingTaskScheduler();
+        auto latch = std::latch(count);
+
+        auto taskFn = [](BlockingTaskScheduler & blocking, std::latch & latch) -> Task<> {
+            co_await RunBlocking([&]() { latch.arrive_and_wait(); }, blocking);
+        };
+
+        auto tasks = std::vector<Task<>>();
+        tasks.reserve(count);
+
+        // Act
+        for (auto i = 0; i < count; ++i)
+        {
+            tasks.emplace_back(taskFn(blocking, latch));
+            scheduler.Schedule(tasks.back());
+        }
+
+        for (auto & task : tasks)
+        {
+            task.Wait();
+        }
+
+        // Assert
+        for (auto & task : tasks)
+        {
+            EXPECT_EQ(task.State(), TaskState::Completed);
+        }
+    }
+
+}  // namespace TaskSystem::Tests
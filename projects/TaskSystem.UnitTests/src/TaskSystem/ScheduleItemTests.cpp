@@ -2,6 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <exception>
+#include <memory>
+#include <utility>
+
 
 namespace TaskSystem::Tests
 {
@@ -11,6 +15,14 @@ namespace TaskSystem::Tests
 
         void ThrowFunction() { throw std::exception(); }
 
+        void SetFlag(void * context) { *static_cast<bool *>(context) = true; }
+
+        void ThrowContextFunction(void *) { throw std::exception(); }
+
+        std::exception_ptr handledException;
+
+        void RecordException(std::exception_ptr exception) noexcept { handledException = std::move(exception); }
+
     }  // namespace
 
     TEST(ScheduleItemTests, runLambda)
@@ -65,4 +77,82 @@ namespace TaskSystem::Tests
         EXPECT_NE(result, nullptr);
     }
 
+    TEST(ScheduleItemTests, runMoveOnlyLambda)
+    {
+        // Arrange
+        auto completed = false;
+        auto value = std::make_unique<int>(42);
+        auto lambda = [&, value = std::move(value)]() {
+            completed = *value == 42;
+        };
+
+        // Act
+        auto item = ScheduleItem(std::move(lambda));
+        auto moved = std::move(item);
+        auto result = moved.Run();
+
+        // Assert
+        EXPECT_EQ(result, nullptr);
+        EXPECT_TRUE(completed);
+    }
+
+    TEST(ScheduleItemTests, runContextFunction)
+    {
+        // Arrange
+        auto completed = false;
+
+        // Act
+        auto item = ScheduleItem(SetFlag, &completed);
+        auto result = item.Run();
+
+        // Assert
+        EXPECT_EQ(result, nullptr);
+        EXPECT_TRUE(completed);
+        EXPECT_EQ(item.Promise(), nullptr);
+    }
+
+    TEST(ScheduleItemTests, runContextFunctionThrows)
+    {
+        // Act
+        auto item = ScheduleItem(ThrowContextFunction, nullptr);
+        auto result = item.Run();
+
+        // Assert
+        EXPECT_NE(result, nullptr);
+    }
+
+    TEST(ScheduleItemTests, executeFunctionThrowsCallsUnhandledExceptionHandler)
+    {
+        // Arrange
+        handledException = nullptr;
+        auto previous = SetUnhandledExceptionHandler(RecordException);
+
+        // Act
+        auto item = ScheduleItem(ThrowFunction);
+        item.Execute();
+
+        SetUnhandledExceptionHandler(previous);
+
+        // Assert
+        EXPECT_NE(handledException, nullptr);
+    }
+
+    TEST(ScheduleItemTests, executeLambdaDoesNotCallUnhandledExceptionHandler)
+    {
+        // Arrange
+        handledException = nullptr;
+        auto previous = SetUnhandledExceptionHandler(RecordException);
+        auto completed = false;
+
+        // Act
+        auto item = ScheduleItem([&]() { completed = true; });
+        item.Execute();
+
+        SetUnhandledExceptionHandler(previous);
+
+        // Assert
+        EXPECT_TRUE(completed);
+        EXPECT_EQ(handledException, nullptr);
+    }
+
 }  // namespace TaskSystem::Tests
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include <TaskSystem/EventLoopTaskScheduler.hpp>
+#include <TaskSystem/SwitchTo.hpp>
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/ThreadPoolTaskScheduler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+
+namespace TaskSystem::Tests
+{
+
+    TEST(SwitchToTests, switchToContinuesOnTargetScheduler)
+    {
+        // Arrange
+        auto scheduler1 = ThreadPoolTaskScheduler(1u);
+        auto scheduler2 = ThreadPoolTaskScheduler(1u);
+
+        auto taskFn = [](ThreadPoolTaskScheduler & scheduler1,
+                         ThreadPoolTaskScheduler & scheduler2) -> Task<std::array<bool, 3u>> {
+            auto startedOn1 = scheduler1.IsWorkerThread();
+            co_await SwitchTo(scheduler2);
+            auto switchedTo2 = scheduler2.IsWorkerThread();
+            co_await SwitchTo(scheduler1);
+            co_return std::array{ startedOn1, switchedTo2, scheduler1.IsWorkerThread() };
+        };
+
+        auto task = taskFn(scheduler1, scheduler2);
+
+        // Act
+        scheduler1.Schedule(task);
+        auto [startedOn1, switchedTo2, switchedBackTo1] = task.Result();
+
+        // Assert
+        EXPECT_TRUE(startedOn1);
+        EXPECT_TRUE(switchedTo2);
+        EXPECT_TRUE(switchedBackTo1);
+    }
+
+    TEST(SwitchToTests, switchToCurrentSchedulerDoesNotSuspend)
+    {
+        // Arrange
+        auto scheduler = EventLoopTaskScheduler();
+
+        auto taskFn = [](EventLoopTaskScheduler & scheduler) -> Task<int> {
+            co_await SwitchTo(scheduler);
+            co_return 42;
+        };
+
+        auto task = taskFn(scheduler);
+        scheduler.Schedule(task);
+
+        // Act
+        auto count = scheduler.RunUntilIdle();
+
+        // Assert
+        EXPECT_EQ(count, 1u);
+        EXPECT_EQ(task.Result(), 42);
+    }
+
+    TEST(SwitchToTests, yieldLetsQueuedItemsRunFirst)
+    {
+        // Arrange
+        auto scheduler = EventLoopTaskScheduler();
+        auto order = std::vector<int>();
+
+        auto taskFn = [](std::vector<int> & order, int id) -> Task<> {
+            order.push_back(id);
+            co_await Yield();
+            order.push_back(id);
+        };
+
+        auto task1 = taskFn(order, 1);
+        auto task2 = taskFn(order, 2);
+        scheduler.Schedule(task1);
+        scheduler.Schedule(task2);
+
+        // Act
+        auto count = scheduler.RunUntilIdle();
+
+        // Assert
+        EXPECT_EQ(count, 4u);
+        EXPECT_EQ(order, (std::vector<int>{ 1, 2, 1, 2 }));
+        EXPECT_EQ(task1.State(), TaskState::Completed);
+        EXPECT_EQ(task2.State(), TaskState::Completed);
+    }
+
+    TEST(SwitchToTests, manyHopsBetweenSchedulers)
+    {
+        // Arrange
+        constexpr auto hops = 1000;
+
+        auto scheduler1 = ThreadPoolTaskScheduler(2u);
+        auto scheduler2 = ThreadPoolTaskScheduler(2u);
+
+        auto taskFn = [](ThreadPoolTaskScheduler & scheduler1, ThreadPoolTaskScheduler & scheduler2) -> Task<int> {
+            auto onTarget = 0;
+            for (auto i = 0; i < hops; ++i)
+            {
+                auto & target = i % 2 == 0 ? scheduler2 : scheduler1;
+                co_await SwitchTo(target);
+                onTarget += target.IsWorkerThread() ? 1 : 0;
+            }
+
+            co_return onTarget;
+        };
+
+        auto task = taskFn(scheduler1, scheduler2);
+
+        // Act
+        scheduler1.Schedule(task);
+
+        // Assert
+        EXPECT_EQ(task.Result(), hops);
+    }
+
+}  // namespace TaskSystem::Tests
@@ -1,11 +1,32 @@
+#include <TaskSystem/Delay.hpp>
+#include <TaskSystem/ManualClock.hpp>
 #include <TaskSystem/SynchronousTaskScheduler.hpp>
 #include <TaskSystem/Task.hpp>
+#include <TaskSystem/TaskCompletionSource.hpp>
+#include <TaskSystem/Timeout.hpp>
+#include <TaskSystem/TimerService.hpp>
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <vector>
+
 
 namespace TaskSystem::Tests
 {
+    namespace
+    {
+        using namespace std::chrono_literals;
+
+        TimerOptions VirtualTimerOptions(ManualClock & clock)
+        {
+            auto options = TimerOptions();
+            options.DedicatedThread = false;
+            options.Clock = &clock;
+            return options;
+        }
+
+    }  // namespace
 
     TEST(SynchronousTaskSchedulerTests, runWithLambdas)
     {
@@ -70,4 +91,138 @@ namespace TaskSystem::Tests
         EXPECT_TRUE(isWorkerThread);
     }
 
-}  // namespace TaskSystem::Tests
\ No newline at end of file
+    TEST(SynchronousTaskSchedulerTests, itemsRunInScheduleOrder)
+    {
+        // Arrange
+        auto order = std::vector<int>();
+        auto scheduler = SynchronousTaskScheduler();
+
+        auto taskFn = [](std::vector<int> & order, int value) -> Task<> {
+            order.push_back(value);
+            co_return;
+        };
+
+        auto task1 = taskFn(order, 1);
+        auto task3 = taskFn(order, 3);
+
+        scheduler.Schedule(ScheduleItem([&]() { order.push_back(0); }));
+        scheduler.Schedule(task1);
+        scheduler.Schedule(ScheduleItem([&]() { order.push_back(2); }));
+        scheduler.Schedule(task3);
+
+        // Act
+        scheduler.Run();
+
+        // Assert
+        EXPECT_EQ(order, (std::vector<int>{ 0, 1, 2, 3 }));
+    }
+
+    TEST(SynchronousTaskSchedulerTests, runAdvancesVirtualTimeThroughDelays)
+    {
+        // Arrange
+        auto clock = ManualClock();
+        auto timers = TimerService(VirtualTimerOptions(clock));
+        auto scheduler = SynchronousTaskScheduler(timers, clock);
+        auto start = clock.Now();
+        auto realStart = DeadlineClock::now();
+
+        auto task = [&]() -> Task<> {
+            co_await Delay(1h, timers);
+            co_await Delay(30min, timers);
+        }();
+        scheduler.Schedule(task);
+
+        // Act
+        scheduler.Run();
+
+        // Assert
+        EXPECT_EQ(task.State(), TaskState::Completed);
+        EXPECT_GE(clock.Now() - start, 90min);
+        EXPECT_LT(clock.Now() - start, 91min);
+        EXPECT_LT(DeadlineClock::now() - realStart, 10s);
+    }
+
+    TEST(SynchronousTaskSchedulerTests, virtualTimersFireInExpiryOrder)
+    {
+        // Arrange
+        auto clock = ManualClock();
+        auto timers = TimerService(VirtualTimerOptions(clock));
+        auto scheduler = SynchronousTaskScheduler(timers, clock);
+        auto order = std::vector<int>();
+
+        auto taskFn = [&](int seconds) -> Task<> {
+            co_await Delay(std::chrono::seconds(seconds), timers);
+            order.emplace_back(seconds);
+        };
+
+        auto task1 = taskFn(3);
+        auto task2 = taskFn(1);
+        auto task3 = taskFn(2);
+        scheduler.Schedule(task1);
+        scheduler.Schedule(task2);
+        scheduler.Schedule(task3);
+
+        // Act
+        scheduler.Run();
+
+        // Assert
+        EXPECT_EQ(order, (std::vector<int>{ 1, 2, 3 }));
+    }
+
+    TEST(SynchronousTaskSchedulerTests, runUntilStopsAdvancingAtTime)
+    {
+        // Arrange
+        auto clock = ManualClock();
+        auto timers = TimerService(VirtualTimerOptions(clock));
+        auto scheduler = SynchronousTaskScheduler(timers, clock);
+        auto start = clock.Now();
+
+        auto task = [&]() -> Task<> { co_await Delay(10s, timers); }();
+        scheduler.Schedule(task);
+
+        // Act
+        scheduler.RunUntil(start + 5s);
+        auto stateAtTime = task.State();
+        auto clockAtTime = clock.Now();
+
+        scheduler.Run();
+
+        // Assert
+        EXPECT_EQ(stateAtTime, TaskState::Suspended);
+        EXPECT_EQ(clockAtTime, start + 5s);
+        EXPECT_EQ(task.State(), TaskState::Completed);
+    }
+
+    TEST(SynchronousTaskSchedulerTests, timeoutExpiresOnVirtualTime)
+    {
+        // Arrange
+        auto clock = ManualClock();
+        auto timers = TimerService(VirtualTimerOptions(clock));
+        auto scheduler = SynchronousTaskScheduler(timers, clock);
+        auto taskCompletionSource = TaskCompletionSource<int>();
+        auto inner = taskCompletionSource.Task();
+
+        auto task = [&]() -> Task<bool> {
+            try
+            {
+                [[maybe_unused]] auto _ = co_await Timeout(inner, 1min, timers);
+            }
+            catch (TimeoutExceeded const &)
+            {
+                co_return true;
+            }
+
+            co_return false;
+        }();
+        scheduler.Schedule(task);
+
+        // Act
+        scheduler.Run();
+        taskCompletionSource.SetResult(42);
+
+        // Assert
+        EXPECT_EQ(task.State(), TaskState::Completed);
+        EXPECT_TRUE(task.Result());
+    }
+
+}  // namespace TaskSystem::Tests
@@ -3,6 +3,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 
 namespace TaskSystem::Tests
 {
@@ -391,4 +395,93 @@ namespace TaskSystem::Tests
         EXPECT_EQ(task6.State(), TaskState::Completed);
     }
 
+    TEST(TaskCompletionSourceTests, executeSynchronouslyResumesAwaiterInline)
+    {
+        // Arrange
+        auto scheduler = SynchronousTaskScheduler();
+        auto taskCompletionSource = TaskCompletionSource<int>(ContinuationOptions::ExecuteSynchronously);
+
+        auto taskFn = [&]() -> Task<int> { co_return co_await taskCompletionSource.Task(); };
+        auto task = taskFn();
+
+        scheduler.Schedule(task);
+        scheduler.Run();
+
+        auto stateAfterSet = TaskState(TaskState::Unknown);
+
+        // Act
+        scheduler.Schedule(ScheduleItem([&]() {
+            taskCompletionSource.SetResult(42);
+            stateAfterSet = task.State();
+        }));
+        scheduler.Run();
+
+        // Assert
+        EXPECT_EQ(stateAfterSet, TaskState::Completed);
+        EXPECT_EQ(task.Result(), 42);
+    }
+
+    TEST(TaskCompletionSourceTests, executeSynchronouslySchedulesAwaiterFromOtherThread)
+    {
+        // Arrange
+        auto scheduler = SynchronousTaskScheduler();
+        auto taskCompletionSource = TaskCompletionSource<int>(ContinuationOptions::ExecuteSynchronously);
+
+        auto taskFn = [&]() -> Task<int> { co_return co_await taskCompletionSource.Task(); };
+        auto task = taskFn();
+
+        scheduler.Schedule(task);
+        scheduler.Run();
+
+        // Act
+        taskCompletionSource.SetResult(42);
+
+        // Assert
+        EXPECT_EQ(task.State(), TaskState::Scheduled);
+
+        scheduler.Run();
+        EXPECT_EQ(task.Result(), 42);
+    }
+
+    TEST(TaskCompletionSourceTests, executeSynchronouslyFallsBackToSchedulingPastDepthLimit)
+    {
+        // Arrange
+        constexpr auto count = Detail::SynchronousContinuationDepthLimit * 3u;
+
+        auto scheduler = SynchronousTaskScheduler();
+        auto sources = std::vector<std::unique_ptr<TaskCompletionSource<>>>();
+        for (auto i = 0u; i <= count; ++i)
+        {
+            sources.emplace_back(std::make_unique<TaskCompletionSource<>>(ContinuationOptions::ExecuteSynchronously));
+        }
+
+        auto maxDepth = size_t(0u);
+
+        // Each task resumes the next from inside its own inline resumption
+        auto taskFn = [&](size_t index) -> Task<> {
+            co_await sources[index]->Task();
+            maxDepth = std::max(maxDepth, Detail::synchronousContinuationDepth);
+            sources[index + 1u]->SetCompleted();
+        };
+
+        auto tasks = std::vector<Task<>>();
+        for (auto i = 0u; i < count; ++i)
+        {
+            tasks.emplace_back(taskFn(i));
+            scheduler.Schedule(tasks.back());
+        }
+        scheduler.Run();
+
+        // Act
+        scheduler.Schedule(ScheduleItem([&]() { sources[0]->SetCompleted(); }));
+        scheduler.Run();
+
+        // Assert
+        for (auto & task : tasks)
+        {
+            EXPECT_EQ(task.State(), TaskState::Completed);
+        }
+        EXPECT_EQ(maxDepth, Detail::SynchronousContinuationDepthLimit);
+    }
+
 }  // namespace TaskSystem::Tests
\ No newline at end of file
@@ -1,11 +1,15 @@
 #include <TaskSystem/SynchronousTaskScheduler.hpp>
 #include <TaskSystem/Task.hpp>
+#include <TaskSystem/TaskCompletionSource.hpp>
 #include <TaskSystem/Utils/Tracked.hpp>
 
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 
 using namespace std::chrono_literals;
@@ -727,4 +731,166 @@ namespace TaskSystem::Tests
         EXPECT_EQ(task6.Result(), expected);
     }
 
+    TEST(TaskTests, compactTaskPromiseFitsInCacheLine)
+    {
+        // Arrange
+        using CompactVoidPromise = Detail::TaskPromise<void, Detail::CompactTaskPromisePolicy>;
+        using CompactIntPromise = Detail::TaskPromise<int, Detail::CompactTaskPromisePolicy>;
+
+        // Assert
+        EXPECT_LE(sizeof(CompactVoidPromise), Detail::CacheLineSize);
+        EXPECT_LE(sizeof(CompactIntPromise), Detail::CacheLineSize);
+        EXPECT_LT(sizeof(CompactVoidPromise), sizeof(Detail::TaskPromise<void>));
+    }
+
+    TEST(TaskTests, compactTaskLambda)
+    {
+        // Arrange
+        auto expected = 42;
+        auto task = [&]() -> CompactTask<int> { co_return expected; }();
+
+        auto scheduler = SynchronousTaskScheduler();
+
+        // Act
+        scheduler.Schedule(task);
+        scheduler.Run();
+
+        // Assert
+        EXPECT_EQ(task.State(), TaskState::Completed);
+        EXPECT_EQ(task.Result(), expected);
+    }
+
+    TEST(TaskTests, compactTaskLambdaThatThrows)
+    {
+        // Arrange
+        auto task = []() -> CompactTask<void> {
+            throw std::exception();
+            co_return;
+        }();
+
+        auto scheduler = SynchronousTaskScheduler();
+
+        // Act
+        scheduler.Schedule(task);
+        scheduler.Run();
+
+        // Assert
+        EXPECT_EQ(task.State(), TaskState::Error);
+        EXPECT_THROW(task.ThrowIfFaulted(), std::exception);
+    }
+
+    TEST(TaskTests, awaitedCompactTaskInTask)
+    {
+        // Arrange
+        auto expected = 42;
+        auto innerTask = CompactTask<int>::From([&]() { return expected; });
+
+        auto task = [&]() -> Task<int> { co_return co_await innerTask; }();
+
+        auto scheduler = SynchronousTaskScheduler();
+
+        // Act
+        scheduler.Schedule(task);
+        scheduler.Run();
+
+        // Assert
+        EXPECT_EQ(innerTask.State(), TaskState::Completed);
+        EXPECT_EQ(task.Result(), expected);
+    }
+
+    TEST(TaskTests, compactTaskDestroysResult)
+    {
+        // Arrange
+        auto value = std::make_shared<int>(42);
+        auto scheduler = SynchronousTaskScheduler();
+
+        // Act
+        {
+            auto task = [&]() -> CompactTask<std::shared_ptr<int>> { co_return value; }();
+            scheduler.Schedule(task);
+            scheduler.Run();
+
+            EXPECT_EQ(value.use_count(), 2);
+        }
+
+        // Assert
+        EXPECT_EQ(value.use_count(), 1);
+    }
+
+    TEST(TaskTests, completedTaskHandsOffToAwaiterOnCurrentScheduler)
+    {
+        // Arrange
+        auto scheduler = SynchronousTaskScheduler();
+        auto taskCompletionSource = TaskCompletionSource<int>();
+        auto order = std::vector<std::string>();
+
+        auto innerTask = [&]() -> Task<int> {
+            auto value = co_await taskCompletionSource.Task();
+            order.emplace_back("inner");
+            co_return value;
+        }();
+
+        auto outerTask = [&]() -> Task<int> {
+            auto value = co_await innerTask;
+            order.emplace_back("outer");
+            co_return value + 1;
+        }();
+
+        auto otherTask = [&]() -> Task<int> {
+            auto value = co_await taskCompletionSource.Task();
+            order.emplace_back("other");
+            co_return value;
+        }();
+
+        scheduler.Schedule(outerTask);
+        scheduler.Schedule(otherTask);
+        scheduler.Run();
+
+        // Act
+        taskCompletionSource.SetResult(42);
+        scheduler.Run();
+
+        // Assert
+        EXPECT_EQ(outerTask.Result(), 43);
+        EXPECT_EQ(otherTask.Result(), 42);
+
+        // Note: the outer task resumes as soon as the inner one completes rather than queuing behind the other task
+        EXPECT_EQ(order, (std::vector<std::string>{ "inner", "outer", "other" }));
+    }
+
+    TEST(TaskTests, awaitedTaskInheritsAwaiterPriority)
+    {
+        // Arrange
+        auto scheduler = SynchronousTaskScheduler();
+
+        auto innerTask = []() -> Task<int> { co_return 42; }().WithPriority(TaskPriority::Low);
+        auto outerTask = [&]() -> Task<int> { co_return co_await innerTask + 1; }().WithPriority(TaskPriority::High);
+
+        // Act
+        scheduler.Schedule(outerTask);
+        scheduler.Run();
+
+        // Assert
+        EXPECT_EQ(outerTask.Result(), 43);
+        EXPECT_EQ(outerTask.Priority(), TaskPriority::High);
+        EXPECT_EQ(innerTask.Priority(), TaskPriority::High);
+    }
+
+    TEST(TaskTests, awaitedTaskKeepsHigherPriority)
+    {
+        // Arrange
+        auto scheduler = SynchronousTaskScheduler();
+
+        auto innerTask = []() -> Task<int> { co_return 42; }().WithPriority(TaskPriority::High);
+        auto outerTask = [&]() -> Task<int> { co_return co_await innerTask + 1; }().WithPriority(TaskPriority::Low);
+
+        // Act
+        scheduler.Schedule(outerTask);
+        scheduler.Run();
+
+        // Assert
+        EXPECT_EQ(outerTask.Result(), 43);
+        EXPECT_EQ(innerTask.Priority(), TaskPriority::High);
+    }
+
 }  // namespace TaskSystem::Tests
\ No newline at end of file
@@ -0,0 +1,383 @@
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/TaskCompletionSource.hpp>
+#include <TaskSystem/ThreadPoolTaskScheduler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <thread>
+#include <vector>
+
+
+namespace TaskSystem::Tests
+{
+
+    TEST(ThreadPoolTaskSchedulerTests, runWithLambdas)
+    {
+        // Arrange
+        constexpr auto count = 1000;
+
+        auto executed = std::atomic<int>(0);
+        auto latch = std::latch(count);
+
+        auto scheduler = ThreadPoolTaskScheduler(4u);
+
+        // Act
+        for (auto i = 0; i < count; ++i)
+        {
+            scheduler.Schedule(ScheduleItem([&]() {
+                executed.fetch_add(1);
+                latch.count_down();
+            }));
+        }
+
+        latch.wait();
+
+        // Assert
+        EXPECT_EQ(executed.load(), count);
+    }
+
+    TEST(ThreadPoolTaskSchedulerTests, runNestedSchedulesFromWorkers)
+    {
+        // Arrange
+        constexpr auto outerCount = 16;
+        constexpr auto innerCount = 64;
+
+        auto executed = std::atomic<int>(0);
+        auto latch = std::latch(outerCount * innerCount);
+
+        auto scheduler = ThreadPoolTaskScheduler(4u);
+
+        // Act
+        for (auto i = 0; i < outerCount; ++i)
+        {
+            scheduler.Schedule(ScheduleItem([&]() {
+                for (auto j = 0; j < innerCount; ++j)
+                {
+                    // Note: scheduled from a worker so pushed onto its local deque
+                    scheduler.Schedule(ScheduleItem([&]() {
+                        executed.fetch_add(1);
+                        latch.count_down();
+                    }));
+                }
+            }));
+        }
+
+        latch.wait();
+
+        // Assert
+        EXPECT_EQ(executed.load(), outerCount * innerCount);
+    }
+
+    TEST(ThreadPoolTaskSchedulerTests, scheduleBatchRunsEveryItem)
+    {
+        // Arrange
+        constexpr auto count = 64;
+
+        auto executed = std::atomic<int>(0);
+        auto latch = std::latch(count * 2);
+
+        auto scheduler = ThreadPoolTaskScheduler(4u);
+
+        auto makeBatch = [&]() {
+            auto batch = std::vector<ScheduleItem>();
+            for (auto i = 0; i < count; ++i)
+            {
+                batch.emplace_back([&]() {
+                    executed.fetch_add(1);
+                    latch.count_down();
+                });
+            }
+            return batch;
+        };
+
+        auto outside = makeBatch();
+
+        // Act
+        scheduler.ScheduleBatch(outside);
+
+        // Note: scheduled from a worker so pushed onto its local deque
+        scheduler.Schedule(ScheduleItem([&]() {
+            auto inside = makeBatch();
+            scheduler.ScheduleBatch(inside);
+        }));
+
+        latch.wait();
+
+        // Assert
+        EXPECT_EQ(executed.load(), count * 2);
+    }
+
+    TEST(ThreadPoolTaskSchedulerTests, continuationsScheduledAsBatchAllComplete)
+    {
+        // Arrange
+        constexpr auto count = 200u;
+
+        auto scheduler = ThreadPoolTaskScheduler(4u);
+        auto taskCompletionSource = TaskCompletionSource<int>();
+
+        auto taskFn = [&]() -> Task<int> { co_return co_await taskCompletionSource.Task() + 1; };
+
+        auto tasks = std::vector<Task<int>>();
+        for (auto i = 0u; i < count; ++i)
+        {
+            tasks.emplace_back(taskFn());
+            scheduler.Schedule(tasks.back());
+        }
+
+        // Act
+        taskCompletionSource.SetResult(41);
+
+        // Assert
+        for (auto & task : tasks)
+        {
+            EXPECT_EQ(task.Result(), 42);
+        }
+    }
+
+    TEST(ThreadPoolTaskSchedulerTests, isWorkerThread)
+    {
+        // Arrange
+        auto isWorkerThread = std::atomic<bool>(false);
+        auto currentScheduler = std::atomic<ITaskScheduler *>(nullptr);
+        auto latch = std::latch(1);
+
+        auto scheduler = ThreadPoolTaskScheduler(2u);
+
+        // Act
+        scheduler.Schedule(ScheduleItem([&]() {
+            isWorkerThread = scheduler.IsWorkerThread();
+            currentScheduler = CurrentScheduler();
+            latch.count_down();
+        }));
+
+        latch.wait();
+
+        // Assert
+        EXPECT_FALSE(scheduler.IsWorkerThread());
+        EXPECT_TRUE(isWorkerThread);
+        EXPECT_EQ(currentScheduler.load(), &scheduler);
+    }
+
+    TEST(ThreadPoolTaskSchedulerTests, taskAwaitingTaskCompletes)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(4u);
+
+        auto innerTaskFn = []() -> Task<int> { co_return 42; };
+        auto outerTaskFn = [](auto innerTaskFn) -> Task<int> {
+            auto value = co_await innerTaskFn();
+            co_return value + 1;
+        };
+
+        auto task = outerTaskFn(innerTaskFn);
+
+        // Act
+        scheduler.Schedule(task);
+
+        // Assert
+        EXPECT_EQ(task.Result(), 43);
+        EXPECT_EQ(task.State(), TaskState::Completed);
+    }
+
+    TEST(ThreadPoolTaskSchedulerTests, itemScheduledFromWorkerRunsNext)
+    {
+        // Arrange
+        auto order = std::vector<int>();
+        auto latch = std::latch(3);
+
+        auto scheduler = ThreadPoolTaskScheduler(1u);
+
+        // Act
+        scheduler.Schedule(ScheduleItem([&]() {
+            scheduler.Schedule(ScheduleItem([&]() {
+                order.emplace_back(1);
+                latch.count_down();
+            }));
+            scheduler.Schedule(ScheduleItem([&]() {
+                order.emplace_back(2);
+                latch.count_down();
+            }));
+            order.emplace_back(0);
+            latch.count_down();
+        }));
+
+        latch.wait();
+
+        // Assert
+        EXPECT_EQ(order, (std::vector<int>{ 0, 2, 1 }));
+    }
+
+    TEST(ThreadPoolTaskSchedulerTests, deepAwaitChainCompletes)
+    {
+        // Arrange
+        struct Chain
+        {
+            static Task<int> Run(int depth)
+            {
+                if (depth == 0)
+                {
+                    co_return 0;
+                }
+
+                co_return co_await Run(depth - 1) + 1;
+            }
+        };
+
+        auto scheduler = ThreadPoolTaskScheduler(2u);
+        auto task = Chain::Run(1000);
+
+        // Act
+        scheduler.Schedule(task);
+
+        // Assert
+        EXPECT_EQ(task.Result(), 1000);
+    }
+
+    TEST(ThreadPoolTaskSchedulerTests, idleStrategiesRunEveryItem)
+    {
+        for (auto idleStrategy : { IdleStrategy::PowerSaving(), IdleStrategy::Balanced(), IdleStrategy::LowLatency() })
+        {
+            // Arrange
+            constexpr auto count = 200;
+
+            auto executed = std::atomic<int>(0);
+            auto scheduler = ThreadPoolTaskScheduler(4u, idleStrategy);
+
+            // Act
+            for (auto i = 0; i < count; ++i)
+            {
+                auto latch = std::latch(1);
+                scheduler.Schedule(ScheduleItem([&]() {
+                    executed.fetch_add(1);
+                    latch.count_down();
+                }));
+
+                // Note: waiting for each item makes the workers go idle between them
+                latch.wait();
+            }
+
+            // Assert
+            EXPECT_EQ(executed.load(), count);
+        }
+    }
+
+    TEST(ThreadPoolTaskSchedulerTests, stopDiscardsPendingItems)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(1u);
+
+        // Act
+        scheduler.Stop();
+        scheduler.Schedule(ScheduleItem([&]() { }));
+        scheduler.Stop();
+
+        // Assert
+        EXPECT_EQ(scheduler.WorkerCount(), 1u);
+    }
+
+    TEST(ThreadPoolTaskSchedulerTests, stopFaultsPendingPromises)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(1u);
+        auto taskFn = []() -> Task<int> { co_return 42; };
+        auto task = taskFn();
+
+        // Act
+        scheduler.Stop();
+        scheduler.Schedule(task);
+        scheduler.Stop();
+
+        // Assert
+        EXPECT_EQ(task.State(), TaskState::Error);
+        EXPECT_THROW(task.Result(), SchedulerStopped);
+    }
+
+    TEST(ThreadPoolTaskSchedulerTests, elasticPoolStandsInForBlockedWorker)
+    {
+        // Arrange
+        auto options = ElasticPoolOptions();
+        options.MaxWorkers = 4u;
+        options.BlockedThreshold = std::chrono::milliseconds(50);
+        options.SampleInterval = std::chrono::milliseconds(10);
+        options.RespectCpuQuota = false;
+
+        auto scheduler = ThreadPoolTaskScheduler(1u, IdleStrategy::Balanced(), options);
+
+        auto release = std::latch(1);
+        auto blocking = std::latch(1);
+        auto executed = std::atomic<bool>(false);
+
+        // Act
+        scheduler.Schedule(ScheduleItem([&]() {
+            blocking.count_down();
+            release.wait();
+        }));
+        blocking.wait();
+
+        scheduler.Schedule(ScheduleItem([&]() { executed.store(true); }));
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!executed.load() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        auto workersWhileBlocked = scheduler.WorkerCount();
+        release.count_down();
+
+        deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (scheduler.WorkerCount() > 1u && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        // Assert
+        EXPECT_TRUE(executed.load());
+        EXPECT_EQ(workersWhileBlocked, 2u);
+        EXPECT_EQ(scheduler.WorkerCount(), 1u);
+    }
+
+    TEST(ThreadPoolTaskSchedulerTests, elasticPoolRunsEveryItem)
+    {
+        // Arrange
+        constexpr auto count = 1000;
+
+        auto options = ElasticPoolOptions();
+        options.SampleInterval = std::chrono::milliseconds(1);
+
+        auto executed = std::atomic<int>(0);
+        auto done = std::latch(count);
+        auto scheduler = ThreadPoolTaskScheduler(2u, IdleStrategy::Balanced(), options);
+
+        // Act
+        for (auto i = 0; i < count; ++i)
+        {
+            scheduler.Schedule(ScheduleItem([&]() {
+                executed.fetch_add(1);
+                done.count_down();
+            }));
+        }
+
+        done.wait();
+
+        // Assert
+        EXPECT_EQ(executed.load(), count);
+        EXPECT_GE(scheduler.WorkerCount(), 1u);
+        EXPECT_LE(scheduler.WorkerCount(), options.MaxWorkers);
+    }
+
+    TEST(ThreadPoolTaskSchedulerTests, defaultSchedulerIsThreadPool)
+    {
+        // Act
+        auto * scheduler = DefaultScheduler();
+
+        // Assert
+        ASSERT_NE(scheduler, nullptr);
+        EXPECT_NE(dynamic_cast<ThreadPoolTaskScheduler *>(scheduler), nullptr);
+        EXPECT_EQ(scheduler, DefaultScheduler());
+    }
+
+}  // namespace TaskSystem::Tests
\ No newline at end of file
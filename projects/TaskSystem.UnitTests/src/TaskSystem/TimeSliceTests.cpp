@@ -0,0 +1,164 @@
+#include <TaskSystem/EventLoopTaskScheduler.hpp>
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/ThreadPoolTaskScheduler.hpp>
+#include <TaskSystem/TimeSlice.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <vector>
+
+
+namespace TaskSystem::Tests
+{
+    namespace
+    {
+        using namespace std::chrono_literals;
+
+        // Sets the budget for one test, the budget is shared by every scheduler
+        class BudgetScope final
+        {
+        private:
+            TimeSlice::clock_type::duration previous;
+
+        public:
+            explicit BudgetScope(TimeSlice::clock_type::duration budget) : previous(TimeSlice::Budget())
+            {
+                TimeSlice::Budget(budget);
+            }
+
+            ~BudgetScope() { TimeSlice::Budget(previous); }
+        };
+
+        void Spin(TimeSlice::clock_type::duration duration)
+        {
+            auto end = TimeSlice::clock_type::now() + duration;
+            while (TimeSlice::clock_type::now() < end)
+            {
+            }
+        }
+
+        Task<> Push(std::vector<int> & order, int value)
+        {
+            order.push_back(value);
+            co_return;
+        }
+
+        Task<> AwaitAfterSpinning(std::vector<int> & order)
+        {
+            order.push_back(1);
+            Spin(2ms);
+            co_await Push(order, 2);
+            order.push_back(4);
+        }
+
+    }  // namespace
+
+    TEST(TimeSliceTests, awaitTransfersWhileBudgetIsOff)
+    {
+        // Arrange
+        auto budget = BudgetScope(TimeSlice::clock_type::duration::zero());
+        auto scheduler = EventLoopTaskScheduler();
+        auto order = std::vector<int>();
+        auto preemptions = TimeSlice::Preemptions();
+
+        auto task = AwaitAfterSpinning(order);
+        auto other = Push(order, 3);
+        scheduler.Schedule(task);
+        scheduler.Schedule(other);
+
+        // Act
+        scheduler.RunUntilIdle();
+
+        // Assert
+        EXPECT_EQ(order, (std::vector<int>{ 1, 2, 4, 3 }));
+        EXPECT_EQ(TimeSlice::Preemptions(), preemptions);
+    }
+
+    TEST(TimeSliceTests, exhaustedBudgetRequeuesAwaitedTask)
+    {
+        // Arrange
+        auto budget = BudgetScope(100us);
+        auto scheduler = EventLoopTaskScheduler();
+        auto order = std::vector<int>();
+        auto preemptions = TimeSlice::Preemptions();
+
+        auto task = AwaitAfterSpinning(order);
+        auto other = Push(order, 3);
+        scheduler.Schedule(task);
+        scheduler.Schedule(other);
+
+        // Act
+        scheduler.RunUntilIdle();
+
+        // Assert
+        EXPECT_EQ(order, (std::vector<int>{ 1, 3, 2, 4 }));
+        EXPECT_EQ(task.State(), TaskState::Completed);
+        EXPECT_EQ(TimeSlice::Preemptions(), preemptions + 1u);
+    }
+
+    TEST(TimeSliceTests, awaitTransfersWithinBudget)
+    {
+        // Arrange
+        auto budget = BudgetScope(1s);
+        auto scheduler = EventLoopTaskScheduler();
+        auto order = std::vector<int>();
+        auto preemptions = TimeSlice::Preemptions();
+
+        auto task = AwaitAfterSpinning(order);
+        auto other = Push(order, 3);
+        scheduler.Schedule(task);
+        scheduler.Schedule(other);
+
+        // Act
+        scheduler.RunUntilIdle();
+
+        // Assert
+        EXPECT_EQ(order, (std::vector<int>{ 1, 2, 4, 3 }));
+        EXPECT_EQ(TimeSlice::Preemptions(), preemptions);
+    }
+
+    TEST(TimeSliceTests, longAwaitChainGivesWayOnThreadPool)
+    {
+        // Arrange
+        auto budget = BudgetScope(1ms);
+        auto scheduler = ThreadPoolTaskScheduler(1u);
+        auto started = std::latch(1);
+        auto otherRan = std::atomic<bool>(false);
+        auto preemptions = TimeSlice::Preemptions();
+
+        auto stepFn = []() -> Task<> {
+            Spin(100us);
+            co_return;
+        };
+        auto taskFn = [](auto stepFn, std::latch & started, std::atomic<bool> & otherRan) -> Task<bool> {
+            started.count_down();
+            for (auto i = 0; i < 200 && !otherRan.load(); ++i)
+            {
+                co_await stepFn();
+            }
+
+            co_return otherRan.load();
+        };
+
+        auto otherFn = [](std::atomic<bool> & otherRan) -> Task<> {
+            otherRan.store(true);
+            co_return;
+        };
+
+        auto task = taskFn(stepFn, started, otherRan);
+        auto other = otherFn(otherRan);
+
+        // Act
+        scheduler.Schedule(task);
+        started.wait();
+        scheduler.Schedule(other);
+
+        // Assert
+        EXPECT_TRUE(task.Result());
+        EXPECT_GT(TimeSlice::Preemptions(), preemptions);
+    }
+
+}  // namespace TaskSystem::Tests
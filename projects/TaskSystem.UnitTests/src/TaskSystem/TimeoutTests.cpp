@@ -0,0 +1,126 @@
+#include <TaskSystem/Task.hpp>
+#include <TaskSystem/TaskCompletionSource.hpp>
+#include <TaskSystem/ThreadPoolTaskScheduler.hpp>
+#include <TaskSystem/Timeout.hpp>
+#include <TaskSystem/TimerService.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdexcept>
+
+
+namespace TaskSystem::Tests
+{
+    using namespace std::chrono_literals;
+
+    TEST(TimeoutTests, returnsResultWhenTaskCompletesInTime)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(2u);
+        auto service = TimerService();
+
+        auto innerTaskFn = []() -> Task<int> { co_return 42; };
+        auto outerTaskFn = [](auto innerTaskFn, TimerService & service) -> Task<int> {
+            auto inner = innerTaskFn();
+            co_return co_await Timeout(inner, 10s, service);
+        };
+
+        auto task = outerTaskFn(innerTaskFn, service);
+
+        // Act
+        scheduler.Schedule(task);
+
+        // Assert
+        EXPECT_EQ(task.Result(), 42);
+    }
+
+    TEST(TimeoutTests, returnsResultOfAlreadyCompletedTask)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(1u);
+        auto service = TimerService();
+        auto taskCompletionSource = TaskCompletionSource<int>();
+        auto inner = taskCompletionSource.Task();
+        taskCompletionSource.SetResult(42);
+
+        auto outerTaskFn = [](auto & inner, TimerService & service) -> Task<int> {
+            co_return co_await Timeout(inner, 0s, service);
+        };
+
+        auto task = outerTaskFn(inner, service);
+
+        // Act
+        scheduler.Schedule(task);
+
+        // Assert
+        EXPECT_EQ(task.Result(), 42);
+    }
+
+    TEST(TimeoutTests, throwsWhenTaskDoesNotCompleteInTime)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(2u);
+        auto service = TimerService();
+        auto taskCompletionSource = TaskCompletionSource<int>();
+        auto inner = taskCompletionSource.Task();
+
+        auto outerTaskFn = [](auto & inner, TimerService & service) -> Task<bool> {
+            try
+            {
+                [[maybe_unused]] auto _ = co_await Timeout(inner, 10ms, service);
+            }
+            catch (TimeoutExceeded const &)
+            {
+                co_return true;
+            }
+
+            co_return false;
+        };
+
+        auto task = outerTaskFn(inner, service);
+
+        // Act
+        scheduler.Schedule(task);
+        auto timedOut = task.Result();
+        taskCompletionSource.SetResult(42);
+
+        // Assert
+        EXPECT_TRUE(timedOut);
+        EXPECT_EQ(inner.Result(), 42);
+    }
+
+    TEST(TimeoutTests, faultedTaskRethrows)
+    {
+        // Arrange
+        auto scheduler = ThreadPoolTaskScheduler(2u);
+        auto service = TimerService();
+
+        auto innerTaskFn = []() -> Task<> {
+            throw std::runtime_error("inner");
+            co_return;
+        };
+        auto outerTaskFn = [](auto innerTaskFn, TimerService & service) -> Task<bool> {
+            auto inner = innerTaskFn();
+            try
+            {
+                co_await Timeout(inner, 10s, service);
+            }
+            catch (std::runtime_error const &)
+            {
+                co_return true;
+            }
+
+            co_return false;
+        };
+
+        auto task = outerTaskFn(innerTaskFn, service);
+
+        // Act
+        scheduler.Schedule(task);
+
+        // Assert
+        EXPECT_TRUE(task.Result());
+    }
+
+}  // namespace TaskSystem::Tests
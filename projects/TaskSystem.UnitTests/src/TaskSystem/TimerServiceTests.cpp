@@ -0,0 +1,246 @@
+#include <TaskSystem/Detail/Timer.hpp>
+#include <TaskSystem/ManualClock.hpp>
+#include <TaskSystem/TimerService.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <thread>
+#include <vector>
+
+
+namespace TaskSystem::Tests
+{
+    namespace
+    {
+        using namespace std::chrono_literals;
+
+        class CountingTimer final : public Detail::Timer
+        {
+        public:
+            std::atomic<int> Expired = 0;
+            std::atomic<int> Cancelled = 0;
+            std::latch * Latch = nullptr;
+
+        protected:
+            void OnExpired() noexcept override
+            {
+                Expired.fetch_add(1);
+                if (Latch)
+                {
+                    Latch->count_down();
+                }
+            }
+
+            void OnCancelled() noexcept override { Cancelled.fetch_add(1); }
+        };
+
+        TimerOptions PolledOptions()
+        {
+            auto options = TimerOptions();
+            options.DedicatedThread = false;
+            return options;
+        }
+
+    }  // namespace
+
+    TEST(TimerServiceTests, pollFiresExpiredTimer)
+    {
+        // Arrange
+        auto service = TimerService(PolledOptions());
+        auto timer = CountingTimer();
+
+        // Act
+        service.Arm(timer, DeadlineClock::now() - 1ms);
+        auto fired = service.Poll();
+
+        // Assert
+        EXPECT_EQ(fired, 1u);
+        EXPECT_EQ(timer.Expired.load(), 1);
+        EXPECT_EQ(timer.Cancelled.load(), 0);
+    }
+
+    TEST(TimerServiceTests, pollDoesNotFireTimerEarly)
+    {
+        // Arrange
+        auto service = TimerService(PolledOptions());
+        auto timer = CountingTimer();
+        auto expiry = DeadlineClock::now() + 20ms;
+
+        // Act
+        service.Arm(timer, expiry);
+        auto early = service.Poll();
+
+        while (timer.Expired.load() == 0)
+        {
+            service.Poll();
+            std::this_thread::yield();
+        }
+
+        // Assert
+        EXPECT_EQ(early, 0u);
+        EXPECT_GE(DeadlineClock::now(), expiry);
+    }
+
+    TEST(TimerServiceTests, cancelledTimerDoesNotFire)
+    {
+        // Arrange
+        auto service = TimerService(PolledOptions());
+        auto timer = CountingTimer();
+        service.Arm(timer, DeadlineClock::now() + 1s);
+        service.Poll();
+
+        // Act
+        auto cancelled = service.Cancel(timer);
+        auto fired = service.Poll();
+
+        // Assert
+        EXPECT_TRUE(cancelled);
+        EXPECT_EQ(fired, 0u);
+        EXPECT_EQ(timer.Expired.load(), 0);
+        EXPECT_EQ(timer.Cancelled.load(), 1);
+    }
+
+    TEST(TimerServiceTests, cancelBeforeArmIsReceivedDropsTimer)
+    {
+        // Arrange
+        auto service = TimerService(PolledOptions());
+        auto timer = CountingTimer();
+
+        // Act
+        service.Arm(timer, DeadlineClock::now() - 1ms);
+        auto cancelled = service.Cancel(timer);
+        auto fired = service.Poll();
+
+        // Assert
+        EXPECT_TRUE(cancelled);
+        EXPECT_EQ(fired, 0u);
+        EXPECT_EQ(timer.Expired.load(), 0);
+        EXPECT_EQ(timer.Cancelled.load(), 1);
+    }
+
+    TEST(TimerServiceTests, cancelAfterExpiryReturnsFalse)
+    {
+        // Arrange
+        auto service = TimerService(PolledOptions());
+        auto timer = CountingTimer();
+        service.Arm(timer, DeadlineClock::now() - 1ms);
+        service.Poll();
+
+        // Act
+        auto cancelled = service.Cancel(timer);
+        service.Poll();
+
+        // Assert
+        EXPECT_FALSE(cancelled);
+        EXPECT_EQ(timer.Expired.load(), 1);
+        EXPECT_EQ(timer.Cancelled.load(), 0);
+    }
+
+    TEST(TimerServiceTests, slackDefersExpiryToMultipleOfSlack)
+    {
+        // Arrange
+        auto options = PolledOptions();
+        options.Slack = std::chrono::hours(1);
+
+        auto service = TimerService(options);
+        auto timer1 = CountingTimer();
+        auto timer2 = CountingTimer();
+
+        // Act
+        service.Arm(timer1, DeadlineClock::now() + 1ms);
+        service.Arm(timer2, DeadlineClock::now() + 2ms);
+        std::this_thread::sleep_for(10ms);
+        auto fired = service.Poll();
+
+        [[maybe_unused]] auto _ = service.Cancel(timer1);
+        [[maybe_unused]] auto __ = service.Cancel(timer2);
+        service.Poll();
+
+        // Assert
+        EXPECT_EQ(fired, 0u);
+        EXPECT_EQ(timer1.Cancelled.load(), 1);
+        EXPECT_EQ(timer2.Cancelled.load(), 1);
+    }
+
+    TEST(TimerServiceTests, manualClockFiresTimersWhenAdvanced)
+    {
+        // Arrange
+        auto clock = ManualClock();
+        auto options = PolledOptions();
+        options.Clock = &clock;
+
+        auto service = TimerService(options);
+        auto timer = CountingTimer();
+        auto expiry = clock.Now() + 1h;
+        service.Arm(timer, expiry);
+
+        // Act
+        auto early = service.Poll();
+
+        // Note: NextExpiry is a lower bound, it can stop where timers only cascade down the wheel
+        while (timer.Expired.load() == 0)
+        {
+            clock.AdvanceTo(service.NextExpiry());
+            service.Poll();
+        }
+
+        // Assert
+        EXPECT_EQ(early, 0u);
+        EXPECT_EQ(clock.Now(), expiry);
+        EXPECT_EQ(service.NextExpiry(), NoDeadline);
+    }
+
+    TEST(TimerServiceTests, dedicatedThreadFiresTimers)
+    {
+        // Arrange
+        constexpr auto count = 100;
+
+        auto latch = std::latch(count);
+        auto timers = std::vector<CountingTimer>(count);
+        auto service = TimerService();
+        auto start = DeadlineClock::now();
+
+        // Act
+        for (auto i = 0; i < count; ++i)
+        {
+            timers[i].Latch = &latch;
+            service.Arm(timers[i], start + std::chrono::milliseconds(i % 10));
+        }
+
+        latch.wait();
+
+        // Assert
+        for (auto & timer : timers)
+        {
+            EXPECT_EQ(timer.Expired.load(), 1);
+        }
+    }
+
+    TEST(TimerServiceTests, armWakesDedicatedThreadForEarlierExpiry)
+    {
+        // Arrange
+        auto late = CountingTimer();
+        auto early = CountingTimer();
+        auto latch = std::latch(1);
+        early.Latch = &latch;
+
+        // Note: declared after the timers so its thread is stopped before they are destroyed
+        auto service = TimerService();
+
+        service.Arm(late, DeadlineClock::now() + 10s);
+        std::this_thread::sleep_for(5ms);
+
+        // Act
+        auto start = DeadlineClock::now();
+        service.Arm(early, start + 1ms);
+        latch.wait();
+
+        // Assert
+        EXPECT_LT(DeadlineClock::now() - start, 5s);
+        EXPECT_EQ(late.Expired.load(), 0);
+    }
+
+}  // namespace TaskSystem::Tests
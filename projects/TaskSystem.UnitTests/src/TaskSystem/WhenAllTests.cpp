@@ -1,13 +1,31 @@
 #include <TaskSystem/SynchronousTaskScheduler.hpp>
 #include <TaskSystem/Task.hpp>
 #include <TaskSystem/TaskCompletionSource.hpp>
+#include <TaskSystem/ThreadPoolTaskScheduler.hpp>
 #include <TaskSystem/WhenAll.hpp>
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 
 namespace TaskSystem::Tests
 {
+    namespace
+    {
+        // Children run on the default scheduler, keeps running the caller's scheduler until the outer task has set
+        // completed. There is no deadline, a continuation that never arrives hangs the test rather than a slow machine
+        // failing it
+        void RunUntilCompleted(SynchronousTaskScheduler & scheduler, std::atomic<bool> const & completed)
+        {
+            while (!completed.load(std::memory_order_acquire))
+            {
+                scheduler.Run();
+                std::this_thread::yield();
+            }
+        }
+    }  // namespace
 
     TEST(WhenAllTests, callerResumesWhenInnerTaskCompletes)
     {
@@ -75,15 +93,17 @@ namespace TaskSystem::Tests
             co_return;
         };
 
-        auto outerTask = [&]() -> Task<> {
+        auto completed = std::atomic<bool>(false);
+        auto outerTask = [](auto innerTaskFn, std::atomic<bool> & completed) -> Task<> {
             co_await WhenAll(innerTaskFn());
-        }();
+            completed.store(true, std::memory_order_release);
+        }(innerTaskFn, completed);
 
         auto scheduler = SynchronousTaskScheduler();
 
         // Act
         scheduler.Schedule(outerTask);
-        scheduler.Run();
+        RunUntilCompleted(scheduler, completed);
 
         // Assert
         EXPECT_EQ(outerTask.State(), TaskState::Completed);
@@ -169,4 +189,36 @@ namespace TaskSystem::Tests
         EXPECT_EQ(task.State(), TaskState::Completed);
     }
 
+    TEST(WhenAllTests, childrenRunOnDefaultSchedulerWhenAwaitedFromSynchronousScheduler)
+    {
+        // Arrange
+        auto * pool = dynamic_cast<ThreadPoolTaskScheduler *>(DefaultScheduler());
+        ASSERT_NE(pool, nullptr);
+
+        auto child = [](ThreadPoolTaskScheduler & pool) -> Task<bool> {
+            co_return pool.IsWorkerThread();
+        };
+
+        auto innerTask1 = child(*pool);
+        auto innerTask2 = child(*pool);
+
+        auto completed = std::atomic<bool>(false);
+        auto outerTask = [](Task<bool> & innerTask1, Task<bool> & innerTask2, std::atomic<bool> & completed) -> Task<> {
+            co_await WhenAll(innerTask1, innerTask2);
+            completed.store(true, std::memory_order_release);
+        }(innerTask1, innerTask2, completed);
+
+        auto scheduler = SynchronousTaskScheduler();
+
+        // Act
+        scheduler.Schedule(outerTask);
+
+        RunUntilCompleted(scheduler, completed);
+
+        // Assert
+        EXPECT_EQ(outerTask.State(), TaskState::Completed);
+        EXPECT_TRUE(innerTask1.Result());
+        EXPECT_TRUE(innerTask2.Result());
+    }
+
 }
\ No newline at end of file
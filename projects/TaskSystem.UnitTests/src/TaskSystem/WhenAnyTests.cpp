@@ -5,9 +5,26 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 
 namespace TaskSystem::Tests
 {
+    namespace
+    {
+        // Children run on the default scheduler, keeps running the caller's scheduler until the outer task has set
+        // completed. There is no deadline, a continuation that never arrives hangs the test rather than a slow machine
+        // failing it
+        void RunUntilCompleted(SynchronousTaskScheduler & scheduler, std::atomic<bool> const & completed)
+        {
+            while (!completed.load(std::memory_order_acquire))
+            {
+                scheduler.Run();
+                std::this_thread::yield();
+            }
+        }
+    }  // namespace
 
     TEST(WhenAnyTests, callerResultesWhenInnerTaskCompletes)
     {
@@ -77,15 +94,17 @@ namespace TaskSystem::Tests
             co_return;
         };
 
-        auto outerTask = [&]() -> Task<> {
+        auto completed = std::atomic<bool>(false);
+        auto outerTask = [](auto innerTaskFn, std::atomic<bool> & completed) -> Task<> {
             co_await WhenAny(innerTaskFn());
-        }();
+            completed.store(true, std::memory_order_release);
+        }(innerTaskFn, completed);
 
         auto scheduler = SynchronousTaskScheduler();
 
         // Act
         scheduler.Schedule(outerTask);
-        scheduler.Run();
+        RunUntilCompleted(scheduler, completed);
 
         // Assert
         EXPECT_EQ(outerTask.State(), TaskState::Completed);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <TaskSystem/Detail/SpinWait.hpp>
+
 #include <atomic>
 #include <mutex>
 
@@ -18,9 +20,14 @@ namespace std
 
         explicit lock_guard(std::atomic_flag & flag) noexcept : flag(flag)
         {
-            // construct and lock
+            // construct and lock, spins on a plain load with backoff so waiters do not keep stealing the cache line
             while (flag.test_and_set(std::memory_order_acquire))
             {
+                auto spin = TaskSystem::Detail::SpinWait();
+                while (flag.test(std::memory_order_relaxed))
+                {
+                    spin.SpinOnce();
+                }
             }
         }
 
@@ -43,9 +50,14 @@ namespace std
 
         explicit lock_guard(std::atomic<bool> & flag) noexcept : flag(flag)
         {
-            // construct and lock
+            // construct and lock, spins on a plain load with backoff so waiters do not keep stealing the cache line
             while (flag.exchange(true, std::memory_order_acquire) != false)
             {
+                auto spin = TaskSystem::Detail::SpinWait();
+                while (flag.load(std::memory_order_relaxed))
+                {
+                    spin.SpinOnce();
+                }
             }
         }
 
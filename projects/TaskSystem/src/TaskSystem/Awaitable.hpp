@@ -2,8 +2,13 @@
 
 #include <TaskSystem/Detail/IPromise.hpp>
 
+#include <concepts>
 #include <coroutine>
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <type_traits>
+#include <utility>
 
 
 namespace TaskSystem
@@ -70,10 +75,45 @@ namespace TaskSystem
         constexpr inline bool AwaitSuspendReturnsVoid = AwaitSuspendResult<T, void>();
 
 
+        // Awaitables up to this size are stored inline, enough for the task, task completion source and value task
+        // awaitables
+        inline constexpr std::size_t AwaitableInlineSize = 6u * sizeof(void *);
+        inline constexpr std::size_t AwaitableInlineAlignment = alignof(std::max_align_t);
+
+        template <typename TImpl>
+        constexpr inline bool AwaitableFitsInline = sizeof(TImpl) <= AwaitableInlineSize
+                                                 && alignof(TImpl) <= AwaitableInlineAlignment
+                                                 && std::is_nothrow_move_constructible_v<TImpl>;
+
         template <typename TImpl>
         void AwaitableDestructorAdapter(void * ptr)
         {
-            delete static_cast<TImpl *>(ptr);
+            if constexpr (AwaitableFitsInline<TImpl>)
+            {
+                std::destroy_at(static_cast<TImpl *>(ptr));
+            }
+            else
+            {
+                delete static_cast<TImpl *>(ptr);
+            }
+        }
+
+        // Moves the awaitable out of ptr and returns where it now lives, inline awaitables are moved into storage
+        // and heap awaitables keep their allocation
+        template <typename TImpl>
+        void * AwaitableRelocateAdapter(void * ptr, void * storage) noexcept
+        {
+            if constexpr (AwaitableFitsInline<TImpl>)
+            {
+                auto * impl = static_cast<TImpl *>(ptr);
+                auto * moved = ::new (storage) TImpl(std::move(*impl));
+                std::destroy_at(impl);
+                return moved;
+            }
+            else
+            {
+                return ptr;
+            }
         }
 
         template <typename TImpl>
@@ -136,11 +176,13 @@ namespace TaskSystem
         struct AwaitableVTable
         {
             using destructor_m = void (*)(void *);
+            using relocate_m = void * (*)(void *, void *) noexcept;
             using await_ready_m = bool (*)(void *);
             using await_suspend_m = std::coroutine_handle<> (*)(void *, std::coroutine_handle<>, IPromise &);
             using await_resume_m = TResult (*)(void *);
 
             destructor_m destructor;
+            relocate_m relocate;
             await_ready_m await_ready;
             await_suspend_m await_suspend;
             await_resume_m await_resume;
@@ -150,6 +192,7 @@ namespace TaskSystem
         // Maybe: might want a concept for TImpl
         template <typename TImpl, typename TResult>
         constexpr AwaitableVTable<TResult> AwaitableFor{ &AwaitableDestructorAdapter<TImpl>,
+                                                         &AwaitableRelocateAdapter<TImpl>,
                                                          &AwaitReadyAdapter<TImpl>,
                                                          &AwaitSuspendAdapter<TImpl>,
                                                          &AwaitResumeAdapter<TImpl, TResult> };
@@ -161,25 +204,73 @@ namespace TaskSystem
     /// </summary>
     /// <remarks>
     /// Allows ITask implementations to be awaitable when cast to ITask using a virtual call to get the
-    /// implementation's awaitable type
+    /// implementation's awaitable type. Implementations small enough are stored inline so awaiting through ITask does
+    /// not allocate, larger ones fall back to the heap
     /// </remarks>
     /// <typeparam name="TResult">Type returned from the awaitable</typeparam>
     template <typename TResult>
     class Awaitable
     {
     private:
+        alignas(Detail::AwaitableInlineAlignment) std::byte storage[Detail::AwaitableInlineSize];
+
+        // Points into storage or to the heap, null once moved from
         void * value;
         Detail::AwaitableVTable<TResult> const * vtable;
 
     public:
         template <typename TImpl>
-        Awaitable(TImpl const & impl)
+            requires(!std::same_as<std::remove_cvref_t<TImpl>, Awaitable>)
+        Awaitable(TImpl && impl) : vtable(&Detail::AwaitableFor<std::remove_cvref_t<TImpl>, TResult>)
         {
-            value = new TImpl(impl);
-            vtable = &Detail::AwaitableFor<TImpl, TResult>;
+            using impl_type = std::remove_cvref_t<TImpl>;
+
+            if constexpr (Detail::AwaitableFitsInline<impl_type>)
+            {
+                value = ::new (static_cast<void *>(storage)) impl_type(std::forward<TImpl>(impl));
+            }
+            else
+            {
+                value = new impl_type(std::forward<TImpl>(impl));
+            }
+        }
+
+        Awaitable(Awaitable const &) = delete;
+        Awaitable & operator=(Awaitable const &) = delete;
+
+        Awaitable(Awaitable && other) noexcept : vtable(other.vtable)
+        {
+            value = other.value ? vtable->relocate(std::exchange(other.value, nullptr), storage) : nullptr;
+        }
+
+        Awaitable & operator=(Awaitable && other) noexcept
+        {
+            if (std::addressof(other) == this)
+            {
+                return *this;
+            }
+
+            if (value)
+            {
+                vtable->destructor(value);
+            }
+
+            vtable = other.vtable;
+            value = other.value ? vtable->relocate(std::exchange(other.value, nullptr), storage) : nullptr;
+
+            return *this;
+        }
+
+        ~Awaitable()
+        {
+            if (value)
+            {
+                vtable->destructor(value);
+            }
         }
 
-        ~Awaitable() { vtable->destructor(value); }
+        // True when the implementation is stored in the inline buffer rather than on the heap
+        [[nodiscard]] bool IsInline() const noexcept { return value == static_cast<void const *>(storage); }
 
         bool await_ready() { return vtable->await_ready(value); }
 
@@ -0,0 +1,250 @@
+#include <TaskSystem/BlockingTaskScheduler.hpp>
+
+#include <cassert>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+
+namespace TaskSystem
+{
+
+    void SetCurrentScheduler(ITaskScheduler * scheduler);
+
+    namespace
+    {
+
+        void FaultStopped(Detail::IPromise & promise) noexcept
+        {
+            // Note: the promise is Scheduled and can only fault once it has been claimed to run
+            if (promise.TrySetRunning())
+            {
+                [[maybe_unused]] auto _ = promise.TrySetException(std::make_exception_ptr(SchedulerStopped()));
+            }
+        }
+
+    }  // namespace
+
+    thread_local BlockingTaskScheduler * BlockingTaskScheduler::currentPool = nullptr;
+
+    BlockingTaskScheduler::BlockingTaskScheduler(BlockingPoolOptions const & options)
+      : options(options), mutex(), available(), exited(), queue(), threadCount(0u), idleCount(0u), stopping(false)
+    {
+        assert(this->options.MaxThreads > 0u && this->options.MinThreads <= this->options.MaxThreads);
+    }
+
+    BlockingTaskScheduler::~BlockingTaskScheduler() noexcept { Stop(); }
+
+    bool BlockingTaskScheduler::IsWorkerThread() const noexcept { return currentPool == this; }
+
+    void BlockingTaskScheduler::Schedule(ScheduleItem && item)
+    {
+        auto lock = std::unique_lock(mutex);
+        if (stopping)
+        {
+            // Note: faulting publishes the promise, its continuations may be scheduled back onto this pool
+            lock.unlock();
+            Reject(std::move(item));
+            return;
+        }
+
+        queue.push_back(Entry{ std::move(item) });
+        Dispatch(lock);
+    }
+
+    void BlockingTaskScheduler::ScheduleBatch(std::span<ScheduleItem> items)
+    {
+        auto lock = std::unique_lock(mutex);
+        if (stopping)
+        {
+            lock.unlock();
+            for (auto & item : items)
+            {
+                Reject(std::move(item));
+            }
+            return;
+        }
+
+        for (auto & item : items)
+        {
+            queue.push_back(Entry{ std::move(item) });
+            Dispatch(lock);
+        }
+    }
+
+    void BlockingTaskScheduler::ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && promises)
+    {
+        auto lock = std::unique_lock(mutex);
+        if (stopping)
+        {
+            lock.unlock();
+            while (auto * promise = promises.PopFront())
+            {
+                FaultStopped(*promise);
+            }
+            return;
+        }
+
+        while (auto * promise = promises.PopFront())
+        {
+            queue.push_back(Entry{ ScheduleItem(promise) });
+            Dispatch(lock);
+        }
+    }
+
+    void BlockingTaskScheduler::ScheduleCall(CallFunction call, RejectFunction reject, void * context)
+    {
+        auto lock = std::unique_lock(mutex);
+        if (stopping)
+        {
+            lock.unlock();
+            reject(context);
+            return;
+        }
+
+        queue.push_back(Entry{ ScheduleItem(call, context), reject, context });
+        Dispatch(lock);
+    }
+
+    size_t BlockingTaskScheduler::ThreadCount() const noexcept
+    {
+        auto lock = std::lock_guard(mutex);
+        return threadCount;
+    }
+
+    void BlockingTaskScheduler::Stop() noexcept
+    {
+        assert(!IsWorkerThread() && "A blocking pool cannot be stopped from one of its threads");
+
+        auto lock = std::unique_lock(mutex);
+        stopping = true;
+        auto discarded = std::exchange(queue, std::deque<Entry>());
+
+        available.notify_all();
+        exited.wait(lock, [this]() { return threadCount == 0u; });
+        lock.unlock();
+
+        for (auto & entry : discarded)
+        {
+            Discard(entry);
+        }
+    }
+
+    void BlockingTaskScheduler::Reject(ScheduleItem && item)
+    {
+        auto * promise = item.Promise();
+        if (!promise)
+        {
+            throw SchedulerStopped();
+        }
+
+        FaultStopped(*promise);
+    }
+
+    void BlockingTaskScheduler::Discard(Entry & entry) noexcept
+    {
+        if (auto * promise = entry.Item.Promise())
+        {
+            FaultStopped(*promise);
+        }
+        else if (entry.Reject)
+        {
+            entry.Reject(entry.Context);
+        }
+    }
+
+    void BlockingTaskScheduler::Dispatch(std::unique_lock<std::mutex> & lock)
+    {
+        // Note: each idle thread takes one item, start a thread only for items no idle thread will take
+        if (queue.size() <= idleCount)
+        {
+            available.notify_one();
+            return;
+        }
+
+        if (threadCount >= options.MaxThreads)
+        {
+            return;
+        }
+
+        try
+        {
+            // Note: threads are detached, Stop waits for the count to reach zero instead of joining
+            std::thread([this]() { WorkerLoop(); }).detach();
+            ++threadCount;
+        }
+        catch (std::system_error const &)
+        {
+            // Note: a running thread gets to the item in turn, with none it would never run so it is taken back out
+            if (threadCount != 0u)
+            {
+                return;
+            }
+
+            auto entry = std::move(queue.back());
+            queue.pop_back();
+
+            if (!entry.Item.Promise() && !entry.Reject)
+            {
+                throw;
+            }
+
+            // Note: faulting publishes the promise, its continuations may be scheduled back onto this pool
+            lock.unlock();
+            Discard(entry);
+            lock.lock();
+        }
+    }
+
+    void BlockingTaskScheduler::WorkerLoop() noexcept
+    {
+        currentPool = this;
+        SetCurrentScheduler(this);
+
+        auto lock = std::unique_lock(mutex);
+        while (true)
+        {
+            auto hasWork = [this]() { return stopping || !queue.empty(); };
+
+            ++idleCount;
+            if (threadCount > options.MinThreads)
+            {
+                available.wait_for(lock, options.IdleTimeout, hasWork);
+            }
+            else
+            {
+                available.wait(lock, hasWork);
+            }
+            --idleCount;
+
+            if (stopping || (queue.empty() && threadCount > options.MinThreads))
+            {
+                break;
+            }
+
+            if (queue.empty())
+            {
+                continue;
+            }
+
+            auto item = std::move(queue.front().Item);
+            queue.pop_front();
+
+            lock.unlock();
+            item.Execute();
+            lock.lock();
+        }
+
+        --threadCount;
+        exited.notify_all();
+    }
+
+    BlockingTaskScheduler & DefaultBlockingScheduler()
+    {
+        // Note: threads are only started once work arrives
+        static BlockingTaskScheduler scheduler;
+        return scheduler;
+    }
+
+}  // namespace TaskSystem
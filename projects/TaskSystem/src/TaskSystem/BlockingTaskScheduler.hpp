@@ -0,0 +1,132 @@
+#pragma once
+
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <span>
+
+
+namespace TaskSystem
+{
+
+    struct BlockingPoolOptions final
+    {
+        // Threads kept alive while idle
+        size_t MinThreads = 0u;
+
+        // Items queue once this many threads are busy
+        size_t MaxThreads = 64u;
+
+        // How long a thread above MinThreads waits for work before it exits
+        std::chrono::milliseconds IdleTimeout = std::chrono::seconds(10);
+    };
+
+    /// <summary>
+    /// Elastic pool for calls that block, sized separately from the compute schedulers
+    /// </summary>
+    /// <remarks>
+    /// A thread is started whenever an item arrives and no thread is idle, up to MaxThreads, and exits after idling
+    /// for IdleTimeout while more than MinThreads are running. Blocking work is slow by nature, so the queue is a
+    /// plain locked deque rather than anything lock-free.
+    ///
+    /// Once stopped the pool takes no more work: promises are faulted with SchedulerStopped, other items are refused
+    /// by throwing it
+    /// </remarks>
+    class BlockingTaskScheduler final : public ITaskScheduler
+    {
+    public:
+        using CallFunction = void (*)(void * context);
+        using RejectFunction = void (*)(void * context) noexcept;
+
+    private:
+        // Note: reject is only set for calls queued through ScheduleCall, other items are plain schedule items
+        struct Entry final
+        {
+            ScheduleItem Item;
+            RejectFunction Reject = nullptr;
+            void * Context = nullptr;
+        };
+
+        static thread_local BlockingTaskScheduler * currentPool;
+
+        BlockingPoolOptions options;
+
+        mutable std::mutex mutex;
+        std::condition_variable available;
+        std::condition_variable exited;
+
+        std::deque<Entry> queue;
+        size_t threadCount;
+        size_t idleCount;
+        bool stopping;
+
+    public:
+        explicit BlockingTaskScheduler(BlockingPoolOptions const & options = BlockingPoolOptions());
+
+        BlockingTaskScheduler(BlockingTaskScheduler const &) = delete;
+        BlockingTaskScheduler & operator=(BlockingTaskScheduler const &) = delete;
+
+        BlockingTaskScheduler(BlockingTaskScheduler &&) = delete;
+        BlockingTaskScheduler & operator=(BlockingTaskScheduler &&) = delete;
+
+        ~BlockingTaskScheduler() noexcept override;
+
+        bool IsWorkerThread() const noexcept override;
+
+        // Throws SchedulerStopped for an item other than a promise once the pool has been stopped, or std::system_error
+        // when no thread is running and none can be started
+        void Schedule(ScheduleItem && item) override;
+
+        // Throws as Schedule, the items before the one refused have been queued or faulted
+        void ScheduleBatch(std::span<ScheduleItem> items) override;
+
+        void ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && promises) override;
+
+        /// <summary>
+        /// Queues call(context) as Schedule would, but a call the pool will never run is passed to reject instead
+        /// </summary>
+        /// <remarks>
+        /// reject(context) is called rather than throwing SchedulerStopped once the pool has been stopped, and for a
+        /// call still queued when Stop discards it, so whoever waits on the call can be failed rather than left waiting
+        /// </remarks>
+        void ScheduleCall(CallFunction call, RejectFunction reject, void * context);
+
+        // Threads currently running, busy or idle
+        [[nodiscard]] size_t ThreadCount() const noexcept;
+
+        /// <summary>
+        /// Waits for running items and their threads to finish, items that have not started are discarded
+        /// </summary>
+        /// <remarks>
+        /// Promises still queued are faulted with SchedulerStopped and calls queued by ScheduleCall are rejected. Must
+        /// not be called from one of the pool's threads
+        /// </remarks>
+        void Stop() noexcept;
+
+    private:
+        // Faults a promise, or throws SchedulerStopped for any other item
+        static void Reject(ScheduleItem && item);
+
+        // Faults a promise with SchedulerStopped or rejects a call, other items are dropped
+        static void Discard(Entry & entry) noexcept;
+
+        // Takes an idle thread or starts a new one for the item just queued, called with the lock held. When no
+        // thread is running and none can be started the item is taken back out and discarded, or the error rethrown
+        // for an item that cannot be faulted
+        void Dispatch(std::unique_lock<std::mutex> & lock);
+
+        void WorkerLoop() noexcept;
+    };
+
+    /// <summary>
+    /// Pool used by RunBlocking when none is given, started on first use
+    /// </summary>
+    [[nodiscard]] BlockingTaskScheduler & DefaultBlockingScheduler();
+
+}  // namespace TaskSystem
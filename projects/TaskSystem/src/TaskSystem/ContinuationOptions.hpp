@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+
+namespace TaskSystem
+{
+
+    /// <summary>
+    /// How a completed promise resumes the tasks awaiting it
+    /// </summary>
+    enum class ContinuationOptions : std::uint8_t
+    {
+        // Continuations are posted to their scheduler
+        None,
+
+        // Continuations bound for the completing thread's current scheduler are resumed inline by the completing
+        // thread, e.g. a socket reader completing responses on the event loop that owns the awaiters. Once
+        // Detail::SynchronousContinuationDepthLimit resumptions are nested on a thread further continuations are
+        // scheduled as usual
+        ExecuteSynchronously,
+    };
+
+}  // namespace TaskSystem
\ No newline at end of file
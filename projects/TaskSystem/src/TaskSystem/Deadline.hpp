@@ -0,0 +1,24 @@
+#pragma once
+
+#include <chrono>
+#include <exception>
+
+
+namespace TaskSystem
+{
+
+    using DeadlineClock = std::chrono::steady_clock;
+
+    // Deadline of a task that never expires
+    inline constexpr DeadlineClock::time_point NoDeadline = DeadlineClock::time_point::max();
+
+    /// <summary>
+    /// Fault of a task that was dropped by its scheduler because its deadline passed before it started
+    /// </summary>
+    class DeadlineExceeded final : public std::exception
+    {
+    public:
+        [[nodiscard]] char const * what() const noexcept override { return "Deadline exceeded"; }
+    };
+
+}  // namespace TaskSystem
\ No newline at end of file
@@ -0,0 +1,233 @@
+#include <TaskSystem/DeadlineTaskScheduler.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+
+namespace TaskSystem
+{
+
+    void SetCurrentScheduler(ITaskScheduler * scheduler);
+
+    thread_local DeadlineTaskScheduler * DeadlineTaskScheduler::workerOf = nullptr;
+
+    DeadlineTaskScheduler::DeadlineTaskScheduler(size_t workerCount, IdleStrategy idleStrategy)
+      : workers()
+      , heapMutex()
+      , heap()
+      , nextSequence(0u)
+      , queued(0u)
+      , expired(0u)
+      , idleEvent()
+      , idleStrategy(idleStrategy)
+      , stopping(false)
+    {
+        workerCount = std::max<size_t>(workerCount, 1u);
+
+        workers.reserve(workerCount);
+        for (auto i = 0u; i < workerCount; ++i)
+        {
+            workers.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    DeadlineTaskScheduler::~DeadlineTaskScheduler() noexcept { Stop(); }
+
+    bool DeadlineTaskScheduler::IsWorkerThread() const noexcept { return workerOf == this; }
+
+    void DeadlineTaskScheduler::Schedule(ScheduleItem && item)
+    {
+        auto deadline = DeadlineOf(item);
+        Schedule(std::move(item), deadline);
+    }
+
+    void DeadlineTaskScheduler::Schedule(ScheduleItem && item, DeadlineClock::time_point deadline)
+    {
+        auto ready = ReadyItem::Box(std::move(item));
+
+        {
+            std::lock_guard lock(heapMutex);
+            Push(deadline, ready);
+        }
+
+        WakeOne();
+    }
+
+    void DeadlineTaskScheduler::ScheduleBatch(std::span<ScheduleItem> items)
+    {
+        if (items.empty())
+        {
+            return;
+        }
+
+        {
+            std::lock_guard lock(heapMutex);
+            for (auto & item : items)
+            {
+                auto deadline = DeadlineOf(item);
+                Push(deadline, ReadyItem::Box(std::move(item)));
+            }
+        }
+
+        WakeOne();
+    }
+
+    void DeadlineTaskScheduler::ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && promises)
+    {
+        if (promises.Empty())
+        {
+            return;
+        }
+
+        {
+            std::lock_guard lock(heapMutex);
+            while (auto * promise = promises.PopFront())
+            {
+                Push(promise->Deadline(), ReadyItem(promise));
+            }
+        }
+
+        WakeOne();
+    }
+
+    void DeadlineTaskScheduler::Stop() noexcept
+    {
+        // Note: only the first call stops the workers, a later one faults whatever was scheduled since
+        if (!stopping.exchange(true, std::memory_order_acq_rel))
+        {
+            idleEvent.NotifyAll();
+
+            for (auto & worker : workers)
+            {
+                if (worker.joinable())
+                {
+                    worker.join();
+                }
+            }
+        }
+
+        // Note: entries are popped one at a time so none is faulted under the heap lock, faulting a promise can
+        // schedule its continuations back onto this scheduler
+        while (auto entry = Pop())
+        {
+            entry->Item.Reject();
+        }
+    }
+
+    void DeadlineTaskScheduler::WorkerLoop()
+    {
+        workerOf = this;
+        SetCurrentScheduler(this);
+
+        while (!stopping.load(std::memory_order_acquire))
+        {
+            auto entry = Pop();
+            if (!entry)
+            {
+                Sleep();
+                continue;
+            }
+
+            Run(*entry);
+        }
+
+        SetCurrentScheduler(nullptr);
+        workerOf = nullptr;
+    }
+
+    DeadlineClock::time_point DeadlineTaskScheduler::DeadlineOf(ScheduleItem const & item) noexcept
+    {
+        auto * promise = item.Promise();
+        return promise ? promise->Deadline() : NoDeadline;
+    }
+
+    void DeadlineTaskScheduler::Push(DeadlineClock::time_point deadline, ReadyItem item)
+    {
+        heap.push_back(Entry{ deadline, nextSequence++, item });
+        std::push_heap(heap.begin(), heap.end());
+
+        queued.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    std::optional<DeadlineTaskScheduler::Entry> DeadlineTaskScheduler::Pop() noexcept
+    {
+        if (queued.load(std::memory_order_relaxed) == 0u)
+        {
+            return std::nullopt;
+        }
+
+        auto more = false;
+        auto entry = std::optional<Entry>();
+
+        {
+            std::lock_guard lock(heapMutex);
+            if (heap.empty())
+            {
+                return std::nullopt;
+            }
+
+            std::pop_heap(heap.begin(), heap.end());
+            entry = heap.back();
+            heap.pop_back();
+
+            more = queued.fetch_sub(1u, std::memory_order_relaxed) > 1u;
+        }
+
+        // Note: one wakeup per batch, each worker that takes an entry wakes the next while entries remain
+        if (more)
+        {
+            WakeOne();
+        }
+
+        return entry;
+    }
+
+    void DeadlineTaskScheduler::Run(Entry const & entry) noexcept
+    {
+        // Note: the clock is only read for items that have a deadline
+        if (entry.Deadline != NoDeadline && entry.Deadline < DeadlineClock::now())
+        {
+            Expire(entry.Item);
+            return;
+        }
+
+        entry.Item.Run();
+    }
+
+    void DeadlineTaskScheduler::Expire(ReadyItem item) noexcept
+    {
+        expired.fetch_add(1u, std::memory_order_relaxed);
+
+        auto * promise = item.Promise();
+        if (!promise)
+        {
+            item.Discard();
+            return;
+        }
+
+        // The promise is Scheduled and can only fault once it has been claimed to run, the coroutine itself is never
+        // resumed and its frame is destroyed with the task as usual
+        if (promise->TrySetRunning())
+        {
+            [[maybe_unused]] auto _ = promise->TrySetException(std::make_exception_ptr(DeadlineExceeded()));
+        }
+    }
+
+    void DeadlineTaskScheduler::WakeOne() noexcept { idleEvent.NotifyOne(); }
+
+    void DeadlineTaskScheduler::Sleep() noexcept
+    {
+        auto key = idleEvent.PrepareWait();
+
+        // Note: an entry pushed after PrepareWait cancels the wait through its notify, earlier ones are counted
+        if (queued.load(std::memory_order_relaxed) != 0u || stopping.load(std::memory_order_acquire))
+        {
+            idleEvent.CancelWait();
+            return;
+        }
+
+        idleEvent.Wait(key, idleStrategy.SpinCount, idleStrategy.YieldCount);
+    }
+
+}  // namespace TaskSystem
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <TaskSystem/Deadline.hpp>
+#include <TaskSystem/Detail/CpuQuota.hpp>
+#include <TaskSystem/Detail/EventCount.hpp>
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/Detail/ReadyItem.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+#include <TaskSystem/IdleStrategy.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+
+namespace TaskSystem
+{
+
+    /// <summary>
+    /// Multi-threaded earliest deadline first scheduler that drops work whose deadline has passed
+    /// </summary>
+    /// <remarks>
+    /// Items wait in a heap ordered by deadline, items with the same deadline run in the order they were scheduled and
+    /// items without one run after every item that has one. A promise still waiting when its deadline passes is faulted
+    /// with DeadlineExceeded, so its awaiters see the exception, and other items are discarded; under overload stale
+    /// work is shed rather than run late
+    /// </remarks>
+    class DeadlineTaskScheduler final : public ITaskScheduler
+    {
+    private:
+        using ReadyItem = Detail::ReadyItem;
+
+        struct Entry final
+        {
+            DeadlineClock::time_point Deadline;
+            std::uint64_t Sequence;
+            ReadyItem Item;
+
+            // Note: std heap algorithms build a max heap, so the earliest entry compares greatest
+            [[nodiscard]] friend bool operator<(Entry const & lhs, Entry const & rhs) noexcept
+            {
+                return lhs.Deadline != rhs.Deadline ? lhs.Deadline > rhs.Deadline : lhs.Sequence > rhs.Sequence;
+            }
+        };
+
+        static thread_local DeadlineTaskScheduler * workerOf;
+
+        std::vector<std::thread> workers;
+
+        std::mutex heapMutex;
+        std::vector<Entry> heap;
+        std::uint64_t nextSequence;
+
+        // Note: read without the lock by idle workers deciding whether to sleep
+        std::atomic<size_t> queued;
+        std::atomic<size_t> expired;
+
+        Detail::EventCount idleEvent;
+        IdleStrategy idleStrategy;
+
+        std::atomic<bool> stopping;
+
+    public:
+        explicit DeadlineTaskScheduler(size_t workerCount = Detail::AvailableParallelism(),
+                                       IdleStrategy idleStrategy = IdleStrategy::Balanced());
+
+        DeadlineTaskScheduler(DeadlineTaskScheduler const &) = delete;
+        DeadlineTaskScheduler & operator=(DeadlineTaskScheduler const &) = delete;
+
+        DeadlineTaskScheduler(DeadlineTaskScheduler &&) = delete;
+        DeadlineTaskScheduler & operator=(DeadlineTaskScheduler &&) = delete;
+
+        ~DeadlineTaskScheduler() noexcept override;
+
+        [[nodiscard]] size_t WorkerCount() const noexcept { return workers.size(); }
+
+        // Items dropped because their deadline passed before they started
+        [[nodiscard]] size_t ExpiredCount() const noexcept { return expired.load(std::memory_order_relaxed); }
+
+        bool IsWorkerThread() const noexcept override;
+
+        void Schedule(ScheduleItem && item) override;
+
+        /// <summary>
+        /// Schedules the item to start before deadline, regardless of the deadline of its promise
+        /// </summary>
+        void Schedule(ScheduleItem && item, DeadlineClock::time_point deadline);
+
+        void ScheduleBatch(std::span<ScheduleItem> items) override;
+
+        void ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && promises) override;
+
+        /// <summary>
+        /// Wakes and joins the workers, entries still in the heap are discarded, whether or not they have expired
+        /// </summary>
+        /// <remarks>
+        /// Promises are faulted with SchedulerStopped rather than DeadlineExceeded, so their awaiters resume rather
+        /// than hang. Calling it again faults the promises scheduled since
+        /// </remarks>
+        void Stop() noexcept;
+
+    private:
+        void WorkerLoop();
+
+        [[nodiscard]] static DeadlineClock::time_point DeadlineOf(ScheduleItem const & item) noexcept;
+
+        // Note: must hold the heap lock
+        void Push(DeadlineClock::time_point deadline, ReadyItem item);
+
+        [[nodiscard]] std::optional<Entry> Pop() noexcept;
+
+        void Run(Entry const & entry) noexcept;
+        void Expire(ReadyItem item) noexcept;
+
+        void WakeOne() noexcept;
+        void Sleep() noexcept;
+    };
+
+}  // namespace TaskSystem
\ No newline at end of file
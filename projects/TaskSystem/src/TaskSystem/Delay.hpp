@@ -0,0 +1,109 @@
+#pragma once
+
+#include <TaskSystem/Deadline.hpp>
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/Timer.hpp>
+#include <TaskSystem/Detail/Utils.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+#include <TaskSystem/ScheduleItem.hpp>
+#include <TaskSystem/TimerService.hpp>
+
+#include <chrono>
+#include <coroutine>
+#include <exception>
+
+
+namespace TaskSystem
+{
+    namespace Detail
+    {
+
+        /// <summary>
+        /// Suspends the caller until expiry, then schedules it back onto the scheduler it was running on
+        /// </summary>
+        /// <remarks>
+        /// The timer lives in the awaitable, in the caller's frame, so delaying does not allocate
+        /// </remarks>
+        class DelayAwaitable final : private Timer
+        {
+        private:
+            TimerService & service;
+            DeadlineClock::time_point expiry;
+
+            IPromise * caller = nullptr;
+            ITaskScheduler * scheduler = nullptr;
+
+        public:
+            DelayAwaitable(TimerService & service, DeadlineClock::time_point expiry) noexcept
+              : service(service), expiry(expiry)
+            { }
+
+            [[nodiscard]] bool await_ready() const noexcept { return expiry <= service.Now(); }
+
+            // ToDo: use PromiseType concept
+            template <typename TPromise>
+            void await_suspend(std::coroutine_handle<TPromise> callerHandle)
+            {
+                IPromise & callerPromise = callerHandle.promise();
+                await_suspend(callerHandle, callerPromise);
+            }
+
+            void await_suspend(std::coroutine_handle<>, IPromise & callerPromise)
+            {
+                if (!callerPromise.TrySetSuspended())
+                {
+                    throw std::exception("Unable to set caller promise to suspended");
+                }
+
+                caller = &callerPromise;
+                scheduler = FirstOf(CurrentScheduler(), DefaultScheduler());
+
+                // Note: the timer can fire, and the caller resume, before Arm returns
+                service.Arm(*this, expiry);
+            }
+
+            constexpr void await_resume() const noexcept { }
+
+        private:
+            void OnExpired() noexcept override
+            {
+                // Note: the caller can resume, and destroy this, as soon as it is scheduled
+                auto * promise = caller;
+                auto * target = scheduler;
+
+                if (promise->TrySetScheduled())
+                {
+                    target->Schedule(ScheduleItem(*promise));
+                }
+            }
+        };
+
+    }  // namespace Detail
+
+    /// <summary>
+    /// co_await to suspend the calling task for at least duration without blocking the thread
+    /// </summary>
+    [[nodiscard]] inline Detail::DelayAwaitable Delay(DeadlineClock::duration duration, TimerService & service)
+    {
+        return Detail::DelayAwaitable(service, service.Now() + duration);
+    }
+
+    [[nodiscard]] inline Detail::DelayAwaitable Delay(DeadlineClock::duration duration)
+    {
+        return Delay(duration, DefaultTimerService());
+    }
+
+    /// <summary>
+    /// co_await to suspend the calling task until at least expiry without blocking the thread
+    /// </summary>
+    [[nodiscard]] inline Detail::DelayAwaitable DelayUntil(DeadlineClock::time_point expiry, TimerService & service)
+    {
+        return Detail::DelayAwaitable(service, expiry);
+    }
+
+    [[nodiscard]] inline Detail::DelayAwaitable DelayUntil(DeadlineClock::time_point expiry)
+    {
+        return DelayUntil(expiry, DefaultTimerService());
+    }
+
+}  // namespace TaskSystem
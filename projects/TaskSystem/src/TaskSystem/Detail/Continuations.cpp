@@ -1,86 +1,107 @@
 #include <TaskSystem/Detail/Continuations.hpp>
 
+#include <utility>
+
 
 namespace TaskSystem::Detail
 {
 
-    ContinuationIterator::ContinuationIterator(Continuations & container, size_t startPosition) noexcept
-        : container(&container), position(startPosition)
-    { }
-
-    ContinuationIterator::ContinuationIterator(ContinuationIterator const & other) noexcept
-        : container(other.container), position(other.position)
+    PendingContinuations::PendingContinuations(PendingContinuations && other) noexcept
+      : head(std::exchange(other.head, nullptr))
     { }
 
-    Continuation & ContinuationIterator::operator*()
+    PendingContinuations & PendingContinuations::operator=(PendingContinuations && other) noexcept
     {
-        if (position >= container->arrCount + container->vec.size()) [[unlikely]]
+        if (this != &other)
         {
-            throw std::exception();
-        }
-
-            if (position < container->arrCount) [[likely]]
+            while (!Empty())
             {
-                return container->arr[position];
+                [[maybe_unused]] auto _ = Pop();
             }
-
-        return container->vec[position - container->arr.size()];
+            head = std::exchange(other.head, nullptr);
+        }
+        return *this;
     }
 
-    Continuation * ContinuationIterator::operator->() { return &(operator*()); }
-
-    ContinuationIterator & ContinuationIterator::operator++()
+    PendingContinuations::~PendingContinuations() noexcept
     {
-        ++position;
-        return *this;
+        while (!Empty())
+        {
+            [[maybe_unused]] auto _ = Pop();
+        }
     }
 
-    ContinuationIterator ContinuationIterator::operator++(int)
+    Continuation PendingContinuations::Pop() noexcept
     {
-        ContinuationIterator temp(*this);
-        ++(*this);
-        return temp;
+        if (head == nullptr)
+        {
+            return Continuation();
+        }
+
+        auto * node = std::exchange(head, head->next);
+        return node->value;
     }
 
-    ContinuationIterator ContinuationIterator::operator+(int value) const
+
+    Continuations::Continuations() noexcept : head(nullptr) { }
+
+    Continuations::~Continuations() noexcept
     {
-        return ContinuationIterator(*container, position + value);
+        // Unlinks the nodes of continuations that were never scheduled
+        [[maybe_unused]] auto _ = Close();
     }
 
-    bool ContinuationIterator::operator==(ContinuationIterator const & other) const
+    ContinuationNode * Continuations::ClosedSentinel() noexcept
     {
-        return container == other.container && position == other.position;
+        static ContinuationNode sentinel{};
+        return &sentinel;
     }
 
-    bool ContinuationIterator::operator!=(ContinuationIterator const & other) const { return !(*this == other); }
-
-    bool ContinuationIterator::operator==(ContinuationSentinal const &) const
+    bool Continuations::Empty() const noexcept
     {
-        return position >= container->arrCount + container->vec.size();
+        auto * current = head.load(std::memory_order_acquire);
+        return current == nullptr || current == ClosedSentinel();
     }
 
-    bool ContinuationIterator::operator!=(ContinuationSentinal const & other) const { return !(*this == other); }
+    bool Continuations::IsClosed() const noexcept { return head.load(std::memory_order_acquire) == ClosedSentinel(); }
 
+    bool Continuations::TryAdd(ContinuationNode & node) noexcept
+    {
+        auto * closed = ClosedSentinel();
+        auto * current = head.load(std::memory_order_relaxed);
 
-    Continuations::Continuations() noexcept : arr(), arrCount(0u), vec(0u) { }
+        do
+        {
+            if (current == closed)
+            {
+                return false;
+            }
+
+            node.next = current;
+        } while (!head.compare_exchange_weak(current, &node, std::memory_order_release, std::memory_order_relaxed));
 
-    size_t Continuations::Size() const { return arrCount + vec.size(); }
-    bool Continuations::Empty() const { return Size() == 0u; }
+        return true;
+    }
 
-    void Continuations::Add(Continuation && continuation)
+    PendingContinuations Continuations::Close() noexcept
     {
-        if (arrCount != arr.size()) [[likely]]
+        auto * current = head.exchange(ClosedSentinel(), std::memory_order_acq_rel);
+        if (current == ClosedSentinel())
         {
-            arr[arrCount] = std::move(continuation);
-        ++arrCount;
+            return PendingContinuations();
         }
-        else
+
+        // Stack is newest first, reverse so continuations are scheduled in the order they were added
+        ContinuationNode * reversed = nullptr;
+        while (current != nullptr)
         {
-            vec.emplace_back(std::move(continuation));
+            auto * next = current->next;
+            current->next = reversed;
+            reversed = current;
+            current = next;
         }
-    }
 
-    ContinuationIterator Continuations::begin() { return ContinuationIterator(*this, 0u); }
-    ContinuationSentinal Continuations::end() { return ContinuationSentinal(); }
+        return PendingContinuations(reversed);
+    }
 
-}  // namespace TaskSystem::Detail
+}  // namespace TaskSystem::Detail
\ No newline at end of file
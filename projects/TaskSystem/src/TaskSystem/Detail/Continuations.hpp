@@ -3,65 +3,108 @@
 #include <TaskSystem/Detail/Continuation.hpp>
 #include <TaskSystem/Detail/Utils.hpp>
 
-#include <array>
-#include <vector>
+#include <atomic>
 
 
 namespace TaskSystem::Detail
 {
 
     class Continuations;
-
-    struct ContinuationSentinal
+    class PendingContinuations;
+
+    /// <summary>
+    /// Intrusive list node holding a single continuation
+    /// </summary>
+    /// <remarks>
+    /// Awaitables embed a node so adding an awaiter does not allocate, the node must stay alive until the continuation
+    /// has been scheduled
+    /// </remarks>
+    class ContinuationNode final
     {
+    private:
+        friend class Continuations;
+        friend class PendingContinuations;
+
+        Continuation value;
+        ContinuationNode * next = nullptr;
+
+    public:
+        ContinuationNode() noexcept = default;
+
+        explicit ContinuationNode(Continuation value) noexcept : value(value) { }
+
+        [[nodiscard]] Continuation const & Value() const noexcept { return value; }
     };
 
-    class ContinuationIterator
+    /// <summary>
+    /// Continuations detached from a closed Continuations list, in the order they were added
+    /// </summary>
+    class PendingContinuations final
     {
     private:
-        Continuations * container;
-        size_t position;
+        ContinuationNode * head;
 
     public:
-        ContinuationIterator(Continuations & container, size_t startPosition) noexcept;
-        ContinuationIterator(ContinuationIterator const & other) noexcept;
+        explicit PendingContinuations(ContinuationNode * head = nullptr) noexcept : head(head) { }
 
-        Continuation & operator*();
-        Continuation * operator->();
+        PendingContinuations(PendingContinuations const &) = delete;
+        PendingContinuations & operator=(PendingContinuations const &) = delete;
 
-        ContinuationIterator & operator++();
-        ContinuationIterator operator++(int);
+        PendingContinuations(PendingContinuations && other) noexcept;
+        PendingContinuations & operator=(PendingContinuations && other) noexcept;
 
-        ContinuationIterator operator+(int value) const;
+        ~PendingContinuations() noexcept;
 
-        bool operator==(ContinuationIterator const & other) const;
-        bool operator!=(ContinuationIterator const & other) const;
+        [[nodiscard]] bool Empty() const noexcept { return head == nullptr; }
 
-        bool operator==(ContinuationSentinal const &) const;
-        bool operator!=(ContinuationSentinal const & other) const;
+        /// <summary>
+        /// Removes the first continuation
+        /// </summary>
+        /// <remarks>
+        /// The node is unlinked before returning, scheduling the continuation may resume the awaiter and destroy the
+        /// node it was embedded in
+        /// </remarks>
+        [[nodiscard]] Continuation Pop() noexcept;
     };
 
-    // Optimization: most tasks will have few continuations, a few are kept on the stack, the rest are in a vector
-    class Continuations
+    /// <summary>
+    /// Lock-free Treiber stack of continuations that is closed once when the promise completes
+    /// </summary>
+    /// <remarks>
+    /// Adding is a single CAS on the head. Close swaps in a sentinel so every later add fails without taking a lock and
+    /// the awaiter knows to resume inline
+    /// </remarks>
+    class Continuations final
     {
     private:
-        friend class ContinuationIterator;
-
-        std::array<Continuation, 4u> arr;
-        size_t arrCount;
+        // Note: awaiters contend on the head, the owning promise decides whether it gets its own cache line
+        std::atomic<ContinuationNode *> head;
 
-        std::vector<Continuation> vec;
+        [[nodiscard]] static ContinuationNode * ClosedSentinel() noexcept;
 
     public:
         Continuations() noexcept;
 
-        size_t Size() const;
-        bool Empty() const;
+        Continuations(Continuations const &) = delete;
+        Continuations & operator=(Continuations const &) = delete;
+
+        Continuations(Continuations &&) = delete;
+        Continuations & operator=(Continuations &&) = delete;
+
+        ~Continuations() noexcept;
+
+        [[nodiscard]] bool Empty() const noexcept;
+        [[nodiscard]] bool IsClosed() const noexcept;
 
-        void Add(Continuation && continuation);
+        /// <summary>
+        /// Pushes the node, fails when the list has been closed
+        /// </summary>
+        [[nodiscard]] bool TryAdd(ContinuationNode & node) noexcept;
 
-        ContinuationIterator begin();
-        ContinuationSentinal end();
+        /// <summary>
+        /// Closes the list and detaches the continuations, returns an empty list if already closed
+        /// </summary>
+        [[nodiscard]] PendingContinuations Close() noexcept;
     };
 
-}  // namespace TaskSystem::Detail
+}  // namespace TaskSystem::Detail
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include <TaskSystem/Detail/CpuQuota.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#endif
+
+
+namespace TaskSystem::Detail
+{
+    namespace
+    {
+
+        [[nodiscard]] std::string_view Trim(std::string_view text) noexcept
+        {
+            auto const whitespace = std::string_view(" \t\r\n");
+
+            auto first = text.find_first_not_of(whitespace);
+            if (first == std::string_view::npos)
+            {
+                return std::string_view();
+            }
+
+            auto last = text.find_last_not_of(whitespace);
+            return text.substr(first, last - first + 1u);
+        }
+
+        [[nodiscard]] std::optional<std::int64_t> ParseInteger(std::string_view text) noexcept
+        {
+            text = Trim(text);
+
+            auto value = std::int64_t(0);
+            auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (error != std::errc() || end != text.data() + text.size())
+            {
+                return std::nullopt;
+            }
+
+            return value;
+        }
+
+        [[nodiscard]] std::optional<double> Ratio(std::int64_t quota, std::int64_t period) noexcept
+        {
+            if (quota <= 0 || period <= 0)
+            {
+                return std::nullopt;
+            }
+
+            return static_cast<double>(quota) / static_cast<double>(period);
+        }
+
+#if !defined(_WIN32)
+        [[nodiscard]] std::optional<std::string> ReadFile(char const * path)
+        {
+            auto file = std::ifstream(path);
+            if (!file)
+            {
+                return std::nullopt;
+            }
+
+            return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+#endif
+
+    }  // namespace
+
+    std::optional<double> ParseCgroupCpuMax(std::string_view text) noexcept
+    {
+        text = Trim(text);
+
+        auto separator = text.find(' ');
+        if (separator == std::string_view::npos)
+        {
+            return std::nullopt;
+        }
+
+        auto quota = ParseInteger(text.substr(0u, separator));
+        auto period = ParseInteger(text.substr(separator + 1u));
+        if (!quota || !period)
+        {
+            // Note: "max" fails to parse, which is the unlimited case
+            return std::nullopt;
+        }
+
+        return Ratio(*quota, *period);
+    }
+
+    std::optional<double> ParseCgroupCfsQuota(std::string_view quota, std::string_view period) noexcept
+    {
+        auto quotaValue = ParseInteger(quota);
+        auto periodValue = ParseInteger(period);
+        if (!quotaValue || !periodValue)
+        {
+            return std::nullopt;
+        }
+
+        return Ratio(*quotaValue, *periodValue);
+    }
+
+    std::optional<double> CpuQuota() noexcept
+    {
+#if defined(_WIN32)
+        auto information = JOBOBJECT_CPU_RATE_CONTROL_INFORMATION();
+        if (!QueryInformationJobObject(
+                nullptr, JobObjectCpuRateControlInformation, &information, sizeof(information), nullptr))
+        {
+            return std::nullopt;
+        }
+
+        auto const hardCap = JOB_OBJECT_CPU_RATE_CONTROL_ENABLE | JOB_OBJECT_CPU_RATE_CONTROL_HARD_CAP;
+        if ((information.ControlFlags & hardCap) != hardCap || information.CpuRate == 0u)
+        {
+            return std::nullopt;
+        }
+
+        // Note: CpuRate is the share of all the machine's processors in hundredths of a percent
+        auto processors = static_cast<double>(GetActiveProcessorCount(ALL_PROCESSOR_GROUPS));
+        return processors * static_cast<double>(information.CpuRate) / 10000.0;
+#else
+        try
+        {
+            if (auto text = ReadFile("/sys/fs/cgroup/cpu.max"))
+            {
+                return ParseCgroupCpuMax(*text);
+            }
+
+            for (auto const * directory : { "/sys/fs/cgroup/cpu,cpuacct/", "/sys/fs/cgroup/cpu/" })
+            {
+                auto quota = ReadFile((std::string(directory) + "cpu.cfs_quota_us").c_str());
+                auto period = ReadFile((std::string(directory) + "cpu.cfs_period_us").c_str());
+                if (quota && period)
+                {
+                    return ParseCgroupCfsQuota(*quota, *period);
+                }
+            }
+        }
+        catch (...)
+        {
+        }
+
+        return std::nullopt;
+#endif
+    }
+
+    std::size_t AvailableParallelism() noexcept
+    {
+        auto count = std::max<std::size_t>(std::thread::hardware_concurrency(), 1u);
+
+        if (auto quota = CpuQuota())
+        {
+            count = std::min(count, std::max<std::size_t>(static_cast<std::size_t>(std::ceil(*quota)), 1u));
+        }
+
+        return count;
+    }
+
+}  // namespace TaskSystem::Detail
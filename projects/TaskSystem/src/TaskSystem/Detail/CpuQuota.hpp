@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+
+namespace TaskSystem::Detail
+{
+
+    /// <summary>
+    /// CPUs the process may use per unit of time, e.g. 1.5, or nullopt when it is not limited
+    /// </summary>
+    /// <remarks>
+    /// On Linux this is the cgroup CPU quota, cpu.max for cgroup v2 or cpu.cfs_quota_us over cpu.cfs_period_us for v1,
+    /// read from the cgroup mounted at /sys/fs/cgroup as seen from inside a container. On Windows it is the hard cap
+    /// of the job object the process runs in
+    /// </remarks>
+    [[nodiscard]] std::optional<double> CpuQuota() noexcept;
+
+    /// <summary>
+    /// Hardware threads, capped at the CPU quota rounded up, at least 1
+    /// </summary>
+    [[nodiscard]] std::size_t AvailableParallelism() noexcept;
+
+    // Parses the contents of a cgroup v2 cpu.max file, "$MAX $PERIOD" where $MAX can be "max"
+    [[nodiscard]] std::optional<double> ParseCgroupCpuMax(std::string_view text) noexcept;
+
+    // Parses the contents of the cgroup v1 cpu.cfs_quota_us and cpu.cfs_period_us files, a quota of -1 is unlimited
+    [[nodiscard]] std::optional<double> ParseCgroupCfsQuota(std::string_view quota, std::string_view period) noexcept;
+
+}  // namespace TaskSystem::Detail
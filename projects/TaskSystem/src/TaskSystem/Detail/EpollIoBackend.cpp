@@ -0,0 +1,423 @@
+#include <TaskSystem/Detail/EpollIoBackend.hpp>
+
+#if defined(__linux__)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <system_error>
+
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+
+namespace TaskSystem::Detail
+{
+
+    namespace
+    {
+        constexpr std::size_t MaxTransfer = 0x7ffff000u;
+        constexpr int MaxEvents = 64;
+
+        enum class Attempt : std::uint8_t
+        {
+            Done,
+            WouldBlock,
+            NotSocket
+        };
+
+        void Complete(IoOperation & operation, ssize_t result) noexcept
+        {
+            operation.Result = result < 0 ? -errno : static_cast<std::int32_t>(result);
+        }
+
+        // Tries a socket operation without blocking
+        Attempt TryNonBlocking(IoOperation & operation) noexcept
+        {
+            auto length = std::min(operation.Length, MaxTransfer);
+            while (true)
+            {
+                auto result = ssize_t(-1);
+                switch (operation.Kind)
+                {
+                case IoOperationKind::Read:
+                    result = ::recv(operation.Fd, operation.Buffer, length, MSG_DONTWAIT);
+                    break;
+
+                case IoOperationKind::Write:
+                    result = ::send(operation.Fd, operation.Buffer, length, MSG_DONTWAIT | MSG_NOSIGNAL);
+                    break;
+
+                case IoOperationKind::Accept:
+                    // Note: only tried once the listener is readable, a blocking listener can still block here if
+                    // another process takes the connection first
+                    result = ::accept4(operation.Fd, nullptr, nullptr, SOCK_CLOEXEC);
+                    break;
+
+                default:
+                    errno = ENOTSOCK;
+                    break;
+                }
+
+                if (result < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+
+                if (result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                {
+                    return Attempt::WouldBlock;
+                }
+
+                if (result < 0 && errno == ENOTSOCK)
+                {
+                    // Note: Submit offloads the operation instead, once waiting it completes with the error
+                    operation.Result = -ENOTSOCK;
+                    return Attempt::NotSocket;
+                }
+
+                Complete(operation, result);
+                return Attempt::Done;
+            }
+        }
+
+        ssize_t ConnectBlocking(IoOperation & operation) noexcept
+        {
+            auto result = ::connect(operation.Fd, operation.Address, operation.AddressLength);
+            if (result == 0 || errno != EINPROGRESS)
+            {
+                return result;
+            }
+
+            // A non-blocking socket, wait for the handshake and take its outcome
+            auto descriptor = pollfd{ operation.Fd, POLLOUT, 0 };
+            while (::poll(&descriptor, 1u, -1) < 0 && errno == EINTR)
+            {
+            }
+
+            auto error = 0;
+            auto length = socklen_t(sizeof(error));
+            if (::getsockopt(operation.Fd, SOL_SOCKET, SO_ERROR, &error, &length) < 0)
+            {
+                return -1;
+            }
+
+            errno = error;
+            return error == 0 ? 0 : -1;
+        }
+
+        void RunBlocking(IoOperation & operation) noexcept
+        {
+            auto length = std::min(operation.Length, MaxTransfer);
+            auto positioned = operation.Offset != IoOperation::CurrentOffset;
+            auto offset = static_cast<off_t>(operation.Offset);
+
+            auto result = ssize_t(-1);
+            do
+            {
+                switch (operation.Kind)
+                {
+                case IoOperationKind::Read:
+                    result = positioned ? ::pread(operation.Fd, operation.Buffer, length, offset)
+                                        : ::read(operation.Fd, operation.Buffer, length);
+                    break;
+
+                case IoOperationKind::Write:
+                    result = positioned ? ::pwrite(operation.Fd, operation.Buffer, length, offset)
+                                        : ::write(operation.Fd, operation.Buffer, length);
+                    break;
+
+                case IoOperationKind::Accept:
+                    result = ::accept4(operation.Fd, nullptr, nullptr, SOCK_CLOEXEC);
+                    break;
+
+                case IoOperationKind::Connect:
+                    result = ConnectBlocking(operation);
+                    break;
+
+                case IoOperationKind::Fsync:
+                    result = ::fsync(operation.Fd);
+                    break;
+                }
+            } while (result < 0 && errno == EINTR);
+
+            Complete(operation, result);
+        }
+
+    }  // namespace
+
+    void EpollIoBackend::WaitQueue::Push(IoOperation & operation) noexcept
+    {
+        operation.NextWaiter = nullptr;
+        if (Tail)
+        {
+            Tail->NextWaiter = &operation;
+        }
+        else
+        {
+            Head = &operation;
+        }
+        Tail = &operation;
+    }
+
+    IoOperation & EpollIoBackend::WaitQueue::Pop() noexcept
+    {
+        auto & operation = *Head;
+        Head = operation.NextWaiter;
+        if (!Head)
+        {
+            Tail = nullptr;
+        }
+        return operation;
+    }
+
+    EpollIoBackend::EpollIoBackend(std::size_t threadCount)
+      : epoll(-1), wakeFd(-1), waiters(), ready(), completed(), mutex(), condition(), blocking(), stopping(false)
+    {
+        epoll = ::epoll_create1(EPOLL_CLOEXEC);
+        if (epoll < 0)
+        {
+            throw std::system_error(errno, std::system_category(), "epoll_create1");
+        }
+
+        wakeFd = ::eventfd(0u, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (wakeFd < 0)
+        {
+            auto error = errno;
+            ::close(epoll);
+            throw std::system_error(error, std::system_category(), "eventfd");
+        }
+
+        auto event = epoll_event();
+        event.events = EPOLLIN;
+        event.data.fd = wakeFd;
+        ::epoll_ctl(epoll, EPOLL_CTL_ADD, wakeFd, &event);
+
+        threads.reserve(std::max(threadCount, std::size_t(1u)));
+        for (auto i = std::size_t(0u); i < threads.capacity(); ++i)
+        {
+            threads.emplace_back([this]() { Work(); });
+        }
+    }
+
+    EpollIoBackend::~EpollIoBackend() noexcept
+    {
+        {
+            auto lock = std::lock_guard(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+
+        ::close(wakeFd);
+        ::close(epoll);
+    }
+
+    void EpollIoBackend::Submit(IoOperation & operation) noexcept
+    {
+        switch (operation.Kind)
+        {
+        case IoOperationKind::Read:
+        case IoOperationKind::Write:
+            if (operation.Offset != IoOperation::CurrentOffset)
+            {
+                Offload(operation);
+                return;
+            }
+
+            switch (TryNonBlocking(operation))
+            {
+            case Attempt::Done:
+                ready.PushBack(operation);
+                return;
+
+            case Attempt::WouldBlock:
+                Wait(operation);
+                return;
+
+            case Attempt::NotSocket:
+                Offload(operation);
+                return;
+            }
+            return;
+
+        case IoOperationKind::Accept:
+            Wait(operation);
+            return;
+
+        case IoOperationKind::Connect:
+        case IoOperationKind::Fsync:
+            Offload(operation);
+            return;
+        }
+    }
+
+    IntrusiveList<IoOperation> EpollIoBackend::Process(bool wait, std::chrono::steady_clock::time_point const * deadline)
+        noexcept
+    {
+        auto done = std::move(ready);
+        while (auto * operation = completed.Pop())
+        {
+            done.PushBack(*operation);
+        }
+
+        auto timeout = -1;
+        if (!wait || !done.Empty())
+        {
+            timeout = 0;
+        }
+        else if (deadline)
+        {
+            auto remaining = std::chrono::ceil<std::chrono::milliseconds>(*deadline - std::chrono::steady_clock::now());
+            timeout = static_cast<int>(std::clamp<std::chrono::milliseconds::rep>(remaining.count(), 0, 1 << 30));
+        }
+
+        epoll_event events[MaxEvents];
+        auto count = ::epoll_wait(epoll, events, MaxEvents, timeout);
+
+        for (auto i = 0; i < count; ++i)
+        {
+            if (events[i].data.fd == wakeFd)
+            {
+                auto value = std::uint64_t(0u);
+                [[maybe_unused]] auto _ = ::read(wakeFd, &value, sizeof(value));
+                continue;
+            }
+
+            OnReady(events[i].data.fd, events[i].events, done);
+        }
+
+        while (auto * operation = completed.Pop())
+        {
+            done.PushBack(*operation);
+        }
+
+        return done;
+    }
+
+    void EpollIoBackend::Wake() noexcept
+    {
+        auto one = std::uint64_t(1u);
+        [[maybe_unused]] auto _ = ::write(wakeFd, &one, sizeof(one));
+    }
+
+    void EpollIoBackend::Wait(IoOperation & operation) noexcept
+    {
+        auto & fdWaiters = waiters[operation.Fd];
+        if (operation.Kind == IoOperationKind::Write)
+        {
+            fdWaiters.Writers.Push(operation);
+        }
+        else
+        {
+            fdWaiters.Readers.Push(operation);
+        }
+
+        Arm(operation.Fd, fdWaiters);
+    }
+
+    void EpollIoBackend::Arm(int fd, Waiters & fdWaiters) noexcept
+    {
+        auto event = epoll_event();
+        event.events = EPOLLONESHOT | (fdWaiters.Readers.Empty() ? 0u : EPOLLIN)
+                     | (fdWaiters.Writers.Empty() ? 0u : EPOLLOUT);
+        event.data.fd = fd;
+
+        // Note: a closed fd leaves the set on its own, so either call can find the registration state stale
+        if (::epoll_ctl(epoll, EPOLL_CTL_MOD, fd, &event) == 0
+            || (errno == ENOENT && ::epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &event) == 0))
+        {
+            return;
+        }
+
+        // The fd cannot be polled, fail everything waiting on it
+        auto error = -errno;
+        for (auto * queue : { &fdWaiters.Readers, &fdWaiters.Writers })
+        {
+            while (!queue->Empty())
+            {
+                auto & operation = queue->Pop();
+                operation.Result = error;
+                ready.PushBack(operation);
+            }
+        }
+
+        waiters.erase(fd);
+    }
+
+    void EpollIoBackend::OnReady(int fd, std::uint32_t events, IntrusiveList<IoOperation> & done) noexcept
+    {
+        auto it = waiters.find(fd);
+        if (it == waiters.end())
+        {
+            return;
+        }
+
+        auto & fdWaiters = it->second;
+        auto drain = [&](WaitQueue & queue) {
+            while (!queue.Empty() && TryNonBlocking(*queue.Head) != Attempt::WouldBlock)
+            {
+                done.PushBack(queue.Pop());
+            }
+        };
+
+        if (events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+        {
+            drain(fdWaiters.Readers);
+        }
+
+        if (events & (EPOLLOUT | EPOLLERR | EPOLLHUP))
+        {
+            drain(fdWaiters.Writers);
+        }
+
+        if (fdWaiters.Readers.Empty() && fdWaiters.Writers.Empty())
+        {
+            waiters.erase(it);
+            return;
+        }
+
+        Arm(fd, fdWaiters);
+    }
+
+    void EpollIoBackend::Offload(IoOperation & operation) noexcept
+    {
+        {
+            auto lock = std::lock_guard(mutex);
+            blocking.PushBack(operation);
+        }
+        condition.notify_one();
+    }
+
+    void EpollIoBackend::Work() noexcept
+    {
+        while (true)
+        {
+            auto * operation = static_cast<IoOperation *>(nullptr);
+            {
+                auto lock = std::unique_lock(mutex);
+                condition.wait(lock, [this]() { return stopping || !blocking.Empty(); });
+                if (stopping)
+                {
+                    return;
+                }
+
+                operation = blocking.PopFront();
+            }
+
+            RunBlocking(*operation);
+            completed.Push(*operation);
+            Wake();
+        }
+    }
+
+}  // namespace TaskSystem::Detail
+
+#endif
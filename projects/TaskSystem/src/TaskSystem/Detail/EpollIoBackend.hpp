@@ -0,0 +1,97 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/Detail/IoOperation.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+namespace TaskSystem::Detail
+{
+
+    /// <summary>
+    /// Fallback for kernels without io_uring, sockets are driven by epoll and everything else by a thread pool
+    /// </summary>
+    /// <remarks>
+    /// Socket reads and writes are tried straight away and only wait for readiness when they would block, an fd is
+    /// registered EPOLLONESHOT and re-armed while operations are waiting on it. Files, connect and fsync run as
+    /// blocking calls on the pool, whose threads post completions to an MPSC queue and wake the loop
+    /// </remarks>
+    class EpollIoBackend final : public IIoBackend
+    {
+    private:
+        struct WaitQueue final
+        {
+            IoOperation * Head = nullptr;
+            IoOperation * Tail = nullptr;
+
+            [[nodiscard]] bool Empty() const noexcept { return Head == nullptr; }
+
+            void Push(IoOperation & operation) noexcept;
+            IoOperation & Pop() noexcept;
+        };
+
+        struct Waiters final
+        {
+            WaitQueue Readers;
+            WaitQueue Writers;
+        };
+
+        int epoll;
+        int wakeFd;
+
+        // Only touched by the loop thread
+        std::unordered_map<int, Waiters> waiters;
+        IntrusiveList<IoOperation> ready;
+
+        IntrusiveMpscQueue<IoOperation> completed;
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        IntrusiveList<IoOperation> blocking;
+        bool stopping;
+
+        std::vector<std::thread> threads;
+
+    public:
+        // Throws std::system_error if the epoll instance or eventfd cannot be created
+        explicit EpollIoBackend(std::size_t threadCount);
+
+        EpollIoBackend(EpollIoBackend const &) = delete;
+        EpollIoBackend & operator=(EpollIoBackend const &) = delete;
+
+        EpollIoBackend(EpollIoBackend &&) = delete;
+        EpollIoBackend & operator=(EpollIoBackend &&) = delete;
+
+        // Waits for blocking calls already running, operations that have not started are dropped
+        ~EpollIoBackend() noexcept override;
+
+        void Submit(IoOperation & operation) noexcept override;
+
+        [[nodiscard]] IntrusiveList<IoOperation> Process(
+            bool wait, std::chrono::steady_clock::time_point const * deadline) noexcept override;
+
+        void Wake() noexcept override;
+
+        [[nodiscard]] bool IsIoUring() const noexcept override { return false; }
+
+    private:
+        void Wait(IoOperation & operation) noexcept;
+        void Arm(int fd, Waiters & fdWaiters) noexcept;
+        void OnReady(int fd, std::uint32_t events, IntrusiveList<IoOperation> & done) noexcept;
+
+        void Offload(IoOperation & operation) noexcept;
+        void Work() noexcept;
+    };
+
+}  // namespace TaskSystem::Detail
+
+#endif
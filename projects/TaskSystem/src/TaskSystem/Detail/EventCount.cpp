@@ -0,0 +1,70 @@
+#include <TaskSystem/Detail/EventCount.hpp>
+#include <TaskSystem/Detail/SpinWait.hpp>
+
+#include <thread>
+
+
+namespace TaskSystem::Detail
+{
+
+    EventCount::key_type EventCount::PrepareWait() noexcept
+    {
+        waiters.fetch_add(1u, std::memory_order_relaxed);
+
+        // Pairs with the fence in Notify, either the waiter sees the condition or the notifier sees the waiter
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        return epoch.load(std::memory_order_acquire);
+    }
+
+    void EventCount::CancelWait() noexcept { waiters.fetch_sub(1u, std::memory_order_relaxed); }
+
+    void EventCount::Wait(key_type key, std::uint32_t spinCount, std::uint32_t yieldCount) noexcept
+    {
+        auto notified = [&]() { return epoch.load(std::memory_order_acquire) != key; };
+
+        for (auto i = std::uint32_t(0u); i < spinCount && !notified(); ++i)
+        {
+            CpuRelax();
+        }
+
+        for (auto i = std::uint32_t(0u); i < yieldCount && !notified(); ++i)
+        {
+            std::this_thread::yield();
+        }
+
+        while (!notified())
+        {
+            epoch.wait(key, std::memory_order_acquire);
+        }
+
+        waiters.fetch_sub(1u, std::memory_order_relaxed);
+    }
+
+    void EventCount::NotifyOne() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (waiters.load(std::memory_order_relaxed) == 0u)
+        {
+            return;
+        }
+
+        epoch.fetch_add(1u, std::memory_order_release);
+        epoch.notify_one();
+    }
+
+    void EventCount::NotifyAll() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (waiters.load(std::memory_order_relaxed) == 0u)
+        {
+            return;
+        }
+
+        epoch.fetch_add(1u, std::memory_order_release);
+        epoch.notify_all();
+    }
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+
+namespace TaskSystem::Detail
+{
+
+    /// <summary>
+    /// Eventcount for sleeping until a condition, checked outside the eventcount, may have changed
+    /// </summary>
+    /// <remarks>
+    /// A waiter calls PrepareWait, re-checks its condition, then either CancelWait or Wait with the key. A notifier
+    /// makes the condition true then calls Notify, which is a fence and a load when nobody is waiting. A notify after
+    /// PrepareWait always ends the matching Wait, so wakeups cannot be missed. Wait spins, then yields, then parks on
+    /// the epoch with std::atomic::wait, a futex on Linux and WaitOnAddress on Windows
+    /// </remarks>
+    class EventCount final
+    {
+    public:
+        using key_type = std::uint32_t;
+
+    private:
+        std::atomic<key_type> epoch;
+        std::atomic<std::uint32_t> waiters;
+
+    public:
+        EventCount() noexcept : epoch(0u), waiters(0u) { }
+
+        EventCount(EventCount const &) = delete;
+        EventCount & operator=(EventCount const &) = delete;
+
+        EventCount(EventCount &&) = delete;
+        EventCount & operator=(EventCount &&) = delete;
+
+        ~EventCount() noexcept = default;
+
+        /// <summary>
+        /// Registers the caller as a waiter, must be followed by CancelWait or Wait
+        /// </summary>
+        [[nodiscard]] key_type PrepareWait() noexcept;
+
+        void CancelWait() noexcept;
+
+        /// <summary>
+        /// Blocks until a notify after the PrepareWait that returned key
+        /// </summary>
+        /// <param name="spinCount">Checks with a pause between them before yielding</param>
+        /// <param name="yieldCount">Checks with a yield between them before parking the thread</param>
+        void Wait(key_type key, std::uint32_t spinCount = 0u, std::uint32_t yieldCount = 0u) noexcept;
+
+        void NotifyOne() noexcept;
+
+        void NotifyAll() noexcept;
+
+        [[nodiscard]] std::uint32_t Waiters() const noexcept { return waiters.load(std::memory_order_relaxed); }
+    };
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
@@ -0,0 +1,330 @@
+#include <TaskSystem/Detail/FrameAllocator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+
+namespace TaskSystem::Detail
+{
+
+    FrameAllocatorStats & FrameAllocatorStats::operator+=(FrameAllocatorStats const & other) noexcept
+    {
+        Allocations += other.Allocations;
+        PoolHits += other.PoolHits;
+        LargeAllocations += other.LargeAllocations;
+        RemoteFrees += other.RemoteFrees;
+        return *this;
+    }
+
+    namespace
+    {
+
+        constexpr auto SizeClassCount
+            = static_cast<std::size_t>(std::countr_zero(PooledFrameAllocator::LargestSizeClass)
+                                       - std::countr_zero(PooledFrameAllocator::SmallestSizeClass) + 1);
+
+        constexpr auto LargeSizeClass = std::uint32_t(SizeClassCount);
+
+        constexpr std::size_t ChunkSize = 64u * 1024u;
+
+        class ThreadCache;
+
+        // Precedes every block so Deallocate can find the owning cache without a lookup
+        struct alignas(PooledFrameAllocator::Alignment) BlockHeader final
+        {
+            ThreadCache * Owner;
+            std::uint32_t SizeClass;
+        };
+
+        constexpr std::size_t HeaderSize = sizeof(BlockHeader);
+
+        // Overlays the user memory of a free block
+        struct FreeBlock final
+        {
+            FreeBlock * Next;
+        };
+
+        [[nodiscard]] constexpr std::uint32_t SizeClassOf(std::size_t size) noexcept
+        {
+            if (size <= PooledFrameAllocator::SmallestSizeClass)
+            {
+                return 0u;
+            }
+
+            if (size > PooledFrameAllocator::LargestSizeClass)
+            {
+                return LargeSizeClass;
+            }
+
+            return static_cast<std::uint32_t>(
+                std::bit_width(size - 1u) - std::countr_zero(PooledFrameAllocator::SmallestSizeClass));
+        }
+
+        [[nodiscard]] constexpr std::size_t BlockSizeOf(std::uint32_t sizeClass) noexcept
+        {
+            return HeaderSize + (PooledFrameAllocator::SmallestSizeClass << sizeClass);
+        }
+
+        [[nodiscard]] BlockHeader * HeaderOf(void * ptr) noexcept
+        {
+            return reinterpret_cast<BlockHeader *>(static_cast<std::byte *>(ptr) - HeaderSize);
+        }
+
+        [[nodiscard]] void * UserOf(BlockHeader * header) noexcept
+        {
+            return reinterpret_cast<std::byte *>(header) + HeaderSize;
+        }
+
+        // Single writer counter that can be read from any thread
+        class Counter final
+        {
+        private:
+            std::atomic<std::size_t> value = 0u;
+
+        public:
+            void Increment() noexcept
+            {
+                value.store(value.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] std::size_t Load() const noexcept { return value.load(std::memory_order_relaxed); }
+        };
+
+        class ThreadCache final
+        {
+        private:
+            std::array<FreeBlock *, SizeClassCount> freeLists{};
+            std::vector<std::unique_ptr<std::byte[]>> chunks;
+
+            // Note: pushed by any thread, only the owner takes the whole list
+            std::atomic<BlockHeader *> remoteFrees = nullptr;
+
+            Counter allocations;
+            Counter poolHits;
+            Counter largeAllocations;
+            Counter remoteFreeCount;
+
+        public:
+            [[nodiscard]] void * Allocate(std::size_t size)
+            {
+                allocations.Increment();
+
+                auto sizeClass = SizeClassOf(size);
+                if (sizeClass == LargeSizeClass)
+                {
+                    largeAllocations.Increment();
+
+                    auto * header = static_cast<BlockHeader *>(::operator new(HeaderSize + size));
+                    header->Owner = nullptr;
+                    header->SizeClass = LargeSizeClass;
+                    return UserOf(header);
+                }
+
+                if (freeLists[sizeClass] == nullptr)
+                {
+                    ReclaimRemoteFrees();
+                }
+
+                if (freeLists[sizeClass] != nullptr)
+                {
+                    poolHits.Increment();
+                }
+                else
+                {
+                    Carve(sizeClass);
+                }
+
+                auto * block = freeLists[sizeClass];
+                freeLists[sizeClass] = block->Next;
+                return block;
+            }
+
+            void DeallocateLocal(BlockHeader * header) noexcept
+            {
+                auto * block = static_cast<FreeBlock *>(UserOf(header));
+                block->Next = freeLists[header->SizeClass];
+                freeLists[header->SizeClass] = block;
+            }
+
+            void DeallocateRemote(BlockHeader * header) noexcept
+            {
+                // Treiber push, the header's owner field is reused as the link
+                auto * head = remoteFrees.load(std::memory_order_relaxed);
+                do
+                {
+                    header->Owner = reinterpret_cast<ThreadCache *>(head);
+                } while (!remoteFrees.compare_exchange_weak(
+                    head, header, std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            void CountRemoteFree() noexcept { remoteFreeCount.Increment(); }
+
+            [[nodiscard]] FrameAllocatorStats Stats() const noexcept
+            {
+                auto result = FrameAllocatorStats();
+                result.Allocations = allocations.Load();
+                result.PoolHits = poolHits.Load();
+                result.LargeAllocations = largeAllocations.Load();
+                result.RemoteFrees = remoteFreeCount.Load();
+                return result;
+            }
+
+        private:
+            void ReclaimRemoteFrees() noexcept
+            {
+                auto * header = remoteFrees.exchange(nullptr, std::memory_order_acquire);
+                while (header != nullptr)
+                {
+                    auto * next = reinterpret_cast<BlockHeader *>(header->Owner);
+                    header->Owner = this;
+                    DeallocateLocal(header);
+                    header = next;
+                }
+            }
+
+            void Carve(std::uint32_t sizeClass)
+            {
+                auto blockSize = BlockSizeOf(sizeClass);
+                auto blockCount = std::max<std::size_t>(ChunkSize / blockSize, 4u);
+
+                chunks.emplace_back(new std::byte[blockSize * blockCount]);
+                auto * chunk = chunks.back().get();
+
+                for (auto i = blockCount; i != 0u; --i)
+                {
+                    auto * header = reinterpret_cast<BlockHeader *>(chunk + (i - 1u) * blockSize);
+                    header->Owner = this;
+                    header->SizeClass = sizeClass;
+                    DeallocateLocal(header);
+                }
+            }
+        };
+
+        // Owns every cache; caches of exited threads are parked here and adopted by new threads
+        class Registry final
+        {
+        private:
+            std::mutex mutex;
+            std::vector<std::unique_ptr<ThreadCache>> caches;
+            std::vector<ThreadCache *> parked;
+
+        public:
+            [[nodiscard]] ThreadCache * Acquire()
+            {
+                std::lock_guard lock(mutex);
+
+                if (!parked.empty())
+                {
+                    auto * cache = parked.back();
+                    parked.pop_back();
+                    return cache;
+                }
+
+                caches.emplace_back(std::make_unique<ThreadCache>());
+                return caches.back().get();
+            }
+
+            void Park(ThreadCache * cache)
+            {
+                std::lock_guard lock(mutex);
+                parked.emplace_back(cache);
+            }
+
+            [[nodiscard]] FrameAllocatorStats Stats()
+            {
+                std::lock_guard lock(mutex);
+
+                auto result = FrameAllocatorStats();
+                for (auto & cache : caches)
+                {
+                    result += cache->Stats();
+                }
+                return result;
+            }
+        };
+
+        [[nodiscard]] Registry & GetRegistry()
+        {
+            // Note: never destroyed, frames can be freed by threads that outlive static destruction
+            static auto * registry = new Registry();
+            return *registry;
+        }
+
+        class ThreadCacheHandle final
+        {
+        private:
+            ThreadCache * cache = nullptr;
+
+        public:
+            ~ThreadCacheHandle() noexcept
+            {
+                if (cache)
+                {
+                    GetRegistry().Park(std::exchange(cache, nullptr));
+                }
+            }
+
+            [[nodiscard]] ThreadCache & Get()
+            {
+                if (!cache) [[unlikely]]
+                {
+                    cache = GetRegistry().Acquire();
+                }
+                return *cache;
+            }
+
+            [[nodiscard]] ThreadCache * Peek() const noexcept { return cache; }
+        };
+
+        thread_local ThreadCacheHandle currentCache;
+
+    }  // namespace
+
+    void * PooledFrameAllocator::Allocate(std::size_t size) { return currentCache.Get().Allocate(size); }
+
+    void PooledFrameAllocator::Deallocate(void * ptr, std::size_t size) noexcept
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+
+        auto * header = HeaderOf(ptr);
+        if (header->SizeClass == LargeSizeClass)
+        {
+            ::operator delete(header, HeaderSize + size);
+            return;
+        }
+
+        auto * owner = header->Owner;
+        auto * local = currentCache.Peek();
+
+        if (owner == local)
+        {
+            owner->DeallocateLocal(header);
+            return;
+        }
+
+        owner->DeallocateRemote(header);
+        if (local)
+        {
+            local->CountRemoteFree();
+        }
+    }
+
+    FrameAllocatorStats PooledFrameAllocator::ThreadStats() noexcept
+    {
+        auto * cache = currentCache.Peek();
+        return cache ? cache->Stats() : FrameAllocatorStats();
+    }
+
+    FrameAllocatorStats PooledFrameAllocator::Stats() noexcept { return GetRegistry().Stats(); }
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
@@ -0,0 +1,238 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+namespace TaskSystem::Detail
+{
+
+    template <typename T>
+    concept FrameAllocator = requires(std::size_t size, void * ptr)
+    {
+        // clang-format off
+        { T::Allocate(size) } -> std::same_as<void *>;
+        { T::Deallocate(ptr, size) } -> std::same_as<void>;
+        // clang-format on
+    };
+
+    /// <summary>
+    /// Allocates coroutine frames with the global operator new
+    /// </summary>
+    struct GlobalFrameAllocator final
+    {
+        [[nodiscard]] static void * Allocate(std::size_t size) { return ::operator new(size); }
+
+        static void Deallocate(void * ptr, std::size_t size) noexcept { ::operator delete(ptr, size); }
+    };
+
+    static_assert(FrameAllocator<GlobalFrameAllocator>);
+
+    struct FrameAllocatorStats final
+    {
+        // Frames requested through Allocate
+        std::size_t Allocations = 0u;
+
+        // Allocations served from a free list without carving a new chunk
+        std::size_t PoolHits = 0u;
+
+        // Allocations too large for any size class, forwarded to the global operator new
+        std::size_t LargeAllocations = 0u;
+
+        // Frames freed on a different thread to the one that owns them
+        std::size_t RemoteFrees = 0u;
+
+        [[nodiscard]] double HitRate() const noexcept
+        {
+            return Allocations == 0u ? 0.0 : static_cast<double>(PoolHits) / static_cast<double>(Allocations);
+        }
+
+        FrameAllocatorStats & operator+=(FrameAllocatorStats const & other) noexcept;
+    };
+
+    /// <summary>
+    /// Per-thread size class pool for coroutine frames
+    /// </summary>
+    /// <remarks>
+    /// Each thread allocates from its own free lists without synchronization. A frame freed on another thread, e.g.
+    /// a task that was stolen by a different worker, is pushed onto the owner's remote free list and reclaimed by the
+    /// owner the next time a free list runs dry. Caches of exited threads are handed to new threads rather than
+    /// destroyed so frames can outlive the thread that allocated them; memory is retained for reuse, not returned
+    /// </remarks>
+    struct PooledFrameAllocator final
+    {
+        // Note: blocks keep the alignment of the global operator new
+        static inline constexpr std::size_t Alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+        static inline constexpr std::size_t SmallestSizeClass = 128u;
+        static inline constexpr std::size_t LargestSizeClass = 4096u;
+
+        [[nodiscard]] static void * Allocate(std::size_t size);
+
+        static void Deallocate(void * ptr, std::size_t size) noexcept;
+
+        // Stats of the calling thread's cache
+        [[nodiscard]] static FrameAllocatorStats ThreadStats() noexcept;
+
+        // Stats summed over all caches
+        [[nodiscard]] static FrameAllocatorStats Stats() noexcept;
+    };
+
+    static_assert(FrameAllocator<PooledFrameAllocator>);
+
+    // Constructs a small object, e.g. a queued schedule item, in memory from the calling thread's pool
+    template <typename T, typename... TArgs>
+    [[nodiscard]] T * PooledNew(TArgs &&... args)
+    {
+        static_assert(alignof(T) <= PooledFrameAllocator::Alignment);
+
+        auto * memory = PooledFrameAllocator::Allocate(sizeof(T));
+        try
+        {
+            return ::new (memory) T(std::forward<TArgs>(args)...);
+        }
+        catch (...)
+        {
+            PooledFrameAllocator::Deallocate(memory, sizeof(T));
+            throw;
+        }
+    }
+
+    // Destroys an object created by PooledNew, can be called from any thread
+    template <typename T>
+    void PooledDelete(T * ptr) noexcept
+    {
+        if (ptr)
+        {
+            std::destroy_at(ptr);
+            PooledFrameAllocator::Deallocate(ptr, sizeof(T));
+        }
+    }
+
+    // Stored after every frame so operator delete knows how the frame was allocated
+    using FrameDeallocateFunction = void (*)(void * frame, std::size_t frameSize) noexcept;
+
+    [[nodiscard]] constexpr std::size_t AlignUp(std::size_t value, std::size_t alignment) noexcept
+    {
+        return (value + alignment - 1u) & ~(alignment - 1u);
+    }
+
+    [[nodiscard]] constexpr std::size_t FrameTrailerOffset(std::size_t frameSize) noexcept
+    {
+        return AlignUp(frameSize, alignof(FrameDeallocateFunction));
+    }
+
+    [[nodiscard]] inline FrameDeallocateFunction & FrameTrailer(void * frame, std::size_t frameSize) noexcept
+    {
+        return *reinterpret_cast<FrameDeallocateFunction *>(static_cast<std::byte *>(frame)
+                                                             + FrameTrailerOffset(frameSize));
+    }
+
+    /// <summary>
+    /// Frames allocated by a FrameAllocator policy
+    /// </summary>
+    template <FrameAllocator TFrameAllocator>
+    struct PolicyFrame final
+    {
+        [[nodiscard]] static constexpr std::size_t TotalSize(std::size_t frameSize) noexcept
+        {
+            return FrameTrailerOffset(frameSize) + sizeof(FrameDeallocateFunction);
+        }
+
+        [[nodiscard]] static void * Allocate(std::size_t frameSize)
+        {
+            auto * frame = TFrameAllocator::Allocate(TotalSize(frameSize));
+            FrameTrailer(frame, frameSize) = &Deallocate;
+            return frame;
+        }
+
+        static void Deallocate(void * frame, std::size_t frameSize) noexcept
+        {
+            TFrameAllocator::Deallocate(frame, TotalSize(frameSize));
+        }
+    };
+
+    // Unit of allocation for allocator-aware frames, keeps frames aligned when the allocator only aligns to its type
+    struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) FrameBlock final
+    {
+        std::byte Data[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+    };
+
+    template <typename TAlloc>
+    [[nodiscard]] auto MakeFrameBlockAllocator(TAlloc const & alloc)
+    {
+        if constexpr (std::is_convertible_v<TAlloc, std::pmr::memory_resource *>)
+        {
+            return std::pmr::polymorphic_allocator<FrameBlock>(alloc);
+        }
+        else
+        {
+            return typename std::allocator_traits<TAlloc>::template rebind_alloc<FrameBlock>(alloc);
+        }
+    }
+
+    /// <summary>
+    /// Frames allocated from an allocator passed to the coroutine after std::allocator_arg
+    /// </summary>
+    /// <remarks>
+    /// A copy of the allocator is stored after the frame so the frame can be freed through it, TAlloc is either an
+    /// allocator of FrameBlock or a polymorphic_allocator
+    /// </remarks>
+    template <typename TAlloc>
+    struct AllocatorFrame final
+    {
+        using traits_type = std::allocator_traits<TAlloc>;
+
+        [[nodiscard]] static constexpr std::size_t AllocatorOffset(std::size_t frameSize) noexcept
+        {
+            return AlignUp(FrameTrailerOffset(frameSize) + sizeof(FrameDeallocateFunction), alignof(TAlloc));
+        }
+
+        [[nodiscard]] static constexpr std::size_t BlockCount(std::size_t frameSize) noexcept
+        {
+            return (AllocatorOffset(frameSize) + sizeof(TAlloc) + sizeof(FrameBlock) - 1u) / sizeof(FrameBlock);
+        }
+
+        [[nodiscard]] static TAlloc & StoredAllocator(void * frame, std::size_t frameSize) noexcept
+        {
+            return *std::launder(
+                reinterpret_cast<TAlloc *>(static_cast<std::byte *>(frame) + AllocatorOffset(frameSize)));
+        }
+
+        [[nodiscard]] static void * Allocate(std::size_t frameSize, TAlloc alloc)
+        {
+            auto * frame = static_cast<void *>(std::to_address(traits_type::allocate(alloc, BlockCount(frameSize))));
+
+            FrameTrailer(frame, frameSize) = &Deallocate;
+            ::new (static_cast<std::byte *>(frame) + AllocatorOffset(frameSize)) TAlloc(std::move(alloc));
+
+            return frame;
+        }
+
+        static void Deallocate(void * frame, std::size_t frameSize) noexcept
+        {
+            auto & stored = StoredAllocator(frame, frameSize);
+            auto alloc = TAlloc(std::move(stored));
+            stored.~TAlloc();
+
+            traits_type::deallocate(alloc, static_cast<FrameBlock *>(frame), BlockCount(frameSize));
+        }
+    };
+
+    template <typename TAlloc>
+    [[nodiscard]] void * AllocateFrame(std::size_t frameSize, TAlloc const & alloc)
+    {
+        using block_allocator_type = decltype(MakeFrameBlockAllocator(alloc));
+        return AllocatorFrame<block_allocator_type>::Allocate(frameSize, MakeFrameBlockAllocator(alloc));
+    }
+
+    inline void DeallocateFrame(void * frame, std::size_t frameSize) noexcept
+    {
+        FrameTrailer(frame, frameSize)(frame, frameSize);
+    }
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
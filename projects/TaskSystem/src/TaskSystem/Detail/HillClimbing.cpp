@@ -0,0 +1,61 @@
+#include <TaskSystem/Detail/HillClimbing.hpp>
+
+#include <algorithm>
+
+
+namespace TaskSystem::Detail
+{
+
+    HillClimbing::HillClimbing(std::size_t minWorkers, std::size_t maxWorkers, std::size_t maxRunning) noexcept
+      : minWorkers(std::max<std::size_t>(minWorkers, 1u))
+      , maxWorkers(std::max(maxWorkers, this->minWorkers))
+      , maxRunning(std::max<std::size_t>(maxRunning, 1u))
+      , lastThroughput(0.0)
+      , lastMove(0)
+      , hold(0u)
+    { }
+
+    std::size_t HillClimbing::Update(PoolSample const & sample) noexcept
+    {
+        auto workers = sample.Workers;
+        auto running = workers - std::min(sample.Blocked, workers);
+
+        // Note: an explicit worker count above the quota is kept, it is only never grown past
+        auto wanted = std::min(minWorkers, maxRunning);
+        auto ceiling = std::max(minWorkers, maxRunning);
+
+        auto worse = sample.Throughput < lastThroughput * (1.0 - ChangeThreshold);
+        auto better = sample.Throughput > lastThroughput * (1.0 + ChangeThreshold);
+
+        auto target = workers;
+
+        if (running < wanted && sample.Backlog)
+        {
+            target = std::min(maxWorkers, workers + (wanted - running));
+        }
+        else if (running > ceiling)
+        {
+            // Blocked workers came back while their replacements were running
+            target = workers - 1u;
+        }
+        else if (hold > 0u)
+        {
+            --hold;
+        }
+        else if (lastMove < 0 && worse && sample.Backlog && running < maxRunning && workers < maxWorkers)
+        {
+            target = workers + 1u;
+            hold = HoldSamples;
+        }
+        else if (running > minWorkers && !(lastMove > 0 && better))
+        {
+            target = workers - 1u;
+        }
+
+        lastMove = target > workers ? 1 : target < workers ? -1 : 0;
+        lastThroughput = sample.Throughput;
+
+        return target;
+    }
+
+}  // namespace TaskSystem::Detail
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace TaskSystem::Detail
+{
+
+    struct PoolSample final
+    {
+        // Items completed per second since the previous sample
+        double Throughput = 0.0;
+
+        // Workers running, blocked or not
+        std::size_t Workers = 0u;
+
+        // Workers stuck on the same item for longer than the blocked threshold
+        std::size_t Blocked = 0u;
+
+        // Work is waiting in the queues
+        bool Backlog = false;
+    };
+
+    /// <summary>
+    /// Decides how many workers an elastic pool should run from one sample to the next
+    /// </summary>
+    /// <remarks>
+    /// In the spirit of the .NET thread pool's hill climbing, much simplified. Blocked workers are replaced one for one
+    /// while work is waiting, as long as the workers that are not blocked stay within maxRunning, e.g. the CPU quota.
+    /// Once the extra workers are no longer needed to replace blocked ones they are retired one per sample, unless the
+    /// worker added last is still paying for itself; a retirement that costs throughput while work is waiting is
+    /// undone and the count held for HoldSamples before it probes downwards again
+    /// </remarks>
+    class HillClimbing final
+    {
+    public:
+        // Throughput has to move by this fraction to count as better or worse
+        static inline constexpr double ChangeThreshold = 0.05;
+
+        static inline constexpr std::uint32_t HoldSamples = 8u;
+
+    private:
+        std::size_t minWorkers;
+        std::size_t maxWorkers;
+        std::size_t maxRunning;
+
+        double lastThroughput;
+        int lastMove;
+        std::uint32_t hold;
+
+    public:
+        HillClimbing(std::size_t minWorkers, std::size_t maxWorkers, std::size_t maxRunning) noexcept;
+
+        // Returns the number of workers to run until the next sample
+        [[nodiscard]] std::size_t Update(PoolSample const & sample) noexcept;
+    };
+
+}  // namespace TaskSystem::Detail
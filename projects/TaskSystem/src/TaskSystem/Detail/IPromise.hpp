@@ -2,10 +2,13 @@
 
 #include <TaskSystem/Detail/AddContinuationResult.hpp>
 #include <TaskSystem/Detail/Continuations.hpp>
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
 #include <TaskSystem/Detail/SetFaultedResult.hpp>
 #include <TaskSystem/Detail/SetRunningResult.hpp>
 #include <TaskSystem/Detail/SetScheduledResult.hpp>
 #include <TaskSystem/Detail/SetSuspendedResult.hpp>
+#include <TaskSystem/Deadline.hpp>
+#include <TaskSystem/TaskPriority.hpp>
 #include <TaskSystem/TaskState.hpp>
 
 #include <exception>
@@ -17,11 +20,32 @@ class TaskSystem::ITaskScheduler;
 namespace TaskSystem::Detail
 {
 
-    class IPromise
+    class IPromise;
+
+    /// <summary>
+    /// Queue hook of anything an item inbox holds, a promise or a boxed schedule item
+    /// </summary>
+    /// <remarks>
+    /// Both kinds share one FIFO queue, so the inbox asks each node what it is when popping it
+    /// </remarks>
+    class InboxHook : public QueueHook
+    {
+    public:
+        // Returns the promise if this node is one; otherwise nullptr
+        [[nodiscard]] virtual IPromise * AsPromise() noexcept { return nullptr; }
+
+    protected:
+        ~InboxHook() noexcept = default;
+    };
+
+    // Note: the InboxHook lets schedulers queue a promise without allocating a node
+    class IPromise : public InboxHook
     {
     public:
         virtual ~IPromise() noexcept = default;
 
+        [[nodiscard]] IPromise * AsPromise() noexcept override final { return this; }
+
         [[nodiscard]] virtual TaskState State() const noexcept = 0;
 
         [[nodiscard]] virtual std::coroutine_handle<> Handle() noexcept = 0;
@@ -32,7 +56,9 @@ namespace TaskSystem::Detail
 
         [[nodiscard]] virtual Detail::Continuations & Continuations() noexcept = 0;
 
-        [[nodiscard]] virtual AddContinuationResult TryAddContinuation(Detail::Continuation value) noexcept = 0;
+        // Adds without allocating, the node must stay alive until the continuation is scheduled. Fails with
+        // PromiseCompleted or PromiseFaulted once the promise has completed so the awaiter can resume inline
+        [[nodiscard]] virtual AddContinuationResult TryAddContinuation(Detail::ContinuationNode & node) noexcept = 0;
 
         // ToDo:
         // [[nodiscard]] virtual RemoveContinuationResult TryRemoveContinuation(Detail::Continuation value) noexcept = 0;
@@ -43,6 +69,12 @@ namespace TaskSystem::Detail
         [[nodiscard]] virtual ITaskScheduler * TaskScheduler() const noexcept { return nullptr; }
         virtual void TaskScheduler(ITaskScheduler * value) noexcept { }
 
+        [[nodiscard]] virtual TaskPriority Priority() const noexcept { return TaskPriority::Normal; }
+        virtual void Priority(TaskPriority value) noexcept { }
+
+        [[nodiscard]] virtual DeadlineClock::time_point Deadline() const noexcept { return NoDeadline; }
+        virtual void Deadline(DeadlineClock::time_point value) noexcept { }
+
         [[nodiscard]] virtual SetScheduledResult TrySetScheduled() noexcept = 0;
 
         [[nodiscard]] virtual SetRunningResult TrySetRunning() noexcept = 0;
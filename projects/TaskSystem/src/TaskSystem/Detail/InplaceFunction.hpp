@@ -0,0 +1,183 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+namespace TaskSystem::Detail
+{
+
+    template <typename TSignature, std::size_t TCapacity = 6u * sizeof(void *)>
+    class InplaceFunction;
+
+    /// <summary>
+    /// Move-only type-erased callable that stores small callables inline
+    /// </summary>
+    /// <remarks>
+    /// Unlike std::function the callable only has to be movable. Callables up to TCapacity bytes, with at most pointer
+    /// alignment and a non-throwing move are stored inline, anything else falls back to the heap
+    /// </remarks>
+    template <typename TResult, typename... TArgs, std::size_t TCapacity>
+    class InplaceFunction<TResult(TArgs...), TCapacity> final
+    {
+    public:
+        static inline constexpr std::size_t Capacity = TCapacity;
+        static inline constexpr std::size_t Alignment = alignof(void *);
+
+        template <typename TFunc>
+        static inline constexpr bool FitsInline = sizeof(TFunc) <= Capacity && alignof(TFunc) <= Alignment
+                                               && std::is_nothrow_move_constructible_v<TFunc>;
+
+    private:
+        static_assert(Capacity >= sizeof(void *), "Capacity must be able to hold a pointer to a heap callable");
+
+        struct VTable final
+        {
+            using invoke_m = TResult (*)(void *, TArgs &&...);
+            using relocate_m = void (*)(void *, void *) noexcept;
+            using destroy_m = void (*)(void *) noexcept;
+
+            invoke_m invoke;
+            relocate_m relocate;
+            destroy_m destroy;
+        };
+
+        // Inline callables live in the storage, heap callables store a pointer to themselves in it
+        template <typename TFunc>
+        struct Adapter final
+        {
+            [[nodiscard]] static TFunc * Target(void * storage) noexcept
+            {
+                if constexpr (FitsInline<TFunc>)
+                {
+                    return std::launder(static_cast<TFunc *>(storage));
+                }
+                else
+                {
+                    return *std::launder(static_cast<TFunc **>(storage));
+                }
+            }
+
+            static TResult Invoke(void * storage, TArgs &&... args)
+            {
+                return std::invoke(*Target(storage), std::forward<TArgs>(args)...);
+            }
+
+            static void Relocate(void * from, void * to) noexcept
+            {
+                if constexpr (FitsInline<TFunc>)
+                {
+                    auto * func = Target(from);
+                    ::new (to) TFunc(std::move(*func));
+                    std::destroy_at(func);
+                }
+                else
+                {
+                    ::new (to) TFunc *(Target(from));
+                }
+            }
+
+            static void Destroy(void * storage) noexcept
+            {
+                if constexpr (FitsInline<TFunc>)
+                {
+                    std::destroy_at(Target(storage));
+                }
+                else
+                {
+                    delete Target(storage);
+                }
+            }
+
+            static inline constexpr VTable Value{ &Invoke, &Relocate, &Destroy };
+        };
+
+        alignas(Alignment) std::byte storage[Capacity];
+        VTable const * vtable = nullptr;
+
+    public:
+        InplaceFunction() noexcept = default;
+
+        InplaceFunction(std::nullptr_t) noexcept { }
+
+        template <typename TFunc>
+            requires(!std::same_as<std::remove_cvref_t<TFunc>, InplaceFunction>
+                     && std::is_invocable_r_v<TResult, std::decay_t<TFunc> &, TArgs...>)
+        InplaceFunction(TFunc && func)
+        {
+            using func_type = std::decay_t<TFunc>;
+
+            if constexpr (std::is_pointer_v<func_type> || std::is_member_pointer_v<func_type>)
+            {
+                if (func == nullptr)
+                {
+                    return;
+                }
+            }
+
+            if constexpr (FitsInline<func_type>)
+            {
+                ::new (static_cast<void *>(storage)) func_type(std::forward<TFunc>(func));
+            }
+            else
+            {
+                ::new (static_cast<void *>(storage)) func_type *(new func_type(std::forward<TFunc>(func)));
+            }
+
+            vtable = &Adapter<func_type>::Value;
+        }
+
+        InplaceFunction(InplaceFunction const &) = delete;
+        InplaceFunction & operator=(InplaceFunction const &) = delete;
+
+        InplaceFunction(InplaceFunction && other) noexcept : vtable(std::exchange(other.vtable, nullptr))
+        {
+            if (vtable)
+            {
+                vtable->relocate(other.storage, storage);
+            }
+        }
+
+        InplaceFunction & operator=(InplaceFunction && other) noexcept
+        {
+            if (std::addressof(other) == this)
+            {
+                return *this;
+            }
+
+            Reset();
+
+            vtable = std::exchange(other.vtable, nullptr);
+            if (vtable)
+            {
+                vtable->relocate(other.storage, storage);
+            }
+
+            return *this;
+        }
+
+        ~InplaceFunction() noexcept { Reset(); }
+
+        [[nodiscard]] explicit operator bool() const noexcept { return vtable != nullptr; }
+
+        /// <summary>
+        /// Invokes the callable, must not be empty
+        /// </summary>
+        TResult operator()(TArgs... args) { return vtable->invoke(storage, std::forward<TArgs>(args)...); }
+
+    private:
+        void Reset() noexcept
+        {
+            if (vtable)
+            {
+                std::exchange(vtable, nullptr)->destroy(storage);
+            }
+        }
+    };
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
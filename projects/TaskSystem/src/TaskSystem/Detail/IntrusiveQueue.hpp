@@ -0,0 +1,311 @@
+#pragma once
+
+#include <TaskSystem/AtomicLockGuard.hpp>
+#include <TaskSystem/Detail/Utils.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+
+namespace TaskSystem::Detail
+{
+
+    template <typename T>
+    class IntrusiveList;
+
+    template <typename T>
+    class IntrusiveMpscQueue;
+
+    /// <summary>
+    /// Link embedded in items that can be put on an intrusive queue
+    /// </summary>
+    /// <remarks>
+    /// An item can only be on one queue at a time, for promises this is guaranteed by the transition to Scheduled
+    /// </remarks>
+    class QueueHook
+    {
+    private:
+        template <typename T>
+        friend class IntrusiveList;
+
+        template <typename T>
+        friend class IntrusiveMpscQueue;
+
+        std::atomic<QueueHook *> next = nullptr;
+
+    public:
+        QueueHook() noexcept = default;
+
+        // Note: the link belongs to the queue, copies start unlinked
+        QueueHook(QueueHook const &) noexcept : next(nullptr) { }
+        QueueHook & operator=(QueueHook const &) noexcept { return *this; }
+    };
+
+    template <typename T>
+    concept QueueHooked = std::derived_from<T, QueueHook>;
+
+    /// <summary>
+    /// Single-threaded intrusive FIFO list, used to gather items before they are pushed onto a queue together
+    /// </summary>
+    /// <remarks>
+    /// Items are linked through the same hook as the queues, an item must not be on a list and a queue at the same time
+    /// </remarks>
+    template <typename T>
+    class IntrusiveList final
+    {
+    private:
+        template <typename U>
+        friend class IntrusiveMpscQueue;
+
+        QueueHook * head = nullptr;
+        QueueHook * tail = nullptr;
+        size_t size = 0u;
+
+    public:
+        IntrusiveList() noexcept = default;
+
+        IntrusiveList(IntrusiveList const &) = delete;
+        IntrusiveList & operator=(IntrusiveList const &) = delete;
+
+        IntrusiveList(IntrusiveList && other) noexcept
+          : head(std::exchange(other.head, nullptr))
+          , tail(std::exchange(other.tail, nullptr))
+          , size(std::exchange(other.size, 0u))
+        { }
+
+        // Note: items still on this list are dropped, the list does not own them
+        IntrusiveList & operator=(IntrusiveList && other) noexcept
+        {
+            if (this != &other)
+            {
+                head = std::exchange(other.head, nullptr);
+                tail = std::exchange(other.tail, nullptr);
+                size = std::exchange(other.size, 0u);
+            }
+            return *this;
+        }
+
+        ~IntrusiveList() noexcept = default;
+
+        [[nodiscard]] bool Empty() const noexcept { return head == nullptr; }
+
+        [[nodiscard]] size_t Size() const noexcept { return size; }
+
+        void PushBack(T & item) noexcept
+        {
+            static_assert(QueueHooked<T>, "IntrusiveList items must derive from QueueHook");
+
+            QueueHook * hook = &item;
+            hook->next.store(nullptr, std::memory_order_relaxed);
+
+            if (tail)
+            {
+                tail->next.store(hook, std::memory_order_relaxed);
+            }
+            else
+            {
+                head = hook;
+            }
+
+            tail = hook;
+            ++size;
+        }
+
+        [[nodiscard]] T * PopFront() noexcept
+        {
+            if (head == nullptr)
+            {
+                return nullptr;
+            }
+
+            auto * first = std::exchange(head, head->next.load(std::memory_order_relaxed));
+            if (head == nullptr)
+            {
+                tail = nullptr;
+            }
+
+            --size;
+            return static_cast<T *>(first);
+        }
+    };
+
+    /// <summary>
+    /// Intrusive multi-producer single-consumer FIFO queue
+    /// </summary>
+    /// <remarks>
+    /// Vyukov's intrusive MPSC queue: Push is one exchange and one store and never allocates. Pop can return nullptr
+    /// while a producer is between those two steps, the item becomes visible once the producer finishes
+    /// </remarks>
+    template <typename T>
+    class IntrusiveMpscQueue final
+    {
+    private:
+#pragma warning(disable : 4324)
+        // Disable: warning C4324: structure was padded due to alignment specifier
+        // head is written by producers and tail by the consumer, keep them on separate cache lines
+        alignas(CacheLineSize) std::atomic<QueueHook *> head;
+        alignas(CacheLineSize) QueueHook * tail;
+#pragma warning(default : 4324)
+
+        QueueHook stub;
+
+    public:
+        IntrusiveMpscQueue() noexcept : head(&stub), tail(&stub), stub() { }
+
+        IntrusiveMpscQueue(IntrusiveMpscQueue const &) = delete;
+        IntrusiveMpscQueue & operator=(IntrusiveMpscQueue const &) = delete;
+
+        IntrusiveMpscQueue(IntrusiveMpscQueue &&) = delete;
+        IntrusiveMpscQueue & operator=(IntrusiveMpscQueue &&) = delete;
+
+        ~IntrusiveMpscQueue() noexcept = default;
+
+        /// <summary>
+        /// Approximate, must only be called by the single consumer
+        /// </summary>
+        [[nodiscard]] bool Empty() const noexcept
+        {
+            return tail == &stub && stub.next.load(std::memory_order_acquire) == nullptr;
+        }
+
+        /// <summary>
+        /// Pushes an item onto the back of the queue, can be called from any thread
+        /// </summary>
+        void Push(T & item) noexcept
+        {
+            static_assert(QueueHooked<T>, "IntrusiveMpscQueue items must derive from QueueHook");
+            Push(static_cast<QueueHook *>(&item));
+        }
+
+        /// <summary>
+        /// Pushes all the items on the list onto the back of the queue with a single exchange, can be called from any
+        /// thread
+        /// </summary>
+        template <std::derived_from<T> U>
+        void Push(IntrusiveList<U> && list) noexcept
+        {
+            if (list.Empty())
+            {
+                return;
+            }
+
+            // Note: the list is already linked, publishing its head makes every item visible to the consumer
+            auto * first = std::exchange(list.head, nullptr);
+            auto * last = std::exchange(list.tail, nullptr);
+            list.size = 0u;
+
+            auto * previous = head.exchange(last, std::memory_order_acq_rel);
+            previous->next.store(first, std::memory_order_release);
+        }
+
+        /// <summary>
+        /// Pops the item at the front of the queue, must only be called by the single consumer
+        /// </summary>
+        [[nodiscard]] T * Pop() noexcept
+        {
+            auto * first = tail;
+            auto * next = first->next.load(std::memory_order_acquire);
+
+            if (first == &stub)
+            {
+                if (next == nullptr)
+                {
+                    return nullptr;
+                }
+
+                // Skip over the stub
+                tail = next;
+                first = next;
+                next = next->next.load(std::memory_order_acquire);
+            }
+
+            if (next != nullptr)
+            {
+                tail = next;
+                return static_cast<T *>(first);
+            }
+
+            if (first != head.load(std::memory_order_acquire))
+            {
+                // A producer has exchanged head but not linked its item yet
+                return nullptr;
+            }
+
+            // first is the last item, put the stub back behind it so first can be unlinked
+            Push(&stub);
+
+            next = first->next.load(std::memory_order_acquire);
+            if (next != nullptr)
+            {
+                tail = next;
+                return static_cast<T *>(first);
+            }
+
+            return nullptr;
+        }
+
+    private:
+        void Push(QueueHook * hook) noexcept
+        {
+            hook->next.store(nullptr, std::memory_order_relaxed);
+            auto * previous = head.exchange(hook, std::memory_order_acq_rel);
+            previous->next.store(hook, std::memory_order_release);
+        }
+    };
+
+    /// <summary>
+    /// Intrusive multi-producer multi-consumer FIFO queue
+    /// </summary>
+    /// <remarks>
+    /// Producers are lock-free as for IntrusiveMpscQueue, consumers take turns through a spin lock
+    /// </remarks>
+    template <typename T>
+    class IntrusiveMpmcQueue final
+    {
+    private:
+        IntrusiveMpscQueue<T> queue;
+
+#pragma warning(disable : 4324)
+        // Disable: warning C4324: structure was padded due to alignment specifier
+        alignas(CacheLineSize) mutable std::atomic<bool> popFlag;
+#pragma warning(default : 4324)
+
+    public:
+        IntrusiveMpmcQueue() noexcept : queue(), popFlag(false) { }
+
+        IntrusiveMpmcQueue(IntrusiveMpmcQueue const &) = delete;
+        IntrusiveMpmcQueue & operator=(IntrusiveMpmcQueue const &) = delete;
+
+        IntrusiveMpmcQueue(IntrusiveMpmcQueue &&) = delete;
+        IntrusiveMpmcQueue & operator=(IntrusiveMpmcQueue &&) = delete;
+
+        ~IntrusiveMpmcQueue() noexcept = default;
+
+        /// <summary>
+        /// Approximate, exact only when there are no concurrent producers
+        /// </summary>
+        [[nodiscard]] bool Empty() const noexcept
+        {
+            std::lock_guard lock(popFlag);
+            return queue.Empty();
+        }
+
+        void Push(T & item) noexcept { queue.Push(item); }
+
+        template <std::derived_from<T> U>
+        void Push(IntrusiveList<U> && list) noexcept
+        {
+            queue.Push(std::move(list));
+        }
+
+        [[nodiscard]] T * Pop() noexcept
+        {
+            std::lock_guard lock(popFlag);
+            return queue.Pop();
+        }
+    };
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <sys/socket.h>
+
+
+namespace TaskSystem
+{
+    class ITaskScheduler;
+}
+
+namespace TaskSystem::Detail
+{
+
+    class IPromise;
+
+    enum class IoOperationKind : std::uint8_t
+    {
+        Read,
+        Write,
+        Accept,
+        Connect,
+        Fsync
+    };
+
+    /// <summary>
+    /// An I/O request and its result
+    /// </summary>
+    /// <remarks>
+    /// Lives in the awaiting coroutine's frame so submitting does not allocate. The hook queues it on the scheduler's
+    /// inbox and on the list of completions, it is only on one of them at a time
+    /// </remarks>
+    struct IoOperation final : QueueHook
+    {
+        // Reads or writes at the file's current position, as read and write do
+        static inline constexpr std::uint64_t CurrentOffset = ~std::uint64_t(0u);
+
+        IoOperationKind Kind = IoOperationKind::Read;
+        int Fd = -1;
+
+        void * Buffer = nullptr;
+        std::size_t Length = 0u;
+        std::uint64_t Offset = CurrentOffset;
+
+        sockaddr const * Address = nullptr;
+        socklen_t AddressLength = 0u;
+
+        // Bytes transferred or the accepted fd, -errno on failure
+        std::int32_t Result = 0;
+
+        IPromise * Caller = nullptr;
+        ITaskScheduler * Scheduler = nullptr;
+
+        // Note: used by the fallback to queue operations waiting for the same fd to become ready
+        IoOperation * NextWaiter = nullptr;
+    };
+
+    /// <summary>
+    /// Where the scheduler's operations are carried out, only used by the loop thread apart from Wake
+    /// </summary>
+    class IIoBackend
+    {
+    public:
+        virtual ~IIoBackend() noexcept = default;
+
+        // Queues the operation, its completion is returned by a later Process
+        virtual void Submit(IoOperation & operation) noexcept = 0;
+
+        // Starts the queued operations and returns those that have completed, when wait is set blocks until one
+        // completes, Wake is called or the deadline passes
+        [[nodiscard]] virtual IntrusiveList<IoOperation> Process(
+            bool wait, std::chrono::steady_clock::time_point const * deadline) noexcept = 0;
+
+        // Ends a blocking Process early, can be called from any thread
+        virtual void Wake() noexcept = 0;
+
+        [[nodiscard]] virtual bool IsIoUring() const noexcept = 0;
+    };
+
+}  // namespace TaskSystem::Detail
+
+#endif
@@ -0,0 +1,404 @@
+#include <TaskSystem/Detail/IoUringBackend.hpp>
+
+#if defined(__linux__)
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+#include <linux/io_uring.h>
+#include <linux/time_types.h>
+#include <signal.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+namespace TaskSystem::Detail
+{
+
+    namespace
+    {
+        // Note: operations are never at address zero, so it tags the eventfd read
+        constexpr std::uint64_t WakeTag = 0u;
+
+        // Largest transfer a single read or write does on Linux
+        constexpr std::size_t MaxTransfer = 0x7ffff000u;
+
+        int SetupRing(std::uint32_t entries, io_uring_params & params) noexcept
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        }
+
+        int EnterRing(int ring, unsigned toSubmit, unsigned minComplete, unsigned flags, void * arg, std::size_t argSize)
+            noexcept
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, ring, toSubmit, minComplete, flags, arg, argSize));
+        }
+
+        void * Map(int ring, std::size_t size, off_t offset) noexcept
+        {
+            auto * memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, offset);
+            return memory == MAP_FAILED ? nullptr : memory;
+        }
+
+        template <typename T>
+        T * At(void * ring, std::uint32_t offset) noexcept
+        {
+            return reinterpret_cast<T *>(static_cast<std::byte *>(ring) + offset);
+        }
+
+    }  // namespace
+
+    IoUringBackend::IoUringBackend() noexcept
+      : ring(-1)
+      , wakeFd(-1)
+      , sqRing(nullptr)
+      , sqRingSize(0u)
+      , cqRing(nullptr)
+      , cqRingSize(0u)
+      , sqes(nullptr)
+      , sqesSize(0u)
+      , sqHead(nullptr)
+      , sqTail(nullptr)
+      , sqArray(nullptr)
+      , sqMask(0u)
+      , sqEntries(0u)
+      , cqHead(nullptr)
+      , cqTail(nullptr)
+      , cqes(nullptr)
+      , cqMask(0u)
+      , sqLocalTail(0u)
+      , unsubmitted(0u)
+      , backlog()
+      , wakeValue(0u)
+      , wakeArmed(false)
+    { }
+
+    std::unique_ptr<IoUringBackend> IoUringBackend::TryCreate(std::uint32_t entries) noexcept
+    {
+        auto backend = std::unique_ptr<IoUringBackend>(new (std::nothrow) IoUringBackend());
+        if (!backend || !backend->Setup(entries))
+        {
+            return nullptr;
+        }
+
+        return backend;
+    }
+
+    IoUringBackend::~IoUringBackend() noexcept
+    {
+        // Note: closing the ring cancels what is still in flight, including the eventfd read
+        if (ring >= 0)
+        {
+            ::close(ring);
+        }
+
+        if (sqes)
+        {
+            ::munmap(sqes, sqesSize);
+        }
+
+        if (cqRing && cqRing != sqRing)
+        {
+            ::munmap(cqRing, cqRingSize);
+        }
+
+        if (sqRing)
+        {
+            ::munmap(sqRing, sqRingSize);
+        }
+
+        if (wakeFd >= 0)
+        {
+            ::close(wakeFd);
+        }
+    }
+
+    void IoUringBackend::Submit(IoOperation & operation) noexcept
+    {
+        if (backlog.Empty())
+        {
+            if (TryPrepare(operation))
+            {
+                return;
+            }
+
+            // The SQ ring is full, hand it to the kernel to make room
+            Enter(false, nullptr);
+            if (TryPrepare(operation))
+            {
+                return;
+            }
+        }
+
+        backlog.PushBack(operation);
+    }
+
+    IntrusiveList<IoOperation> IoUringBackend::Process(bool wait, std::chrono::steady_clock::time_point const * deadline)
+        noexcept
+    {
+        auto completed = IntrusiveList<IoOperation>();
+        Harvest(completed);
+
+        auto pending = std::move(backlog);
+        while (auto * operation = pending.PopFront())
+        {
+            if (!TryPrepare(*operation))
+            {
+                Enter(false, nullptr);
+                if (!TryPrepare(*operation))
+                {
+                    backlog.PushBack(*operation);
+                    while ((operation = pending.PopFront()))
+                    {
+                        backlog.PushBack(*operation);
+                    }
+                }
+            }
+        }
+
+        if (!wakeArmed)
+        {
+            PrepareWakeRead();
+        }
+
+        // Note: submitting and waiting share one syscall
+        Enter(wait && completed.Empty(), deadline);
+        Harvest(completed);
+
+        return completed;
+    }
+
+    void IoUringBackend::Wake() noexcept
+    {
+        auto one = std::uint64_t(1u);
+        [[maybe_unused]] auto _ = ::write(wakeFd, &one, sizeof(one));
+    }
+
+    bool IoUringBackend::Setup(std::uint32_t entries) noexcept
+    {
+        auto params = io_uring_params();
+        ring = SetupRing(entries, params);
+        if (ring < 0)
+        {
+            return false;
+        }
+
+        // Timed waits need EXT_ARG, and NODROP keeps completions when the CQ ring overflows
+        if ((params.features & IORING_FEAT_EXT_ARG) == 0u || (params.features & IORING_FEAT_NODROP) == 0u)
+        {
+            return false;
+        }
+
+        sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+        auto singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0u;
+        if (singleMap)
+        {
+            sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+        }
+
+        sqRing = Map(ring, sqRingSize, IORING_OFF_SQ_RING);
+        if (!sqRing)
+        {
+            return false;
+        }
+
+        cqRing = singleMap ? sqRing : Map(ring, cqRingSize, IORING_OFF_CQ_RING);
+        if (!cqRing)
+        {
+            return false;
+        }
+
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe *>(Map(ring, sqesSize, IORING_OFF_SQES));
+        if (!sqes)
+        {
+            return false;
+        }
+
+        sqHead = At<unsigned>(sqRing, params.sq_off.head);
+        sqTail = At<unsigned>(sqRing, params.sq_off.tail);
+        sqArray = At<unsigned>(sqRing, params.sq_off.array);
+        sqMask = *At<unsigned>(sqRing, params.sq_off.ring_mask);
+        sqEntries = params.sq_entries;
+
+        cqHead = At<unsigned>(cqRing, params.cq_off.head);
+        cqTail = At<unsigned>(cqRing, params.cq_off.tail);
+        cqes = At<io_uring_cqe>(cqRing, params.cq_off.cqes);
+        cqMask = *At<unsigned>(cqRing, params.cq_off.ring_mask);
+
+        sqLocalTail = *sqTail;
+
+        wakeFd = ::eventfd(0u, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (wakeFd < 0)
+        {
+            return false;
+        }
+
+        PrepareWakeRead();
+        return wakeArmed;
+    }
+
+    io_uring_sqe * IoUringBackend::NextSqe() noexcept
+    {
+        auto head = std::atomic_ref<unsigned>(*sqHead).load(std::memory_order_acquire);
+        if (sqLocalTail - head >= sqEntries)
+        {
+            return nullptr;
+        }
+
+        auto index = sqLocalTail & sqMask;
+        auto * sqe = &sqes[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqArray[index] = index;
+
+        ++sqLocalTail;
+        ++unsubmitted;
+        return sqe;
+    }
+
+    bool IoUringBackend::TryPrepare(IoOperation & operation) noexcept
+    {
+        auto * sqe = NextSqe();
+        if (!sqe)
+        {
+            return false;
+        }
+
+        sqe->fd = operation.Fd;
+        sqe->user_data = reinterpret_cast<std::uint64_t>(&operation);
+
+        switch (operation.Kind)
+        {
+        case IoOperationKind::Read:
+        case IoOperationKind::Write:
+            sqe->opcode = operation.Kind == IoOperationKind::Read ? IORING_OP_READ : IORING_OP_WRITE;
+            sqe->addr = reinterpret_cast<std::uint64_t>(operation.Buffer);
+            sqe->len = static_cast<std::uint32_t>(std::min(operation.Length, MaxTransfer));
+            sqe->off = operation.Offset;
+            break;
+
+        case IoOperationKind::Accept:
+            sqe->opcode = IORING_OP_ACCEPT;
+            sqe->accept_flags = SOCK_CLOEXEC;
+            break;
+
+        case IoOperationKind::Connect:
+            sqe->opcode = IORING_OP_CONNECT;
+            sqe->addr = reinterpret_cast<std::uint64_t>(operation.Address);
+            sqe->off = operation.AddressLength;
+            break;
+
+        case IoOperationKind::Fsync:
+            sqe->opcode = IORING_OP_FSYNC;
+            break;
+        }
+
+        return true;
+    }
+
+    void IoUringBackend::PrepareWakeRead() noexcept
+    {
+        auto * sqe = NextSqe();
+        if (!sqe)
+        {
+            // Note: retried on the next Process, until then Wake only ends waits once this is armed
+            return;
+        }
+
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = wakeFd;
+        sqe->addr = reinterpret_cast<std::uint64_t>(&wakeValue);
+        sqe->len = sizeof(wakeValue);
+        sqe->user_data = WakeTag;
+
+        wakeArmed = true;
+    }
+
+    void IoUringBackend::Enter(bool wait, std::chrono::steady_clock::time_point const * deadline) noexcept
+    {
+        // Pairs with the kernel's acquire of the tail, the SQEs written above are visible to it
+        std::atomic_ref<unsigned>(*sqTail).store(sqLocalTail, std::memory_order_release);
+
+        auto flags = 0u;
+        auto minComplete = 0u;
+        auto timeout = __kernel_timespec();
+        auto arg = io_uring_getevents_arg();
+
+        if (wait && deadline)
+        {
+            auto remaining = *deadline - std::chrono::steady_clock::now();
+            if (remaining <= std::chrono::steady_clock::duration::zero())
+            {
+                wait = false;
+            }
+            else
+            {
+                auto seconds = std::chrono::duration_cast<std::chrono::seconds>(remaining);
+                timeout.tv_sec = seconds.count();
+                timeout.tv_nsec = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining - seconds).count();
+
+                arg.sigmask_sz = _NSIG / 8;
+                arg.ts = reinterpret_cast<std::uint64_t>(&timeout);
+                flags |= IORING_ENTER_EXT_ARG;
+            }
+        }
+
+        if (wait)
+        {
+            flags |= IORING_ENTER_GETEVENTS;
+            minComplete = 1u;
+        }
+        else if (unsubmitted == 0u)
+        {
+            return;
+        }
+
+        auto useArg = (flags & IORING_ENTER_EXT_ARG) != 0u;
+        auto result = EnterRing(
+            ring, unsubmitted, minComplete, flags, useArg ? &arg : nullptr, useArg ? sizeof(arg) : 0u);
+
+        // Note: EINTR, ETIME and EBUSY leave the unsubmitted SQEs in the ring for the next call
+        if (result > 0)
+        {
+            unsubmitted -= std::min(static_cast<unsigned>(result), unsubmitted);
+        }
+    }
+
+    void IoUringBackend::Harvest(IntrusiveList<IoOperation> & completed) noexcept
+    {
+        auto head = *cqHead;
+        auto tail = std::atomic_ref<unsigned>(*cqTail).load(std::memory_order_acquire);
+
+        for (; head != tail; ++head)
+        {
+            auto & cqe = cqes[head & cqMask];
+            if (cqe.user_data == WakeTag)
+            {
+                wakeArmed = false;
+                continue;
+            }
+
+            auto * operation = reinterpret_cast<IoOperation *>(cqe.user_data);
+            operation->Result = cqe.res;
+            completed.PushBack(*operation);
+        }
+
+        // Note: the entries are released before any caller runs, resumed callers can submit straight away
+        std::atomic_ref<unsigned>(*cqHead).store(head, std::memory_order_release);
+
+        if (!wakeArmed)
+        {
+            PrepareWakeRead();
+        }
+    }
+
+}  // namespace TaskSystem::Detail
+
+#endif
@@ -0,0 +1,97 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/Detail/IoOperation.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+struct io_uring_cqe;
+struct io_uring_sqe;
+
+
+namespace TaskSystem::Detail
+{
+
+    /// <summary>
+    /// Runs operations on an io_uring through the raw syscalls
+    /// </summary>
+    /// <remarks>
+    /// Submissions are batched into the SQ ring and sent with the next Process, which also waits for and harvests
+    /// completions in the same io_uring_enter. Wake completes a read on an eventfd that is kept in flight
+    /// </remarks>
+    class IoUringBackend final : public IIoBackend
+    {
+    private:
+        int ring;
+        int wakeFd;
+
+        void * sqRing;
+        std::size_t sqRingSize;
+        void * cqRing;
+        std::size_t cqRingSize;
+        io_uring_sqe * sqes;
+        std::size_t sqesSize;
+
+        unsigned * sqHead;
+        unsigned * sqTail;
+        unsigned * sqArray;
+        unsigned sqMask;
+        unsigned sqEntries;
+
+        unsigned * cqHead;
+        unsigned * cqTail;
+        io_uring_cqe * cqes;
+        unsigned cqMask;
+
+        // Tail of SQEs written but not yet published to the kernel
+        unsigned sqLocalTail;
+        unsigned unsubmitted;
+
+        // Operations that did not fit in the SQ ring
+        IntrusiveList<IoOperation> backlog;
+
+        std::uint64_t wakeValue;
+        bool wakeArmed;
+
+        IoUringBackend() noexcept;
+
+    public:
+        // Returns null when io_uring is not available, e.g. an old kernel or a seccomp filter
+        [[nodiscard]] static std::unique_ptr<IoUringBackend> TryCreate(std::uint32_t entries) noexcept;
+
+        IoUringBackend(IoUringBackend const &) = delete;
+        IoUringBackend & operator=(IoUringBackend const &) = delete;
+
+        IoUringBackend(IoUringBackend &&) = delete;
+        IoUringBackend & operator=(IoUringBackend &&) = delete;
+
+        ~IoUringBackend() noexcept override;
+
+        void Submit(IoOperation & operation) noexcept override;
+
+        [[nodiscard]] IntrusiveList<IoOperation> Process(
+            bool wait, std::chrono::steady_clock::time_point const * deadline) noexcept override;
+
+        void Wake() noexcept override;
+
+        [[nodiscard]] bool IsIoUring() const noexcept override { return true; }
+
+    private:
+        [[nodiscard]] bool Setup(std::uint32_t entries) noexcept;
+
+        [[nodiscard]] io_uring_sqe * NextSqe() noexcept;
+        [[nodiscard]] bool TryPrepare(IoOperation & operation) noexcept;
+        void PrepareWakeRead() noexcept;
+
+        void Enter(bool wait, std::chrono::steady_clock::time_point const * deadline) noexcept;
+        void Harvest(IntrusiveList<IoOperation> & completed) noexcept;
+    };
+
+}  // namespace TaskSystem::Detail
+
+#endif
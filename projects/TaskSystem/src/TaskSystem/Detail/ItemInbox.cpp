@@ -0,0 +1,34 @@
+#include <TaskSystem/Detail/FrameAllocator.hpp>
+#include <TaskSystem/Detail/ItemInbox.hpp>
+
+#include <utility>
+
+
+namespace TaskSystem::Detail
+{
+
+    ItemBatch::~ItemBatch() noexcept
+    {
+        // Note: promises are owned by their task, only the boxes belong to the batch
+        while (auto * item = items.PopFront())
+        {
+            if (!item->AsPromise())
+            {
+                PooledDelete(static_cast<QueuedItem *>(item));
+            }
+        }
+    }
+
+    void ItemBatch::Add(ScheduleItem && item)
+    {
+        if (auto * promise = item.Promise())
+        {
+            items.PushBack(*promise);
+        }
+        else
+        {
+            items.PushBack(*PooledNew<QueuedItem>(std::move(item)));
+        }
+    }
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
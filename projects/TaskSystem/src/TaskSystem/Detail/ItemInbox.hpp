@@ -0,0 +1,153 @@
+#pragma once
+
+#include <TaskSystem/Detail/FrameAllocator.hpp>
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/Detail/ReadyItem.hpp>
+#include <TaskSystem/ScheduleItem.hpp>
+
+#include <utility>
+
+
+namespace TaskSystem::Detail
+{
+
+    template <template <typename> class TQueue>
+    class BasicItemInbox;
+
+    /// <summary>
+    /// Schedule items gathered on one thread to be pushed onto an inbox together
+    /// </summary>
+    /// <remarks>
+    /// Boxes still in the batch when it is destroyed are freed, so a batch abandoned part way through by a throw
+    /// leaks nothing
+    /// </remarks>
+    class ItemBatch final
+    {
+    private:
+        template <template <typename> class TQueue>
+        friend class BasicItemInbox;
+
+        IntrusiveList<InboxHook> items;
+
+    public:
+        ItemBatch() noexcept = default;
+
+        ItemBatch(ItemBatch const &) = delete;
+        ItemBatch & operator=(ItemBatch const &) = delete;
+
+        ItemBatch(ItemBatch &&) = delete;
+        ItemBatch & operator=(ItemBatch &&) = delete;
+
+        ~ItemBatch() noexcept;
+
+        [[nodiscard]] bool Empty() const noexcept { return items.Empty(); }
+
+        [[nodiscard]] size_t Size() const noexcept { return items.Size(); }
+
+        /// <summary>
+        /// Boxes the item unless it is a promise, throws if the box cannot be allocated
+        /// </summary>
+        void Add(ScheduleItem && item);
+    };
+
+    /// <summary>
+    /// Promises and boxed schedule items waiting for a scheduler's threads, can be pushed to from any thread
+    /// </summary>
+    /// <remarks>
+    /// Promises are queued through their own hook and other items in a pooled QueuedItem, so pushing never takes a
+    /// lock. Both share one queue and are popped in the order they were pushed. TQueue is IntrusiveMpscQueue for a
+    /// scheduler with a single loop thread and IntrusiveMpmcQueue when several workers pop
+    /// </remarks>
+    template <template <typename> class TQueue>
+    class BasicItemInbox final
+    {
+    private:
+        TQueue<InboxHook> items;
+
+    public:
+        BasicItemInbox() noexcept = default;
+
+        BasicItemInbox(BasicItemInbox const &) = delete;
+        BasicItemInbox & operator=(BasicItemInbox const &) = delete;
+
+        BasicItemInbox(BasicItemInbox &&) = delete;
+        BasicItemInbox & operator=(BasicItemInbox &&) = delete;
+
+        ~BasicItemInbox() noexcept { Discard(); }
+
+        /// <summary>
+        /// Approximate while items are being pushed, with a single consumer only that consumer may call it
+        /// </summary>
+        [[nodiscard]] bool Empty() const noexcept { return items.Empty(); }
+
+        /// <summary>
+        /// Boxes the item unless it is a promise, throws if the box cannot be allocated
+        /// </summary>
+        void Push(ScheduleItem && item)
+        {
+            if (auto * promise = item.Promise())
+            {
+                items.Push(*promise);
+            }
+            else
+            {
+                items.Push(*PooledNew<QueuedItem>(std::move(item)));
+            }
+        }
+
+        void Push(ItemBatch && batch) noexcept { items.Push(std::move(batch.items)); }
+
+        void Push(IntrusiveList<IPromise> && batch) noexcept { items.Push(std::move(batch)); }
+
+        /// <summary>
+        /// Empty when there is nothing to take, or a producer is part way through a push
+        /// </summary>
+        [[nodiscard]] ReadyItem Pop() noexcept
+        {
+            auto * item = items.Pop();
+            if (!item)
+            {
+                return ReadyItem();
+            }
+
+            if (auto * promise = item->AsPromise())
+            {
+                return ReadyItem(promise);
+            }
+
+            return ReadyItem(static_cast<QueuedItem *>(item));
+        }
+
+        /// <summary>
+        /// Frees every item without running it, promises are owned by their task but must still be alive. Must not race
+        /// with Pop
+        /// </summary>
+        void Discard() noexcept
+        {
+            while (auto item = Pop())
+            {
+                item.Discard();
+            }
+        }
+
+        /// <summary>
+        /// Discards every item for a scheduler that has been stopped, promises are faulted with SchedulerStopped
+        /// </summary>
+        /// <remarks>
+        /// Items pushed while draining, e.g. continuations of the faulted promises, are rejected too. Must not race
+        /// with Pop
+        /// </remarks>
+        void Reject() noexcept
+        {
+            while (auto item = Pop())
+            {
+                item.Reject();
+            }
+        }
+    };
+
+    using MpscItemInbox = BasicItemInbox<IntrusiveMpscQueue>;
+    using MpmcItemInbox = BasicItemInbox<IntrusiveMpmcQueue>;
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
@@ -1,20 +1,26 @@
 #pragma once
 
-#include <TaskSystem/AtomicLockGuard.hpp>
+#include <TaskSystem/ContinuationOptions.hpp>
+#include <TaskSystem/Deadline.hpp>
 #include <TaskSystem/Detail/Continuation.hpp>
 #include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/PromiseBatches.hpp>
 #include <TaskSystem/Detail/SetCompletedResult.hpp>
 #include <TaskSystem/Detail/TaskStates.hpp>
 #include <TaskSystem/Detail/Utils.hpp>
 #include <TaskSystem/ITaskScheduler.hpp>
+#include <TaskSystem/TaskPriority.hpp>
 #include <TaskSystem/TaskState.hpp>
 
 #include <atomic>
 #include <cassert>
 #include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
-#include <mutex>
 #include <type_traits>
+#include <utility>
 #include <variant>
 
 
@@ -32,10 +38,25 @@ namespace TaskSystem::Detail
         { T::CanSuspend } -> std::convertible_to<bool>;
         { T::AllowSuspendFromCreated } -> std::convertible_to<bool>;
         // Maybe: AllowSetRunningWhenRunning
+        // Optional: CompactLayout, see UsesCompactLayout
 
         // clang-format on
     };
 
+    // Policies opt in to the compact layout with CompactLayout = true; the promise bookkeeping then fits in a single
+    // cache line, trading false sharing between the state word and the continuations head for smaller frames
+    template <PromisePolicy TPolicy>
+    inline constexpr bool UsesCompactLayout = requires
+    {
+        requires TPolicy::CompactLayout;
+    };
+
+    // Inline resumptions a thread can nest before ExecuteSynchronously continuations fall back to being scheduled
+    inline constexpr std::size_t SynchronousContinuationDepthLimit = 16u;
+
+    // Note: counts the inline resumptions currently on this thread's stack
+    inline thread_local std::size_t synchronousContinuationDepth = 0u;
+
     // Maybe:
     // struct PromisePolicyDefaults
     // {
@@ -47,82 +68,319 @@ namespace TaskSystem::Detail
     {
     protected:
         using policy_type = TPolicy;
-        using state_type = std::variant<Created, Scheduled, Running, Suspended, Completed<TResult>, Faulted>;
+        using state_type = std::uint32_t;
+
+        static inline constexpr bool IsCompact = UsesCompactLayout<TPolicy>;
+
+        // Note: the compact result has no discriminator of its own, the state word says which alternative is alive
+        using result_type = std::conditional_t<IsCompact,
+                                               CompactResult<TResult>,
+                                               std::variant<std::monostate, Completed<TResult>, Faulted>>;
+
+        // Note: the low byte of the state word is the visible TaskState. The thread that wins the completion sets a
+        // claim flag while it writes the result; the visible state only changes when the result is published
+        static inline constexpr state_type StateMask = 0xFFu;
+        static inline constexpr state_type CompletingFlag = 0x100u;
+        static inline constexpr state_type FaultingFlag = 0x200u;
+
+        static inline constexpr std::size_t StateAlignment
+            = IsCompact ? alignof(std::atomic<state_type>) : CacheLineSize;
+
+        static inline constexpr std::size_t ContinuationsAlignment
+            = IsCompact ? alignof(Detail::Continuations) : CacheLineSize;
 
 #pragma warning(disable : 4324)
         // Disable: warning C4324: structure was padded due to alignment specifier
-        // alignment pads out the promise but also ensures the two atomic_flags are on different cache lines
+        // alignment pads out the promise but also ensures the state word and the continuations head are on different
+        // cache lines, unless the policy asked for the compact layout
+
+        alignas(StateAlignment) std::atomic<state_type> state = TaskState::Created;
+
+        // Note: fills the padding after the state word, set before the promise can complete
+        TaskSystem::ContinuationOptions continuationOptions = TaskSystem::ContinuationOptions::None;
 
-        // Note: can use std::atomic_flag after ABI break
-        alignas(CacheLineSize) mutable std::atomic<bool> stateFlag;
-        alignas(CacheLineSize) mutable std::atomic_flag completeFlag;
+        // Note: also in the padding, atomic since an awaiter on another thread can raise it
+        std::atomic<TaskPriority> priority = TaskPriority::Normal;
+
+        alignas(ContinuationsAlignment) Detail::Continuations continuations{};
 #pragma warning(default : 4324)
 
-        state_type state = Created{};
+        // Note: written once by the thread that claimed completion, published by the release store of the final state
+        result_type result{};
 
-        Detail::Continuations continuations{};
         ITaskScheduler * continuationScheduler = nullptr;
 
-        template <typename... Ts>
-        bool StateIsOneOf()
+        // Note: set before the promise is scheduled, read by the scheduler that dequeues it
+        DeadlineClock::time_point deadline = NoDeadline;
+
+        [[nodiscard]] static constexpr TaskState::ValueType VisibleState(state_type value) noexcept
         {
-            return (std::holds_alternative<Ts>(state) || ...);
+            return static_cast<TaskState::ValueType>(value & StateMask);
         }
 
-    public:
-        // ToDo: handle delete promise while thread is waiting
-        ~PromiseBase() noexcept override = default;
-
-        [[nodiscard]] TaskState State() const noexcept override final
+        // State the promise is in, or will be in once a claimed completion is published
+        [[nodiscard]] static constexpr TaskState::ValueType EffectiveState(state_type value) noexcept
         {
-            size_t index;
+            if (value & CompletingFlag)
             {
-                std::lock_guard lock(stateFlag);
-                index = state.index();
+                return TaskState::Completed;
+            }
+            if (value & FaultingFlag)
+            {
+                return TaskState::Error;
             }
 
-            switch (index)
+            return VisibleState(value);
+        }
+
+        template <typename T>
+        [[nodiscard]] T & ResultAs()
+        {
+            if constexpr (IsCompact)
             {
-            case 0u: return TaskState::Created;
-            case 1u: return TaskState::Scheduled;
-            case 2u: return TaskState::Running;
-            case 3u: return TaskState::Suspended;
-            case 4u: return TaskState::Completed;
-            case 5u: return TaskState::Error;
-            default: return TaskState::Unknown;
+                return result.template Get<T>();
+            }
+            else
+            {
+                return std::get<T>(result);
             }
         }
 
-        [[nodiscard]] Detail::Continuations & Continuations() noexcept override final { return continuations; }
+        template <typename T>
+        [[nodiscard]] T const & ResultAs() const
+        {
+            if constexpr (IsCompact)
+            {
+                return result.template Get<T>();
+            }
+            else
+            {
+                return std::get<T>(result);
+            }
+        }
 
-        [[nodiscard]] AddContinuationResult TryAddContinuation(Detail::Continuation value) noexcept override final
+        // Note: only called once, by the thread that claimed completion
+        template <typename T, typename... TArgs>
+        void EmplaceResult(TArgs &&... args)
         {
-            if (!value)
+            if constexpr (IsCompact)
             {
-                return AddContinuationError::InvalidContinuation;
+                result.template Emplace<T>(std::forward<TArgs>(args)...);
+            }
+            else
+            {
+                result.template emplace<T>(std::forward<TArgs>(args)...);
             }
+        }
 
-            std::lock_guard lock(stateFlag);
+        template <TaskState::ValueType... TStates>
+        [[nodiscard]] static constexpr bool StateIsOneOf(state_type value) noexcept
+        {
+            return ((value == static_cast<state_type>(TStates)) || ...);
+        }
 
-            if (!StateIsOneOf<Created, Scheduled, Running, Suspended>())
+        // Moves the state from any of TFrom to target; on failure observed holds the current state word
+        template <TaskState::ValueType... TFrom>
+        [[nodiscard]] bool TryTransition(state_type target, state_type & observed) noexcept
+        {
+            observed = state.load(std::memory_order_acquire);
+            while (StateIsOneOf<TFrom...>(observed))
             {
-                if (StateIsOneOf<Completed<TResult>>())
+                if (state.compare_exchange_weak(
+                        observed, target, std::memory_order_acq_rel, std::memory_order_acquire))
                 {
-                    return AddContinuationError::PromiseCompleted;
+                    return true;
                 }
-                else if (StateIsOneOf<Faulted>())
+            }
+
+            return false;
+        }
+
+        // Claims the right to write the result, other transitions fail until PublishCompletion
+        [[nodiscard]] bool TryClaimCompletion(state_type flag, state_type & observed) noexcept
+        {
+            observed = state.load(std::memory_order_acquire);
+            while (StateIsOneOf<TaskState::Created, TaskState::Running, TaskState::Suspended>(observed))
+            {
+                if (state.compare_exchange_weak(
+                        observed, observed | flag, std::memory_order_acq_rel, std::memory_order_acquire))
                 {
-                    return AddContinuationError::PromiseFaulted;
+                    return true;
                 }
+            }
+
+            return false;
+        }
+
+        [[nodiscard]] SetCompletedResult TryClaimResult() noexcept
+        {
+            state_type observed;
+            if (TryClaimCompletion(CompletingFlag, observed))
+            {
+                return Success;
+            }
 
-                std::terminate();
+            switch (EffectiveState(observed))
+            {
+            case TaskState::Scheduled: return SetCompletedError::PromiseScheduled;
+            case TaskState::Error: return SetCompletedError::PromiseFaulted;
+            default: return SetCompletedError::AlreadyCompleted;
             }
+        }
 
-            continuations.Add(std::move(value));
+        // Switches a claimed result to a fault, used when constructing the result throws
+        void FaultClaimedResult(std::exception_ptr ex) noexcept
+        {
+            EmplaceResult<Faulted>(Faulted{ ex });
+
+            // Note: only the claiming thread can modify a claimed state word
+            auto claimed = state.load(std::memory_order_relaxed);
+            state.store((claimed & ~CompletingFlag) | FaultingFlag, std::memory_order_relaxed);
+        }
 
+        [[nodiscard]] SetFaultedResult TryStoreException(std::exception_ptr ex) noexcept
+        {
+            state_type observed;
+            if (!TryClaimCompletion(FaultingFlag, observed))
+            {
+                switch (EffectiveState(observed))
+                {
+                case TaskState::Scheduled: return SetFaultedError::PromiseScheduled;
+                case TaskState::Completed: return SetFaultedError::PromiseCompleted;
+                default: return SetFaultedError::AlreadyFaulted;
+                }
+            }
+
+            EmplaceResult<Faulted>(Faulted{ ex });
             return Success;
         }
 
+        // Throws if the result has not been published, or rethrows the exception if faulted
+        void ThrowIfNoResult() const
+        {
+            auto current = VisibleState(state.load(std::memory_order_acquire));
+
+            if (current == TaskState::Error)
+            {
+                std::rethrow_exception(ResultAs<Faulted>().Exception);
+            }
+            else if (current != TaskState::Completed)
+            {
+                throw std::exception("Task is not complete");
+            }
+        }
+
+        // The list was closed by the completing thread, the caller resumes inline once the result is visible
+        [[nodiscard]] AddContinuationResult LateContinuationResult() const noexcept
+        {
+            Wait();
+
+            return State() == TaskState::Error ? AddContinuationError::PromiseFaulted
+                                                : AddContinuationError::PromiseCompleted;
+        }
+
+        // When handoff is set the first continuation bound for the current scheduler is claimed and returned rather
+        // than scheduled so the caller can resume it by symmetric transfer; otherwise returns nullptr
+        static std::coroutine_handle<> ScheduleContinuations(Detail::PendingContinuations & pending,
+                                                             ITaskScheduler * continuationScheduler,
+                                                             TaskSystem::ContinuationOptions options,
+                                                             bool handoff) noexcept
+        {
+            // Note: grouped by scheduler so a completion that wakes many awaiters publishes them to each scheduler once
+            auto batches = Detail::PromiseBatches();
+            auto next = std::coroutine_handle<>();
+
+            // Note: resumed after every continuation has been taken off the list, resuming one can destroy the frames
+            // holding the nodes of the others
+            auto inlined = Detail::IntrusiveList<IPromise>();
+            auto runInline = options == TaskSystem::ContinuationOptions::ExecuteSynchronously
+                          && synchronousContinuationDepth < SynchronousContinuationDepthLimit;
+
+            while (!pending.Empty())
+            {
+                auto continuation = pending.Pop();
+
+                // Explicit ContinueOn takes priority over the scheduler captured when the continuation was added
+                auto * scheduler
+                    = FirstOf(continuationScheduler, continuation.Scheduler(), DefaultScheduler(), CurrentScheduler());
+
+                assert(scheduler);
+
+                auto result = continuation.Promise().TrySetScheduled();
+                if (result)
+                {
+                    if (handoff && !next && IsCurrentScheduler(scheduler) && continuation.Promise().TrySetRunning())
+                    {
+                        next = continuation.Promise().Handle();
+                        continue;
+                    }
+
+                    if (runInline && IsCurrentScheduler(scheduler))
+                    {
+                        inlined.PushBack(continuation.Promise());
+                        continue;
+                    }
+
+                    batches.Add(*scheduler, continuation.Promise());
+                }
+                else
+                {
+                    if (result == SetScheduledError::PromiseCompleted || result == SetScheduledError::PromiseFaulted)
+                    {
+                        continuation.Promise().ScheduleContinuations();
+                    }
+                }
+            }
+
+            batches.Flush();
+
+            while (auto * promise = inlined.PopFront())
+            {
+                ++synchronousContinuationDepth;
+                [[maybe_unused]] auto _ = ScheduleItem(promise).Run();
+                --synchronousContinuationDepth;
+            }
+
+            return next;
+        }
+
+    public:
+        // ToDo: handle delete promise while thread is waiting
+        ~PromiseBase() noexcept override
+        {
+            if constexpr (IsCompact)
+            {
+                switch (EffectiveState(state.load(std::memory_order_acquire)))
+                {
+                case TaskState::Completed: result.template Destroy<Completed<TResult>>(); break;
+                case TaskState::Error: result.template Destroy<Faulted>(); break;
+                default: break;
+                }
+            }
+        }
+
+        [[nodiscard]] TaskState State() const noexcept override final
+        {
+            return VisibleState(state.load(std::memory_order_acquire));
+        }
+
+        [[nodiscard]] Detail::Continuations & Continuations() noexcept override final { return continuations; }
+
+        [[nodiscard]] AddContinuationResult TryAddContinuation(Detail::ContinuationNode & node) noexcept override final
+        {
+            if (!node.Value())
+            {
+                return AddContinuationError::InvalidContinuation;
+            }
+
+            if (continuations.TryAdd(node))
+            {
+                return Success;
+            }
+
+            return LateContinuationResult();
+        }
+
         [[nodiscard]] ITaskScheduler * ContinuationScheduler() const noexcept override final
         {
             return continuationScheduler;
@@ -130,6 +388,25 @@ namespace TaskSystem::Detail
 
         void ContinuationScheduler(ITaskScheduler * value) noexcept override final { continuationScheduler = value; }
 
+        [[nodiscard]] TaskSystem::ContinuationOptions ContinuationOptions() const noexcept
+        {
+            return continuationOptions;
+        }
+
+        // Must be set before the promise completes
+        void ContinuationOptions(TaskSystem::ContinuationOptions value) noexcept { continuationOptions = value; }
+
+        [[nodiscard]] TaskPriority Priority() const noexcept override final
+        {
+            return priority.load(std::memory_order_relaxed);
+        }
+
+        void Priority(TaskPriority value) noexcept override final { priority.store(value, std::memory_order_relaxed); }
+
+        [[nodiscard]] DeadlineClock::time_point Deadline() const noexcept override final { return deadline; }
+
+        void Deadline(DeadlineClock::time_point value) noexcept override final { deadline = value; }
+
         [[nodiscard]] SetScheduledResult TrySetScheduled() noexcept override
         {
             // Maybe: two separate versions, one is constexpr
@@ -139,28 +416,19 @@ namespace TaskSystem::Detail
             }
             else
             {
-                std::lock_guard lock(stateFlag);
-
-                if (!StateIsOneOf<Created, Suspended>())
+                state_type observed;
+                if (TryTransition<TaskState::Created, TaskState::Suspended>(TaskState::Scheduled, observed))
                 {
-                    if (StateIsOneOf<Running>())
-                    {
-                        return SetScheduledError::PromiseRunning;
-                    }
-                    else if (StateIsOneOf<Completed<TResult>>())
-                    {
-                        return SetScheduledError::PromiseCompleted;
-                    }
-                    else if (StateIsOneOf<Faulted>())
-                    {
-                        return SetScheduledError::PromiseFaulted;
-                    }
-
-                    return SetScheduledError::AlreadyScheduled;
+                    return Success;
                 }
 
-                state = Scheduled{};
-                return Success;
+                switch (EffectiveState(observed))
+                {
+                case TaskState::Running: return SetScheduledError::PromiseRunning;
+                case TaskState::Completed: return SetScheduledError::PromiseCompleted;
+                case TaskState::Error: return SetScheduledError::PromiseFaulted;
+                default: return SetScheduledError::AlreadyScheduled;
+                }
             }
         }
 
@@ -172,24 +440,19 @@ namespace TaskSystem::Detail
             }
             else
             {
-                std::lock_guard lock(stateFlag);
-
-                if (!StateIsOneOf<Created, Scheduled, Suspended>())
+                state_type observed;
+                if (TryTransition<TaskState::Created, TaskState::Scheduled, TaskState::Suspended>(
+                        TaskState::Running, observed))
                 {
-                    if (StateIsOneOf<Completed<TResult>>())
-                    {
-                        return SetRunningError::PromiseCompleted;
-                    }
-                    if (StateIsOneOf<Faulted>())
-                    {
-                        return SetRunningError::PromiseFaulted;
-                    }
-
-                    return SetRunningError::AlreadyRunning;
+                    return Success;
                 }
 
-                state = Running{};
-                return Success;
+                switch (EffectiveState(observed))
+                {
+                case TaskState::Completed: return SetRunningError::PromiseCompleted;
+                case TaskState::Error: return SetRunningError::PromiseFaulted;
+                default: return SetRunningError::AlreadyRunning;
+                }
             }
         }
 
@@ -201,118 +464,101 @@ namespace TaskSystem::Detail
             }
             else
             {
-                std::lock_guard lock(stateFlag);
-
+                state_type observed;
                 if constexpr (policy_type::AllowSuspendFromCreated)
                 {
-                    if (!StateIsOneOf<Created, Running>())
+                    if (TryTransition<TaskState::Created, TaskState::Running>(TaskState::Suspended, observed))
                     {
-                        if (StateIsOneOf<Scheduled>())
-                        {
-                            return SetSuspendedError::PromiseScheduled;
-                        }
-                        if (StateIsOneOf<Completed<TResult>>())
-                        {
-                            return SetSuspendedError::PromiseCompleted;
-                        }
-                        if (StateIsOneOf<Faulted>())
-                        {
-                            return SetSuspendedError::PromiseFaulted;
-                        }
-
-                        return SetSuspendedError::AlreadySuspended;
+                        return Success;
                     }
                 }
                 else
                 {
-                    if (!StateIsOneOf<Running>())
+                    if (TryTransition<TaskState::Running>(TaskState::Suspended, observed))
                     {
-                        if (StateIsOneOf<Created>())
-                        {
-                            return SetSuspendedError::PromiseCreated;
-                        }
-                        if (StateIsOneOf<Scheduled>())
-                        {
-                            return SetSuspendedError::PromiseScheduled;
-                        }
-                        if (StateIsOneOf<Completed<TResult>>())
-                        {
-                            return SetSuspendedError::PromiseCompleted;
-                        }
-                        if (StateIsOneOf<Faulted>())
-                        {
-                            return SetSuspendedError::PromiseFaulted;
-                        }
-
-                        return SetSuspendedError::AlreadySuspended;
+                        return Success;
                     }
                 }
 
-                state = Suspended{};
-                return Success;
+                switch (EffectiveState(observed))
+                {
+                case TaskState::Created: return SetSuspendedError::PromiseCreated;
+                case TaskState::Scheduled: return SetSuspendedError::PromiseScheduled;
+                case TaskState::Completed: return SetSuspendedError::PromiseCompleted;
+                case TaskState::Error: return SetSuspendedError::PromiseFaulted;
+                default: return SetSuspendedError::AlreadySuspended;
+                }
             }
         }
 
         [[nodiscard]] SetFaultedResult TrySetException(std::exception_ptr ex) noexcept override final
         {
+            auto result = TryStoreException(ex);
+            if (result)
             {
-                std::lock_guard lock(stateFlag);
-
-                if (!StateIsOneOf<Created, Running, Suspended>())
-                {
-                    if (StateIsOneOf<Scheduled>())
-                    {
-                        return SetFaultedError::PromiseScheduled;
-                    }
-                    if (StateIsOneOf<Completed<TResult>>())
-                    {
-                        return SetFaultedError::PromiseCompleted;
-                    }
-
-                    return SetFaultedError::AlreadyFaulted;
-                }
-
-                state = Faulted{ ex };
-                this->ScheduleContinuations();
+                PublishCompletion();
             }
 
-            completeFlag.test_and_set(std::memory_order_acquire);
-            completeFlag.notify_all();
-
-            return Success;
+            return result;
         }
 
         void Wait() const noexcept override final
         {
-            // Waits for TrySetResult, TrySetCompleted or TrySetException to set completeFlag to true
-            completeFlag.wait(false, std::memory_order_acquire);
+            // Waits for the result to be published by TrySetResult, TrySetCompleted or TrySetException
+            auto current = state.load(std::memory_order_acquire);
+            while (!TaskState(VisibleState(current)).IsCompleted())
+            {
+                state.wait(current, std::memory_order_acquire);
+                current = state.load(std::memory_order_acquire);
+            }
+        }
+
+        /// <summary>
+        /// Publishes a claimed result then schedules the continuations
+        /// </summary>
+        /// <remarks>
+        /// Once the final state is visible the owner is free to destroy the promise, so the continuations are taken and
+        /// the continuation scheduler read before the store; only the waiter notification touches the promise after it
+        /// </remarks>
+        void PublishCompletion() noexcept { [[maybe_unused]] auto _ = PublishCompletion(false); }
+
+        /// <summary>
+        /// Publishes a claimed result like PublishCompletion, except that a continuation bound for the current
+        /// scheduler is returned for the caller to resume instead of going through the scheduler's queue
+        /// </summary>
+        /// <remarks>
+        /// Used from final_suspend so an await chain resumes the awaiter by symmetric transfer on the same thread,
+        /// returns nullptr when there is nothing to hand off
+        /// </remarks>
+        [[nodiscard]] std::coroutine_handle<> PublishCompletionWithHandoff() noexcept
+        {
+            return PublishCompletion(true);
         }
 
         void ScheduleContinuations() noexcept override final
         {
-            for (auto & continuation : this->continuations)
+            auto pending = continuations.Close();
+            [[maybe_unused]] auto _ = ScheduleContinuations(pending, continuationScheduler, continuationOptions, false);
+        }
+
+    private:
+        [[nodiscard]] std::coroutine_handle<> PublishCompletion(bool handoff) noexcept
+        {
+            auto claimed = state.load(std::memory_order_relaxed);
+            if (!(claimed & (CompletingFlag | FaultingFlag)))
             {
-                auto * scheduler = FirstOf(
-                    continuation.Scheduler(),
-                    this->continuationScheduler,
-                    DefaultScheduler(),
-                    CurrentScheduler());
+                return nullptr;
+            }
 
-                assert(scheduler);
+            auto pending = continuations.Close();
+            auto * scheduler = continuationScheduler;
+            auto options = continuationOptions;
 
-                auto result = continuation.Promise().TrySetScheduled();
-                if (result)
-                {
-                    scheduler->Schedule(continuation.Promise());
-                }
-                else
-                {
-                    if (result == SetScheduledError::PromiseCompleted || result == SetScheduledError::PromiseFaulted)
-                    {
-                        continuation.Promise().ScheduleContinuations();
-                    }
-                }
-            }
+            state.store(
+                (claimed & FaultingFlag) ? TaskState::Error : TaskState::Completed, std::memory_order_release);
+            state.notify_all();
+
+            return ScheduleContinuations(pending, scheduler, options, handoff);
         }
     };
 
@@ -326,110 +572,68 @@ namespace TaskSystem::Detail
 
         [[nodiscard]] SetCompletedResult TrySetResult(std::convertible_to<TResult> auto && value) noexcept
         {
+            auto result = TryStoreResult(std::forward<decltype(value)>(value));
+            if (result)
             {
-                std::lock_guard lock(this->stateFlag);
-
-                if (!this->StateIsOneOf<Created, Running, Suspended>())
-                {
-                    if (this->StateIsOneOf<Scheduled>())
-                    {
-                        return SetCompletedError::PromiseScheduled;
-                    }
-                    if (this->StateIsOneOf<Faulted>())
-                    {
-                        return SetCompletedError::PromiseFaulted;
-                    }
-
-                    return SetCompletedError::AlreadyCompleted;
-                }
-
-                if constexpr (std::is_nothrow_constructible_v<TResult, decltype(value)>)
-                {
-                    this->state = Completed<TResult>{ std::forward<decltype(value)>(value) };
-                }
-                else
-                {
-                    try
-                    {
-                        this->state = Completed<TResult>{ std::forward<decltype(value)>(value) };
-                    }
-                    catch (...)
-                    {
-                        this->state = Faulted{ std::current_exception() };
-                    }
-                }
-
-                this->ScheduleContinuations();
+                this->PublishCompletion();
             }
 
-            this->completeFlag.test_and_set(std::memory_order_acquire);
-            this->completeFlag.notify_all();
-
-            return Success;
+            return result;
         }
 
         [[nodiscard]] TResult & Result() &
         {
-            std::lock_guard lock(this->stateFlag);
-
-            if (this->StateIsOneOf<Created, Scheduled, Running, Suspended>())
-            {
-                throw std::exception("Task is not complete");
-            }
-            else if (auto * fault = std::get_if<Faulted>(&this->state))
-            {
-                std::rethrow_exception(fault->Exception);
-            }
-
-            return std::get<Completed<TResult>>(this->state).Value;
+            this->ThrowIfNoResult();
+            return this->template ResultAs<Completed<TResult>>().Value;
         }
 
         [[nodiscard]] TResult const & Result() const &
         {
-            std::lock_guard lock(this->stateFlag);
-
-            if (this->StateIsOneOf<Created, Scheduled, Running, Suspended>())
-            {
-                throw std::exception("Task is not complete");
-            }
-            else if (auto * fault = std::get_if<Faulted>(&this->state))
-            {
-                std::rethrow_exception(fault->Exception);
-            }
-
-            return std::get<Completed<TResult>>(this->state).Value;
+            this->ThrowIfNoResult();
+            return this->template ResultAs<Completed<TResult>>().Value;
         }
 
         [[nodiscard]] TResult Result() &&
         {
-            std::lock_guard lock(this->stateFlag);
-
-            if (this->StateIsOneOf<Created, Scheduled, Running, Suspended>())
-            {
-                throw std::exception("Task is not complete");
-            }
-            else if (auto * fault = std::get_if<Faulted>(&this->state))
-            {
-                std::rethrow_exception(fault->Exception);
-            }
-
-            return std::get<Completed<TResult>>(std::move(this->state)).Value;
+            this->ThrowIfNoResult();
+            return std::move(this->template ResultAs<Completed<TResult>>().Value);
         }
 
         [[nodiscard]] TResult const && Result() const &&
         {
-            std::lock_guard lock(this->stateFlag);
+            this->ThrowIfNoResult();
+            return std::move(this->template ResultAs<Completed<TResult>>().Value);
+        }
 
-            if (this->StateIsOneOf<Created, Scheduled, Running, Suspended>())
+    protected:
+        // Claims and writes the result without publishing it, see PublishCompletion
+        [[nodiscard]] SetCompletedResult TryStoreResult(std::convertible_to<TResult> auto && value) noexcept
+        {
+            auto result = this->TryClaimResult();
+            if (!result)
             {
-                throw std::exception("Task is not complete");
+                return result;
             }
-            else if (auto * fault = std::get_if<Faulted>(&this->state))
+
+            if constexpr (std::is_nothrow_constructible_v<TResult, decltype(value)>)
             {
-                std::rethrow_exception(fault->Exception);
+                this->template EmplaceResult<Completed<TResult>>(
+                    Completed<TResult>{ std::forward<decltype(value)>(value) });
+            }
+            else
+            {
+                try
+                {
+                    this->template EmplaceResult<Completed<TResult>>(
+                        Completed<TResult>{ std::forward<decltype(value)>(value) });
+                }
+                catch (...)
+                {
+                    this->FaultClaimedResult(std::current_exception());
+                }
             }
 
-            return std::get<Completed<TResult>>(std::move(this->state)).Value;
+            return Success;
         }
     };
 
@@ -443,63 +647,38 @@ namespace TaskSystem::Detail
 
         [[nodiscard]] SetCompletedResult TrySetResult(TResult & value) noexcept
         {
+            auto result = TryStoreResult(value);
+            if (result)
             {
-                std::lock_guard lock(this->stateFlag);
-
-                if (!this->StateIsOneOf<Created, Running, Suspended>())
-                {
-                    if (this->StateIsOneOf<Scheduled>())
-                    {
-                        return SetCompletedError::PromiseScheduled;
-                    }
-                    if (this->StateIsOneOf<Faulted>())
-                    {
-                        return SetCompletedError::PromiseFaulted;
-                    }
-
-                    return SetCompletedError::AlreadyCompleted;
-                }
-
-                this->state = Completed<TResult *>{ std::addressof(value) };
-                this->ScheduleContinuations();
+                this->PublishCompletion();
             }
 
-            this->completeFlag.test_and_set(std::memory_order_acquire);
-            this->completeFlag.notify_all();
-
-            return Success;
+            return result;
         }
 
         [[nodiscard]] TResult & Result()
         {
-            std::lock_guard lock(this->stateFlag);
-
-            if (this->StateIsOneOf<Created, Scheduled, Running, Suspended>())
-            {
-                throw std::exception("Task is not complete");
-            }
-            else if (auto * fault = std::get_if<Faulted>(&this->state))
-            {
-                std::rethrow_exception(fault->Exception);
-            }
-
-            return *std::get<Completed<TResult *>>(this->state).Value;
+            this->ThrowIfNoResult();
+            return *this->template ResultAs<Completed<TResult *>>().Value;
         }
 
         [[nodiscard]] TResult const & Result() const
         {
-            std::lock_guard lock(this->stateFlag);
+            this->ThrowIfNoResult();
+            return *this->template ResultAs<Completed<TResult *>>().Value;
+        }
 
-            if (this->StateIsOneOf<Created, Scheduled, Running, Suspended>())
-            {
-                throw std::exception("Task is not complete");
-            }
-            else if (auto * fault = std::get_if<Faulted>(&this->state))
+    protected:
+        // Claims and writes the result without publishing it, see PublishCompletion
+        [[nodiscard]] SetCompletedResult TryStoreResult(TResult & value) noexcept
+        {
+            auto result = this->TryClaimResult();
+            if (result)
             {
-                std::rethrow_exception(fault->Exception);
+                this->template EmplaceResult<Completed<TResult *>>(Completed<TResult *>{ std::addressof(value) });
             }
 
-            return *std::get<Completed<TResult *>>(this->state).Value;
+            return result;
         }
     };
 
@@ -513,41 +692,34 @@ namespace TaskSystem::Detail
 
         [[nodiscard]] SetCompletedResult TrySetCompleted() noexcept
         {
+            auto result = TryStoreCompleted();
+            if (result)
             {
-                std::lock_guard lock(this->stateFlag);
-
-                if (!this->StateIsOneOf<Created, Running, Suspended>())
-                {
-                    if (this->StateIsOneOf<Scheduled>())
-                    {
-                        return SetCompletedError::PromiseScheduled;
-                    }
-                    if (this->StateIsOneOf<Faulted>())
-                    {
-                        return SetCompletedError::PromiseFaulted;
-                    }
-
-                    return SetCompletedError::AlreadyCompleted;
-                }
-
-                this->state = Completed<>{};
-                this->ScheduleContinuations();
+                this->PublishCompletion();
             }
 
-            this->completeFlag.test_and_set(std::memory_order_acquire);
-            this->completeFlag.notify_all();
-
-            return Success;
+            return result;
         }
 
-        [[nodiscard]] void ThrowIfFaulted() const
+        void ThrowIfFaulted() const
         {
-            std::lock_guard lock(this->stateFlag);
+            if (this->State() == TaskState::Error)
+            {
+                std::rethrow_exception(this->template ResultAs<Faulted>().Exception);
+            }
+        }
 
-            if (auto * fault = std::get_if<Faulted>(&this->state))
+    protected:
+        // Claims completion without publishing it, see PublishCompletion
+        [[nodiscard]] SetCompletedResult TryStoreCompleted() noexcept
+        {
+            auto result = this->TryClaimResult();
+            if (result)
             {
-                std::rethrow_exception(fault->Exception);
+                this->template EmplaceResult<Completed<>>();
             }
+
+            return result;
         }
     };
 
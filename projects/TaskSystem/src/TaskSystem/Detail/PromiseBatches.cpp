@@ -0,0 +1,58 @@
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/PromiseBatches.hpp>
+
+#include <utility>
+
+
+namespace TaskSystem::Detail
+{
+
+    PromiseBatches::~PromiseBatches() noexcept { Flush(); }
+
+    void PromiseBatches::Add(ITaskScheduler & scheduler, IPromise & promise) noexcept
+    {
+        Group * empty = nullptr;
+        for (auto & group : groups)
+        {
+            if (group.Scheduler == &scheduler)
+            {
+                group.Promises.PushBack(promise);
+                return;
+            }
+
+            if (!empty && group.Scheduler == nullptr)
+            {
+                empty = &group;
+            }
+        }
+
+        if (!empty)
+        {
+            // Note: more schedulers than groups, make room by flushing the groups in turn
+            empty = &groups[oldest];
+            oldest = (oldest + 1u) % GroupCount;
+            Flush(*empty);
+        }
+
+        empty->Scheduler = &scheduler;
+        empty->Promises.PushBack(promise);
+    }
+
+    void PromiseBatches::Flush() noexcept
+    {
+        for (auto & group : groups)
+        {
+            Flush(group);
+        }
+        oldest = 0u;
+    }
+
+    void PromiseBatches::Flush(Group & group) noexcept
+    {
+        if (auto * scheduler = std::exchange(group.Scheduler, nullptr))
+        {
+            scheduler->ScheduleBatch(std::move(group.Promises));
+        }
+    }
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+
+#include <array>
+
+
+namespace TaskSystem::Detail
+{
+
+    class IPromise;
+
+    /// <summary>
+    /// Groups scheduled promises by their target scheduler so each scheduler receives them as one batch
+    /// </summary>
+    /// <remarks>
+    /// Promises are linked through their queue hooks so grouping never allocates. Up to GroupCount schedulers are
+    /// tracked at once, a promise for any other scheduler flushes one of the groups first. Anything still grouped is
+    /// flushed on destruction
+    /// </remarks>
+    class PromiseBatches final
+    {
+    public:
+        static inline constexpr size_t GroupCount = 4u;
+
+    private:
+        struct Group final
+        {
+            ITaskScheduler * Scheduler = nullptr;
+            IntrusiveList<IPromise> Promises;
+        };
+
+        std::array<Group, GroupCount> groups;
+        size_t oldest = 0u;
+
+    public:
+        PromiseBatches() noexcept = default;
+
+        PromiseBatches(PromiseBatches const &) = delete;
+        PromiseBatches & operator=(PromiseBatches const &) = delete;
+
+        PromiseBatches(PromiseBatches &&) = delete;
+        PromiseBatches & operator=(PromiseBatches &&) = delete;
+
+        ~PromiseBatches() noexcept;
+
+        /// <summary>
+        /// Adds a promise that has already been set to Scheduled
+        /// </summary>
+        void Add(ITaskScheduler & scheduler, IPromise & promise) noexcept;
+
+        /// <summary>
+        /// Hands every group to its scheduler
+        /// </summary>
+        void Flush() noexcept;
+
+    private:
+        static void Flush(Group & group) noexcept;
+    };
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
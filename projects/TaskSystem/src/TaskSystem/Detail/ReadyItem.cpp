@@ -0,0 +1,48 @@
+#include <TaskSystem/Detail/FrameAllocator.hpp>
+#include <TaskSystem/Detail/ReadyItem.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+
+#include <utility>
+
+
+namespace TaskSystem::Detail
+{
+
+    ReadyItem ReadyItem::Box(ScheduleItem && item)
+    {
+        auto * promise = item.Promise();
+        return promise ? ReadyItem(promise) : ReadyItem(PooledNew<QueuedItem>(std::move(item)));
+    }
+
+    void ReadyItem::Run() const noexcept
+    {
+        if (auto * promise = Promise())
+        {
+            ScheduleItem(promise).Execute();
+            return;
+        }
+
+        auto * item = Item();
+        item->Item.Execute();
+        PooledDelete(item);
+    }
+
+    void ReadyItem::Discard() const noexcept { PooledDelete(Item()); }
+
+    void ReadyItem::Reject() const noexcept
+    {
+        auto * promise = Promise();
+        if (!promise)
+        {
+            Discard();
+            return;
+        }
+
+        // Note: the promise is Scheduled and can only fault once it has been claimed to run
+        if (promise->TrySetRunning())
+        {
+            [[maybe_unused]] auto _ = promise->TrySetException(std::make_exception_ptr(SchedulerStopped()));
+        }
+    }
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/ScheduleItem.hpp>
+
+#include <cstdint>
+#include <utility>
+
+
+namespace TaskSystem::Detail
+{
+
+    /// <summary>
+    /// Schedule item other than a promise, boxed in pooled memory so it can be queued by pointer or intrusively
+    /// </summary>
+    struct QueuedItem final : InboxHook
+    {
+        ScheduleItem Item;
+
+        explicit QueuedItem(ScheduleItem && item) noexcept : Item(std::move(item)) { }
+    };
+
+    /// <summary>
+    /// Promise or boxed schedule item in a single pointer, for queues that only hold pointers
+    /// </summary>
+    /// <remarks>
+    /// The low bit tags boxed items so a promise is queued as a plain pointer. Boxed items are allocated from the
+    /// pooled frame allocator and freed when the item is run or discarded
+    /// </remarks>
+    class ReadyItem final
+    {
+    private:
+        std::uintptr_t value = 0u;
+
+    public:
+        ReadyItem() noexcept = default;
+
+        explicit ReadyItem(IPromise * promise) noexcept : value(reinterpret_cast<std::uintptr_t>(promise)) { }
+
+        explicit ReadyItem(QueuedItem * item) noexcept : value(reinterpret_cast<std::uintptr_t>(item) | 1u) { }
+
+        // Items other than promises are moved into pooled memory
+        [[nodiscard]] static ReadyItem Box(ScheduleItem && item);
+
+        [[nodiscard]] IPromise * Promise() const noexcept
+        {
+            return (value & 1u) ? nullptr : reinterpret_cast<IPromise *>(value);
+        }
+
+        [[nodiscard]] QueuedItem * Item() const noexcept
+        {
+            return (value & 1u) ? reinterpret_cast<QueuedItem *>(value & ~std::uintptr_t(1u)) : nullptr;
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept { return value != 0u; }
+
+        // Runs the item and frees it if it was boxed
+        void Run() const noexcept;
+
+        // Frees the item without running it, promises are owned by their task
+        void Discard() const noexcept;
+
+        // Discards the item for a scheduler that has been stopped, a promise is faulted with SchedulerStopped
+        void Reject() const noexcept;
+    };
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
@@ -0,0 +1,67 @@
+#include <TaskSystem/Detail/SocketState.hpp>
+
+#if defined(__linux__)
+
+#include <algorithm>
+#include <cerrno>
+
+#include <sys/socket.h>
+
+
+namespace TaskSystem::Detail
+{
+
+    namespace
+    {
+        constexpr std::size_t MaxTransfer = 0x7ffff000u;
+
+    }  // namespace
+
+    bool SocketOperation::TryOnce() noexcept
+    {
+        auto result = ssize_t(-1);
+        do
+        {
+            switch (Kind)
+            {
+            case SocketOperationKind::Read:
+                result = ::recv(Fd, Buffer, std::min(Length, MaxTransfer), 0);
+                break;
+
+            case SocketOperationKind::Write:
+                result = ::send(Fd, Buffer, std::min(Length, MaxTransfer), MSG_NOSIGNAL);
+                break;
+
+            case SocketOperationKind::Accept:
+                result = ::accept4(Fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                break;
+
+            case SocketOperationKind::Connect:
+                // Note: repeating connect reports progress, EALREADY until the handshake ends and then EISCONN or
+                // the error it failed with
+                result = ::connect(Fd, Address, AddressLength);
+                if (result < 0 && ConnectStarted && errno == EISCONN)
+                {
+                    result = 0;
+                }
+                else if (result < 0 && (errno == EINPROGRESS || errno == EALREADY))
+                {
+                    ConnectStarted = true;
+                    errno = EAGAIN;
+                }
+                break;
+            }
+        } while (result < 0 && errno == EINTR);
+
+        if (result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            return false;
+        }
+
+        Result = result < 0 ? -errno : static_cast<std::int32_t>(result);
+        return true;
+    }
+
+}  // namespace TaskSystem::Detail
+
+#endif
@@ -0,0 +1,82 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <sys/socket.h>
+
+
+namespace TaskSystem
+{
+    class ITaskScheduler;
+}
+
+namespace TaskSystem::Detail
+{
+
+    class IPromise;
+
+    enum class SocketOperationKind : std::uint8_t
+    {
+        Read,
+        Write,
+        Accept,
+        Connect
+    };
+
+    /// <summary>
+    /// A socket call waiting for readiness, lives in the awaiting coroutine's frame
+    /// </summary>
+    struct SocketOperation final
+    {
+        SocketOperationKind Kind = SocketOperationKind::Read;
+        int Fd = -1;
+
+        void * Buffer = nullptr;
+        std::size_t Length = 0u;
+
+        sockaddr const * Address = nullptr;
+        socklen_t AddressLength = 0u;
+        bool ConnectStarted = false;
+
+        // Bytes transferred or the accepted fd, -errno on failure
+        std::int32_t Result = 0;
+
+        IPromise * Caller = nullptr;
+
+        // Set by ContinueOn, otherwise the caller is resumed inline on the reactor thread
+        ITaskScheduler * Scheduler = nullptr;
+
+        // Makes the call without blocking, returns false if it would block
+        [[nodiscard]] bool TryOnce() noexcept;
+    };
+
+    /// <summary>
+    /// A socket registered with a reactor, edge-triggered readiness is recorded per direction
+    /// </summary>
+    /// <remarks>
+    /// Each slot holds the operation waiting for that direction, or Notified when an edge arrived with nobody waiting,
+    /// so a waiter never misses an edge that arrives between its failed call and parking. Freed by the reactor thread
+    /// once no event being processed can refer to it
+    /// </remarks>
+    struct SocketState final : QueueHook
+    {
+        int Fd = -1;
+
+        std::atomic<SocketOperation *> Reader = nullptr;
+        std::atomic<SocketOperation *> Writer = nullptr;
+
+        [[nodiscard]] static SocketOperation * Notified() noexcept
+        {
+            return reinterpret_cast<SocketOperation *>(std::uintptr_t(1u));
+        }
+    };
+
+}  // namespace TaskSystem::Detail
+
+#endif
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <thread>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+namespace TaskSystem::Detail
+{
+
+    /// <summary>
+    /// Hints to the CPU that the thread is in a spin loop, e.g. _mm_pause on x86
+    /// </summary>
+    /// <remarks>
+    /// Frees execution resources for the sibling hyper-thread and avoids the memory order mis-speculation penalty when
+    /// the loop exits
+    /// </remarks>
+    inline void CpuRelax() noexcept
+    {
+#if defined(_M_X64) || defined(_M_IX86)
+        _mm_pause();
+#elif defined(_M_ARM64) || defined(_M_ARM)
+        __yield();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield");
+#endif
+    }
+
+    /// <summary>
+    /// Bounded exponential backoff for spin loops
+    /// </summary>
+    /// <remarks>
+    /// Each SpinOnce pauses twice as long as the one before, up to 2^YieldThreshold pauses, after which it yields the
+    /// rest of the thread's time slice instead
+    /// </remarks>
+    class SpinWait final
+    {
+    public:
+        static inline constexpr std::uint32_t YieldThreshold = 6u;
+
+    private:
+        std::uint32_t count = 0u;
+
+    public:
+        [[nodiscard]] bool NextSpinWillYield() const noexcept { return count >= YieldThreshold; }
+
+        void SpinOnce() noexcept
+        {
+            if (NextSpinWillYield())
+            {
+                std::this_thread::yield();
+                return;
+            }
+
+            for (auto i = std::uint32_t(0u); i < (std::uint32_t(1u) << count); ++i)
+            {
+                CpuRelax();
+            }
+            ++count;
+        }
+
+        void Reset() noexcept { count = 0u; }
+    };
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
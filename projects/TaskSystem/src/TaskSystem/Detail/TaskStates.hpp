@@ -1,28 +1,15 @@
 #pragma once
 
+#include <concepts>
 #include <exception>
+#include <memory>
+#include <utility>
 #include <variant>
 
 
 namespace TaskSystem::Detail
 {
 
-    struct Created final : std::monostate
-    {
-    };
-
-    struct Scheduled final : std::monostate
-    {
-    };
-
-    struct Running final : std::monostate
-    {
-    };
-
-    struct Suspended final : std::monostate
-    {
-    };
-
     template <typename TResult = void>
     struct Completed;
 
@@ -46,4 +33,71 @@ namespace TaskSystem::Detail
         std::exception_ptr Exception;
     };
 
+    /// <summary>
+    /// Storage for either a Completed or a Faulted result without a discriminator of its own
+    /// </summary>
+    /// <remarks>
+    /// Used by compact promises where the state word already says which alternative is alive. The owner constructs at
+    /// most one alternative and must destroy it
+    /// </remarks>
+    template <typename TResult>
+    class CompactResult final
+    {
+    private:
+        union
+        {
+            Completed<TResult> completed;
+            Faulted faulted;
+        };
+
+    public:
+        CompactResult() noexcept { }
+
+        CompactResult(CompactResult const &) = delete;
+        CompactResult & operator=(CompactResult const &) = delete;
+
+        CompactResult(CompactResult &&) = delete;
+        CompactResult & operator=(CompactResult &&) = delete;
+
+        ~CompactResult() noexcept { }
+
+        template <typename T>
+        [[nodiscard]] T & Get() noexcept
+        {
+            if constexpr (std::same_as<T, Faulted>)
+            {
+                return faulted;
+            }
+            else
+            {
+                return completed;
+            }
+        }
+
+        template <typename T>
+        [[nodiscard]] T const & Get() const noexcept
+        {
+            if constexpr (std::same_as<T, Faulted>)
+            {
+                return faulted;
+            }
+            else
+            {
+                return completed;
+            }
+        }
+
+        template <typename T, typename... TArgs>
+        void Emplace(TArgs &&... args)
+        {
+            std::construct_at(std::addressof(Get<T>()), std::forward<TArgs>(args)...);
+        }
+
+        template <typename T>
+        void Destroy() noexcept
+        {
+            std::destroy_at(std::addressof(Get<T>()));
+        }
+    };
+
 }  // namespace TaskSystem::Detail
\ No newline at end of file
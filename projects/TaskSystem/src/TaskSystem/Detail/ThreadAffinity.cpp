@@ -0,0 +1,39 @@
+#include <TaskSystem/Detail/ThreadAffinity.hpp>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+namespace TaskSystem::Detail
+{
+
+    bool PinCurrentThread(std::size_t cpu) noexcept
+    {
+#if defined(_WIN32)
+        if (cpu >= sizeof(DWORD_PTR) * 8u)
+        {
+            return false;
+        }
+
+        return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) != 0;
+#else
+        if (cpu >= CPU_SETSIZE)
+        {
+            return false;
+        }
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#endif
+    }
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+
+
+namespace TaskSystem::Detail
+{
+
+    /// <summary>
+    /// Restricts the calling thread to a single logical CPU, returns false if the operating system refused
+    /// </summary>
+    /// <remarks>
+    /// On Windows only the calling thread's processor group can be addressed, i.e. the first 64 CPUs
+    /// </remarks>
+    bool PinCurrentThread(std::size_t cpu) noexcept;
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
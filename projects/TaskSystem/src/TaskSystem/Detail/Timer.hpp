@@ -0,0 +1,84 @@
+#pragma once
+
+#include <TaskSystem/Deadline.hpp>
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/Detail/TimingWheel.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+
+namespace TaskSystem
+{
+    class TimerService;
+}
+
+
+namespace TaskSystem::Detail
+{
+
+    class Timer;
+
+    // Queues a timer on one of the timer service's inboxes, a timer has one for arming and one for cancelling
+    struct TimerHook final : QueueHook
+    {
+        Timer * Owner = nullptr;
+    };
+
+    /// <summary>
+    /// Base of anything waiting on a TimerService, armed once and then either expires or is cancelled
+    /// </summary>
+    /// <remarks>
+    /// The service calls exactly one of OnExpired or OnCancelled on the thread driving it and does not touch the
+    /// timer afterwards, so either can destroy it. OnCancelled is only called for timers that were cancelled
+    /// </remarks>
+    class Timer : private TimerNode
+    {
+        friend class TaskSystem::TimerService;
+
+    private:
+        enum class TimerState : std::uint8_t
+        {
+            Armed,
+            Expired,
+            Cancelled
+        };
+
+        // Where the driving thread has put the timer, only touched by that thread
+        enum class Placement : std::uint8_t
+        {
+            Inbox,
+            Wheel,
+            Removed
+        };
+
+        std::atomic<TimerState> state = TimerState::Armed;
+
+        Placement placement = Placement::Inbox;
+        bool cancelReceived = false;
+
+        TimerHook armHook;
+        TimerHook cancelHook;
+
+    public:
+        Timer() noexcept
+        {
+            armHook.Owner = this;
+            cancelHook.Owner = this;
+        }
+
+        Timer(Timer const &) = delete;
+        Timer & operator=(Timer const &) = delete;
+
+        Timer(Timer &&) = delete;
+        Timer & operator=(Timer &&) = delete;
+
+        virtual ~Timer() noexcept = default;
+
+    protected:
+        virtual void OnExpired() noexcept = 0;
+
+        virtual void OnCancelled() noexcept { }
+    };
+
+}  // namespace TaskSystem::Detail
@@ -0,0 +1,150 @@
+#include <TaskSystem/Detail/TimingWheel.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <utility>
+
+
+namespace TaskSystem::Detail
+{
+
+    void TimingWheel::Insert(TimerNode & node) noexcept
+    {
+        assert(!node.Linked);
+
+        Place(node);
+    }
+
+    void TimingWheel::Remove(TimerNode & node) noexcept
+    {
+        assert(node.Linked);
+
+        if (node.Previous)
+        {
+            node.Previous->Next = node.Next;
+        }
+        else
+        {
+            buckets[node.Bucket] = node.Next;
+        }
+
+        if (node.Next)
+        {
+            node.Next->Previous = node.Previous;
+        }
+
+        if (buckets[node.Bucket] == nullptr && node.Bucket != DueBucket)
+        {
+            occupied[node.Bucket / SlotCount] &= ~(std::uint64_t(1u) << (node.Bucket % SlotCount));
+        }
+
+        node.Previous = nullptr;
+        node.Next = nullptr;
+        node.Linked = false;
+        --size;
+    }
+
+    std::uint64_t TimingWheel::NextTick() const noexcept
+    {
+        if (buckets[DueBucket] != nullptr)
+        {
+            return now;
+        }
+
+        return NextSlotTick();
+    }
+
+    std::uint64_t TimingWheel::NextSlotTick() const noexcept
+    {
+        auto result = NoExpiry;
+
+        for (auto level = std::size_t(0u); level < LevelCount; ++level)
+        {
+            auto bits = occupied[level];
+            if (bits == 0u)
+            {
+                continue;
+            }
+
+            auto shift = SlotBits * level;
+            auto current = (now >> shift) & (SlotCount - 1u);
+
+            // Slots after the current one are reached in this rotation of the level, the rest in the next one
+            auto later = bits & ~((std::uint64_t(2u) << current) - 1u);
+            auto slot = later != 0u ? std::uint64_t(std::countr_zero(later))
+                                    : std::uint64_t(std::countr_zero(bits)) + SlotCount;
+
+            result = std::min(result, ((now >> shift) - current + slot) << shift);
+        }
+
+        return result;
+    }
+
+    void TimingWheel::Place(TimerNode & node) noexcept
+    {
+        if (node.Expiry <= now)
+        {
+            Link(node, DueBucket);
+            return;
+        }
+
+        auto delta = std::min(node.Expiry - now, MaxDelta);
+        auto level = static_cast<std::size_t>(std::bit_width(delta) - 1u) / SlotBits;
+        auto slot = ((now + delta) >> (SlotBits * level)) & (SlotCount - 1u);
+
+        Link(node, BucketOf(level, slot));
+    }
+
+    void TimingWheel::Link(TimerNode & node, std::size_t bucket) noexcept
+    {
+        auto *& head = buckets[bucket];
+
+        node.Previous = nullptr;
+        node.Next = head;
+        if (head)
+        {
+            head->Previous = &node;
+        }
+        head = &node;
+
+        if (bucket != DueBucket)
+        {
+            occupied[bucket / SlotCount] |= std::uint64_t(1u) << (bucket % SlotCount);
+        }
+
+        node.Bucket = static_cast<std::uint16_t>(bucket);
+        node.Linked = true;
+        ++size;
+    }
+
+    TimerNode * TimingWheel::Take(std::size_t bucket) noexcept
+    {
+        auto * first = std::exchange(buckets[bucket], nullptr);
+
+        if (bucket != DueBucket)
+        {
+            occupied[bucket / SlotCount] &= ~(std::uint64_t(1u) << (bucket % SlotCount));
+        }
+
+        for (auto * node = first; node; node = node->Next)
+        {
+            node->Linked = false;
+            --size;
+        }
+
+        return first;
+    }
+
+    void TimingWheel::Cascade(std::size_t level) noexcept
+    {
+        auto * node = Take(BucketOf(level, (now >> (SlotBits * level)) & (SlotCount - 1u)));
+        while (node)
+        {
+            auto * next = node->Next;
+            Place(*node);
+            node = next;
+        }
+    }
+
+}  // namespace TaskSystem::Detail
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace TaskSystem::Detail
+{
+
+    /// <summary>
+    /// Intrusive entry of a TimingWheel, expires at the tick in Expiry
+    /// </summary>
+    struct TimerNode
+    {
+        TimerNode * Previous = nullptr;
+        TimerNode * Next = nullptr;
+
+        std::uint64_t Expiry = 0u;
+
+        // Note: owned by the wheel, the list the node is linked into so it can be unlinked in constant time
+        std::uint16_t Bucket = 0u;
+        bool Linked = false;
+    };
+
+    /// <summary>
+    /// Hierarchical hashed timing wheel with constant time insert and remove
+    /// </summary>
+    /// <remarks>
+    /// Each level has 64 slots, a slot on level l spans 64^l ticks. Timers are placed on the lowest level that covers
+    /// their remaining time and cascade down a level each time the wheel reaches the start of their slot, so a timer
+    /// is moved at most once per level. Occupancy bitmaps let Advance jump straight to the next occupied slot rather
+    /// than stepping every tick. Timers beyond the top level wait in its slots and are re-placed until they are in
+    /// range. Not thread-safe, the owner inserts, removes and advances from one thread at a time
+    /// </remarks>
+    class TimingWheel final
+    {
+    public:
+        static inline constexpr std::size_t SlotBits = 6u;
+        static inline constexpr std::size_t SlotCount = std::size_t(1u) << SlotBits;
+        static inline constexpr std::size_t LevelCount = 6u;
+
+        // Timers further out than this are clamped to the top level until they come in range
+        static inline constexpr std::uint64_t MaxDelta = (std::uint64_t(1u) << (SlotBits * LevelCount)) - 1u;
+
+        static inline constexpr std::uint64_t NoExpiry = ~std::uint64_t(0u);
+
+    private:
+        // Timers inserted at or before the current tick, expired by the next Advance
+        static inline constexpr std::size_t DueBucket = LevelCount * SlotCount;
+
+        std::array<TimerNode *, DueBucket + 1u> buckets{};
+        std::array<std::uint64_t, LevelCount> occupied{};
+
+        std::uint64_t now;
+        std::size_t size = 0u;
+
+    public:
+        explicit TimingWheel(std::uint64_t now = 0u) noexcept : now(now) { }
+
+        TimingWheel(TimingWheel const &) = delete;
+        TimingWheel & operator=(TimingWheel const &) = delete;
+
+        TimingWheel(TimingWheel &&) = delete;
+        TimingWheel & operator=(TimingWheel &&) = delete;
+
+        [[nodiscard]] std::uint64_t Now() const noexcept { return now; }
+
+        [[nodiscard]] std::size_t Size() const noexcept { return size; }
+
+        [[nodiscard]] bool Empty() const noexcept { return size == 0u; }
+
+        /// <summary>
+        /// Adds a node that is not in the wheel, a node that has already expired is expired by the next Advance
+        /// </summary>
+        void Insert(TimerNode & node) noexcept;
+
+        /// <summary>
+        /// Removes a node that is in the wheel
+        /// </summary>
+        void Remove(TimerNode & node) noexcept;
+
+        /// <summary>
+        /// Earliest tick at which Advance might expire a node, NoExpiry when the wheel is empty
+        /// </summary>
+        /// <remarks>
+        /// A lower bound, the tick can be a cascade that only moves nodes down a level
+        /// </remarks>
+        [[nodiscard]] std::uint64_t NextTick() const noexcept;
+
+        /// <summary>
+        /// Moves the wheel on to tick, calling onExpired with each node that expires. Nodes are removed before
+        /// onExpired is called so it can destroy them; returns the number of expired nodes
+        /// </summary>
+        template <typename TOnExpired>
+        std::size_t Advance(std::uint64_t tick, TOnExpired && onExpired)
+        {
+            auto expired = ExpireBucket(DueBucket, onExpired);
+
+            while (now < tick)
+            {
+                auto next = NextSlotTick();
+                if (next > tick)
+                {
+                    now = tick;
+                    break;
+                }
+
+                now = next;
+
+                // Note: top down so nodes cascading through several levels all land in this tick's slots
+                for (auto level = LevelCount - 1u; level != 0u; --level)
+                {
+                    if ((now & LevelMask(level)) == 0u)
+                    {
+                        Cascade(level);
+                    }
+                }
+
+                expired += ExpireBucket(BucketOf(0u, now & (SlotCount - 1u)), onExpired);
+
+                // Nodes that cascaded onto this exact tick
+                expired += ExpireBucket(DueBucket, onExpired);
+            }
+
+            return expired;
+        }
+
+    private:
+        [[nodiscard]] static constexpr std::uint64_t LevelMask(std::size_t level) noexcept
+        {
+            return (std::uint64_t(1u) << (SlotBits * level)) - 1u;
+        }
+
+        [[nodiscard]] static constexpr std::size_t BucketOf(std::size_t level, std::uint64_t slot) noexcept
+        {
+            return level * SlotCount + static_cast<std::size_t>(slot);
+        }
+
+        // Earliest tick after now at which an occupied slot is reached, NoExpiry when every level is empty
+        [[nodiscard]] std::uint64_t NextSlotTick() const noexcept;
+
+        void Place(TimerNode & node) noexcept;
+
+        void Link(TimerNode & node, std::size_t bucket) noexcept;
+
+        // Unlinks every node in the bucket, returns the first
+        [[nodiscard]] TimerNode * Take(std::size_t bucket) noexcept;
+
+        void Cascade(std::size_t level) noexcept;
+
+        template <typename TOnExpired>
+        std::size_t ExpireBucket(std::size_t bucket, TOnExpired & onExpired)
+        {
+            auto expired = std::size_t(0u);
+
+            auto * node = Take(bucket);
+            while (node)
+            {
+                auto * next = node->Next;
+                node->Previous = nullptr;
+                node->Next = nullptr;
+
+                if (node->Expiry <= now)
+                {
+                    ++expired;
+                    onExpired(*node);
+                }
+                else
+                {
+                    Place(*node);
+                }
+
+                node = next;
+            }
+
+            return expired;
+        }
+    };
+
+}  // namespace TaskSystem::Detail
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <TaskSystem/Detail/Utils.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+
+namespace TaskSystem::Detail
+{
+
+    /// <summary>
+    /// Chase-Lev work-stealing deque
+    /// </summary>
+    /// <remarks>
+    /// The owning thread pushes and pops at the bottom, any other thread can steal from the top. Implementation follows
+    /// "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al. 2013). Retired buffers are kept alive
+    /// until the deque is destroyed so a concurrent thief never reads from freed memory
+    /// </remarks>
+    /// <typeparam name="T">Trivially copyable item type, usually a pointer</typeparam>
+    template <typename T>
+    class WorkStealingDeque final
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque items must be trivially copyable");
+
+    private:
+        class Buffer final
+        {
+        private:
+            std::int64_t capacity;
+            std::int64_t mask;
+            std::unique_ptr<std::atomic<T>[]> items;
+
+        public:
+            explicit Buffer(std::int64_t capacity)
+              : capacity(capacity), mask(capacity - 1), items(std::make_unique<std::atomic<T>[]>(capacity))
+            { }
+
+            [[nodiscard]] std::int64_t Capacity() const noexcept { return capacity; }
+
+            [[nodiscard]] T Get(std::int64_t index) const noexcept
+            {
+                return items[index & mask].load(std::memory_order_relaxed);
+            }
+
+            void Put(std::int64_t index, T value) noexcept
+            {
+                items[index & mask].store(value, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] std::unique_ptr<Buffer> Grow(std::int64_t bottom, std::int64_t top) const
+            {
+                auto result = std::make_unique<Buffer>(capacity * 2);
+                for (auto i = top; i != bottom; ++i)
+                {
+                    result->Put(i, Get(i));
+                }
+                return result;
+            }
+        };
+
+#pragma warning(disable : 4324)
+        // Disable: warning C4324: structure was padded due to alignment specifier
+        // top is written by thieves and bottom by the owner, keep them on separate cache lines
+        alignas(CacheLineSize) std::atomic<std::int64_t> top;
+        alignas(CacheLineSize) std::atomic<std::int64_t> bottom;
+        alignas(CacheLineSize) std::atomic<Buffer *> buffer;
+#pragma warning(default : 4324)
+
+        // Note: only accessed by the owning thread
+        std::vector<std::unique_ptr<Buffer>> buffers;
+
+    public:
+        explicit WorkStealingDeque(std::int64_t initialCapacity = 256) : top(0), bottom(0), buffer(nullptr)
+        {
+            // Note: capacity must be a power of two for the index mask
+            auto capacity = std::int64_t(1);
+            while (capacity < initialCapacity)
+            {
+                capacity <<= 1;
+            }
+
+            buffers.emplace_back(std::make_unique<Buffer>(capacity));
+            buffer.store(buffers.back().get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(WorkStealingDeque const &) = delete;
+        WorkStealingDeque & operator=(WorkStealingDeque const &) = delete;
+
+        WorkStealingDeque(WorkStealingDeque &&) = delete;
+        WorkStealingDeque & operator=(WorkStealingDeque &&) = delete;
+
+        ~WorkStealingDeque() noexcept = default;
+
+        /// <summary>
+        /// Approximate number of items, exact only when called from the owner with no concurrent thieves
+        /// </summary>
+        [[nodiscard]] size_t Size() const noexcept
+        {
+            auto b = bottom.load(std::memory_order_relaxed);
+            auto t = top.load(std::memory_order_relaxed);
+            return b > t ? static_cast<size_t>(b - t) : 0u;
+        }
+
+        [[nodiscard]] bool Empty() const noexcept { return Size() == 0u; }
+
+        /// <summary>
+        /// Pushes an item onto the bottom of the deque, must only be called by the owning thread
+        /// </summary>
+        void Push(T value)
+        {
+            auto b = bottom.load(std::memory_order_relaxed);
+            auto t = top.load(std::memory_order_acquire);
+            auto * buf = buffer.load(std::memory_order_relaxed);
+
+            if (b - t > buf->Capacity() - 1) [[unlikely]]
+            {
+                buffers.emplace_back(buf->Grow(b, t));
+                buf = buffers.back().get();
+                buffer.store(buf, std::memory_order_release);
+            }
+
+            buf->Put(b, value);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+
+        /// <summary>
+        /// Pushes count items taken from next(), must only be called by the owning thread
+        /// </summary>
+        /// <remarks>
+        /// The items are written first and published to thieves with a single store of bottom
+        /// </remarks>
+        template <std::invocable TNext>
+        void PushBatch(size_t count, TNext && next)
+        {
+            auto b = bottom.load(std::memory_order_relaxed);
+            auto t = top.load(std::memory_order_acquire);
+            auto * buf = buffer.load(std::memory_order_relaxed);
+            auto n = static_cast<std::int64_t>(count);
+
+            if (b - t + n > buf->Capacity()) [[unlikely]]
+            {
+                while (b - t + n > buf->Capacity())
+                {
+                    buffers.emplace_back(buf->Grow(b, t));
+                    buf = buffers.back().get();
+                }
+                buffer.store(buf, std::memory_order_release);
+            }
+
+            for (auto i = std::int64_t(0); i < n; ++i)
+            {
+                buf->Put(b + i, next());
+            }
+
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom.store(b + n, std::memory_order_relaxed);
+        }
+
+        /// <summary>
+        /// Pops the most recently pushed item, must only be called by the owning thread
+        /// </summary>
+        [[nodiscard]] std::optional<T> Pop() noexcept
+        {
+            auto b = bottom.load(std::memory_order_relaxed) - 1;
+            auto * buf = buffer.load(std::memory_order_relaxed);
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto t = top.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // Empty
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            auto value = buf->Get(b);
+            if (t != b)
+            {
+                // More than one item left, no race with thieves
+                return value;
+            }
+
+            // Last item, race against thieves for it
+            auto won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+
+            if (!won)
+            {
+                return std::nullopt;
+            }
+
+            return value;
+        }
+
+        /// <summary>
+        /// Steals the oldest item, can be called from any thread
+        /// </summary>
+        /// <remarks>
+        /// Returns std::nullopt when the deque is empty or when another thread won the race for the item
+        /// </remarks>
+        [[nodiscard]] std::optional<T> Steal() noexcept
+        {
+            auto t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto b = bottom.load(std::memory_order_acquire);
+
+            if (t >= b)
+            {
+                return std::nullopt;
+            }
+
+            auto * buf = buffer.load(std::memory_order_acquire);
+            auto value = buf->Get(t);
+
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return std::nullopt;
+            }
+
+            return value;
+        }
+    };
+
+}  // namespace TaskSystem::Detail
\ No newline at end of file
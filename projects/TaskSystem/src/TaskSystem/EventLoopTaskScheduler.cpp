@@ -0,0 +1,152 @@
+#include <TaskSystem/EventLoopTaskScheduler.hpp>
+
+#include <cassert>
+#include <utility>
+
+
+namespace TaskSystem
+{
+
+    void SetCurrentScheduler(ITaskScheduler * scheduler);
+
+    EventLoopTaskScheduler::EventLoopTaskScheduler() noexcept
+      : inbox(), owner(), sleeping(false), wakeup(0), stopping(false)
+    { }
+
+    EventLoopTaskScheduler::~EventLoopTaskScheduler() noexcept = default;
+
+    bool EventLoopTaskScheduler::IsWorkerThread() const noexcept
+    {
+        return owner.load(std::memory_order_acquire) == std::this_thread::get_id();
+    }
+
+    void EventLoopTaskScheduler::Schedule(ScheduleItem && item)
+    {
+        inbox.Push(std::move(item));
+        Wake();
+    }
+
+    void EventLoopTaskScheduler::ScheduleBatch(std::span<ScheduleItem> batch)
+    {
+        auto ready = Detail::ItemBatch();
+        for (auto & item : batch)
+        {
+            ready.Add(std::move(item));
+        }
+
+        inbox.Push(std::move(ready));
+        Wake();
+    }
+
+    void EventLoopTaskScheduler::ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && batch)
+    {
+        inbox.Push(std::move(batch));
+        Wake();
+    }
+
+    size_t EventLoopTaskScheduler::RunUntilIdle() { return RunLoop(false, nullptr); }
+
+    size_t EventLoopTaskScheduler::RunFor(std::chrono::nanoseconds duration)
+    {
+        auto deadline = clock_type::now() + std::chrono::duration_cast<clock_type::duration>(duration);
+        return RunLoop(true, &deadline);
+    }
+
+    size_t EventLoopTaskScheduler::RunForever() { return RunLoop(true, nullptr); }
+
+    void EventLoopTaskScheduler::Stop() noexcept
+    {
+        stopping.store(true, std::memory_order_release);
+        Wake();
+    }
+
+    size_t EventLoopTaskScheduler::RunLoop(bool sleepWhenIdle, clock_type::time_point const * deadline)
+    {
+        [[maybe_unused]] auto previousOwner = owner.exchange(std::this_thread::get_id(), std::memory_order_acq_rel);
+        assert(previousOwner == std::thread::id() && "Only one thread can run the loop at a time");
+
+        auto * previousScheduler = CurrentScheduler();
+        SetCurrentScheduler(this);
+
+        auto count = size_t(0u);
+        while (true)
+        {
+            // Note: each Stop ends exactly one run
+            if (stopping.load(std::memory_order_relaxed) && stopping.exchange(false, std::memory_order_acq_rel))
+            {
+                break;
+            }
+
+            if (RunOne())
+            {
+                ++count;
+                if (deadline && clock_type::now() >= *deadline)
+                {
+                    break;
+                }
+                continue;
+            }
+
+            if (!sleepWhenIdle || (deadline && clock_type::now() >= *deadline))
+            {
+                break;
+            }
+
+            Sleep(deadline);
+        }
+
+        SetCurrentScheduler(previousScheduler);
+        owner.store(std::thread::id(), std::memory_order_release);
+
+        return count;
+    }
+
+    bool EventLoopTaskScheduler::RunOne()
+    {
+        auto item = inbox.Pop();
+        if (!item)
+        {
+            return false;
+        }
+
+        item.Run();
+        return true;
+    }
+
+    bool EventLoopTaskScheduler::HasWork() const noexcept { return !inbox.Empty(); }
+
+    void EventLoopTaskScheduler::Sleep(clock_type::time_point const * deadline)
+    {
+        sleeping.store(true, std::memory_order_relaxed);
+
+        // Pairs with the fence in Wake, either this sees the new item or the producer sees the loop sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (!HasWork() && !stopping.load(std::memory_order_relaxed))
+        {
+            auto woken = deadline ? wakeup.try_acquire_until(*deadline) : (wakeup.acquire(), true);
+            if (woken)
+            {
+                // Note: the producer that released the semaphore has already cleared the flag
+                return;
+            }
+        }
+
+        if (!sleeping.exchange(false, std::memory_order_acq_rel))
+        {
+            // A producer cleared the flag first, take its release so the semaphore never counts past one
+            wakeup.acquire();
+        }
+    }
+
+    void EventLoopTaskScheduler::Wake() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (sleeping.load(std::memory_order_relaxed) && sleeping.exchange(false, std::memory_order_acq_rel))
+        {
+            wakeup.release();
+        }
+    }
+
+}  // namespace TaskSystem
\ No newline at end of file
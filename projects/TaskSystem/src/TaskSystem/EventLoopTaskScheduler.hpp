@@ -0,0 +1,92 @@
+#pragma once
+
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/Detail/ItemInbox.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <semaphore>
+#include <span>
+#include <thread>
+
+
+namespace TaskSystem
+{
+
+    /// <summary>
+    /// Single-threaded scheduler for an owner thread that other threads post work to
+    /// </summary>
+    /// <remarks>
+    /// Schedule can be called from any thread; items go onto lock-free MPSC inboxes and the loop is only woken when it
+    /// is asleep. Only one thread may run the loop at a time, that thread is the owner until the Run call returns
+    /// </remarks>
+    class EventLoopTaskScheduler final : public ITaskScheduler
+    {
+    private:
+        using clock_type = std::chrono::steady_clock;
+
+        Detail::MpscItemInbox inbox;
+
+        std::atomic<std::thread::id> owner;
+
+        // Set by the loop before it sleeps, the producer that clears it releases the semaphore
+        std::atomic<bool> sleeping;
+        std::binary_semaphore wakeup;
+
+        std::atomic<bool> stopping;
+
+    public:
+        EventLoopTaskScheduler() noexcept;
+
+        EventLoopTaskScheduler(EventLoopTaskScheduler const &) = delete;
+        EventLoopTaskScheduler & operator=(EventLoopTaskScheduler const &) = delete;
+
+        EventLoopTaskScheduler(EventLoopTaskScheduler &&) = delete;
+        EventLoopTaskScheduler & operator=(EventLoopTaskScheduler &&) = delete;
+
+        // Items that have not run are discarded
+        ~EventLoopTaskScheduler() noexcept override;
+
+        bool IsWorkerThread() const noexcept override;
+
+        void Schedule(ScheduleItem && item) override;
+
+        void ScheduleBatch(std::span<ScheduleItem> batch) override;
+
+        void ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && batch) override;
+
+        /// <summary>
+        /// Runs items until the inboxes are empty, returns the number of items run
+        /// </summary>
+        size_t RunUntilIdle();
+
+        /// <summary>
+        /// Runs items, sleeping while there is nothing to do, until duration has elapsed or Stop is called
+        /// </summary>
+        size_t RunFor(std::chrono::nanoseconds duration);
+
+        /// <summary>
+        /// Runs items, sleeping while there is nothing to do, until Stop is called
+        /// </summary>
+        size_t RunForever();
+
+        /// <summary>
+        /// Makes the current, or next, run return after the item it is running, can be called from any thread
+        /// </summary>
+        void Stop() noexcept;
+
+    private:
+        size_t RunLoop(bool sleepWhenIdle, clock_type::time_point const * deadline);
+
+        [[nodiscard]] bool RunOne();
+        [[nodiscard]] bool HasWork() const noexcept;
+
+        // Sleeps until woken, stopped or the deadline passes
+        void Sleep(clock_type::time_point const * deadline);
+
+        void Wake() noexcept;
+    };
+
+}  // namespace TaskSystem
\ No newline at end of file
@@ -0,0 +1,13 @@
+#include <TaskSystem/IClock.hpp>
+
+
+namespace TaskSystem
+{
+
+    IClock & DefaultClock() noexcept
+    {
+        static SteadyClock clock;
+        return clock;
+    }
+
+}  // namespace TaskSystem
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <TaskSystem/Deadline.hpp>
+
+
+namespace TaskSystem
+{
+
+    /// <summary>
+    /// Source of the current time for timers, lets tests and simulations run on virtual time
+    /// </summary>
+    class IClock
+    {
+    public:
+        virtual ~IClock() noexcept = default;
+
+        [[nodiscard]] virtual DeadlineClock::time_point Now() const noexcept = 0;
+    };
+
+    /// <summary>
+    /// Reads DeadlineClock, the real monotonic time
+    /// </summary>
+    class SteadyClock final : public IClock
+    {
+    public:
+        [[nodiscard]] DeadlineClock::time_point Now() const noexcept override { return DeadlineClock::now(); }
+    };
+
+    /// <summary>
+    /// Clock used by timer services created without one
+    /// </summary>
+    [[nodiscard]] IClock & DefaultClock() noexcept;
+
+}  // namespace TaskSystem
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+
+namespace TaskSystem
+{
+
+    /// <summary>
+    /// Source of events checked by polling, e.g. socket readiness or expired timers
+    /// </summary>
+    class IPoller
+    {
+    public:
+        virtual ~IPoller() noexcept = default;
+
+        /// <summary>
+        /// Checks for events without blocking and schedules the work they made ready, returns the number of events
+        /// </summary>
+        virtual size_t Poll() noexcept = 0;
+    };
+
+}  // namespace TaskSystem
\ No newline at end of file
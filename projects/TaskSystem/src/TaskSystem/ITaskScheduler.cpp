@@ -1,9 +1,31 @@
+#include <TaskSystem/Detail/IPromise.hpp>
 #include <TaskSystem/ITaskScheduler.hpp>
+#include <TaskSystem/ThreadPoolTaskScheduler.hpp>
+
+#include <utility>
 
 
 namespace TaskSystem
 {
 
+    void ITaskScheduler::ScheduleBatch(std::span<ScheduleItem> items)
+    {
+        for (auto & item : items)
+        {
+            Schedule(std::move(item));
+        }
+    }
+
+    void ITaskScheduler::ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && promises)
+    {
+        while (auto * promise = promises.PopFront())
+        {
+            Schedule(*promise);
+        }
+    }
+
+    void ITaskScheduler::Requeue(ScheduleItem && item) { Schedule(std::move(item)); }
+
     static thread_local ITaskScheduler * current;
 
     void SetCurrentScheduler(ITaskScheduler * scheduler) { current = scheduler; }
@@ -12,8 +34,9 @@ namespace TaskSystem
 
     ITaskScheduler * DefaultScheduler()
     {
-        // ToDo: return global TaskScheduler instance
-        return nullptr;
+        // Note: started on first use, one worker per hardware thread within the CPU quota
+        static ThreadPoolTaskScheduler scheduler;
+        return &scheduler;
     }
 
     bool IsCurrentScheduler(ITaskScheduler * scheduler) { return scheduler == CurrentScheduler(); }
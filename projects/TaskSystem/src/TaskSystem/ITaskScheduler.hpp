@@ -1,11 +1,24 @@
 #pragma once
 
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
 #include <TaskSystem/ScheduleItem.hpp>
 
+#include <exception>
+#include <span>
+
 
 namespace TaskSystem
 {
 
+    /// <summary>
+    /// Fault of work handed to a scheduler that has been stopped, so its awaiters resume rather than hang
+    /// </summary>
+    class SchedulerStopped final : public std::exception
+    {
+    public:
+        [[nodiscard]] char const * what() const noexcept override { return "Scheduler stopped"; }
+    };
+
     class ITaskScheduler
     {
     public:
@@ -14,6 +27,29 @@ namespace TaskSystem
         virtual bool IsWorkerThread() const noexcept = 0;
 
         virtual void Schedule(ScheduleItem && item) = 0;
+
+        /// <summary>
+        /// Schedules every item in the span, moving from them
+        /// </summary>
+        /// <remarks>
+        /// Schedulers override this to publish the items together and wake at most one worker, the default schedules
+        /// them one at a time
+        /// </remarks>
+        virtual void ScheduleBatch(std::span<ScheduleItem> items);
+
+        /// <summary>
+        /// Schedules promises linked through their queue hooks, every promise must already be set to Scheduled
+        /// </summary>
+        virtual void ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && promises);
+
+        /// <summary>
+        /// Schedules an item that gave up its worker so other work can run, e.g. a yielding or preempted task
+        /// </summary>
+        /// <remarks>
+        /// Schedulers that run their own latest item next override this to queue it behind the waiting work instead,
+        /// the default schedules it like any other item
+        /// </remarks>
+        virtual void Requeue(ScheduleItem && item);
     };
 
     // ToDo: Move these to ExecutionContext class
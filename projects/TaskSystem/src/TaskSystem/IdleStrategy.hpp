@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+
+namespace TaskSystem
+{
+
+    /// <summary>
+    /// How long an idle worker keeps checking for new work before it goes to sleep
+    /// </summary>
+    /// <remarks>
+    /// Spinning trades idle CPU for wake latency: a spinning worker picks up new work within a few hundred
+    /// nanoseconds, a sleeping one has to be woken by the operating system which takes several microseconds
+    /// </remarks>
+    struct IdleStrategy final
+    {
+        // Checks separated by a pause instruction, tens of nanoseconds each
+        std::uint32_t SpinCount = 0u;
+
+        // Checks separated by giving up the rest of the time slice
+        std::uint32_t YieldCount = 0u;
+
+        // Sleeps as soon as there is no work, lowest idle CPU
+        [[nodiscard]] static constexpr IdleStrategy PowerSaving() noexcept { return IdleStrategy{ 0u, 0u }; }
+
+        // Spins for roughly a few microseconds before sleeping
+        [[nodiscard]] static constexpr IdleStrategy Balanced() noexcept { return IdleStrategy{ 256u, 4u }; }
+
+        // Spins for tens to hundreds of microseconds before sleeping, for latency sensitive work
+        [[nodiscard]] static constexpr IdleStrategy LowLatency() noexcept { return IdleStrategy{ 8192u, 64u }; }
+    };
+
+}  // namespace TaskSystem
\ No newline at end of file
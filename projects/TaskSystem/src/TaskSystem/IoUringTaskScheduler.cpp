@@ -0,0 +1,326 @@
+#include <TaskSystem/IoUringTaskScheduler.hpp>
+
+#if defined(__linux__)
+
+#include <TaskSystem/Detail/EpollIoBackend.hpp>
+#include <TaskSystem/Detail/IoUringBackend.hpp>
+#include <TaskSystem/Detail/Utils.hpp>
+
+#include <cassert>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+
+namespace TaskSystem
+{
+
+    void SetCurrentScheduler(ITaskScheduler * scheduler);
+
+    namespace
+    {
+        // Items run between checks for completions, so a busy loop does not hold back I/O
+        constexpr size_t ItemsPerIteration = 64u;
+
+    }  // namespace
+
+    namespace Detail
+    {
+
+        void IoAwaitableBase::await_suspend(std::coroutine_handle<>, IPromise & callerPromise)
+        {
+            if (!callerPromise.TrySetSuspended())
+            {
+                throw std::runtime_error("Unable to set caller promise to suspended");
+            }
+
+            operation.Caller = &callerPromise;
+            operation.Scheduler = FirstOf(CurrentScheduler(), static_cast<ITaskScheduler *>(&scheduler));
+
+            // Note: the caller can be resumed, and this awaitable destroyed, before Submit returns
+            scheduler.Submit(operation);
+        }
+
+        void IoAwaitableBase::ThrowIfFailed() const
+        {
+            if (operation.Result < 0)
+            {
+                throw std::system_error(-operation.Result, std::system_category());
+            }
+        }
+
+    }  // namespace Detail
+
+    IoUringTaskScheduler::IoUringTaskScheduler(IoUringOptions const & options)
+      : inbox()
+      , submissions()
+      , backend()
+      , inFlight(0u)
+      , owner()
+      , sleeping(false)
+      , stopping(false)
+    {
+        if (!options.ForceFallback)
+        {
+            backend = Detail::IoUringBackend::TryCreate(options.Entries);
+        }
+
+        if (!backend)
+        {
+            backend = std::make_unique<Detail::EpollIoBackend>(options.FallbackThreads);
+        }
+    }
+
+    IoUringTaskScheduler::~IoUringTaskScheduler() noexcept = default;
+
+    bool IoUringTaskScheduler::IsWorkerThread() const noexcept
+    {
+        return owner.load(std::memory_order_acquire) == std::this_thread::get_id();
+    }
+
+    void IoUringTaskScheduler::Schedule(ScheduleItem && item)
+    {
+        inbox.Push(std::move(item));
+        Wake();
+    }
+
+    void IoUringTaskScheduler::ScheduleBatch(std::span<ScheduleItem> batch)
+    {
+        auto ready = Detail::ItemBatch();
+        for (auto & item : batch)
+        {
+            ready.Add(std::move(item));
+        }
+
+        inbox.Push(std::move(ready));
+        Wake();
+    }
+
+    void IoUringTaskScheduler::ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && batch)
+    {
+        inbox.Push(std::move(batch));
+        Wake();
+    }
+
+    size_t IoUringTaskScheduler::RunUntilIdle() { return RunLoop(false, nullptr); }
+
+    size_t IoUringTaskScheduler::RunFor(std::chrono::nanoseconds duration)
+    {
+        auto deadline = clock_type::now() + std::chrono::duration_cast<clock_type::duration>(duration);
+        return RunLoop(true, &deadline);
+    }
+
+    size_t IoUringTaskScheduler::RunForever() { return RunLoop(true, nullptr); }
+
+    void IoUringTaskScheduler::Stop() noexcept
+    {
+        stopping.store(true, std::memory_order_release);
+        Wake();
+    }
+
+    bool IoUringTaskScheduler::UsesIoUring() const noexcept { return backend->IsIoUring(); }
+
+    Detail::IoAwaitable<std::size_t> IoUringTaskScheduler::ReadAsync(
+        int fd, std::span<std::byte> buffer, std::uint64_t offset)
+    {
+        auto operation = Detail::IoOperation();
+        operation.Kind = Detail::IoOperationKind::Read;
+        operation.Fd = fd;
+        operation.Buffer = buffer.data();
+        operation.Length = buffer.size();
+        operation.Offset = offset;
+        return Detail::IoAwaitable<std::size_t>(*this, operation);
+    }
+
+    Detail::IoAwaitable<std::size_t> IoUringTaskScheduler::WriteAsync(
+        int fd, std::span<std::byte const> buffer, std::uint64_t offset)
+    {
+        auto operation = Detail::IoOperation();
+        operation.Kind = Detail::IoOperationKind::Write;
+        operation.Fd = fd;
+        // Note: only read from, the operation shares one buffer field for both directions
+        operation.Buffer = const_cast<std::byte *>(buffer.data());
+        operation.Length = buffer.size();
+        operation.Offset = offset;
+        return Detail::IoAwaitable<std::size_t>(*this, operation);
+    }
+
+    Detail::IoAwaitable<int> IoUringTaskScheduler::AcceptAsync(int fd)
+    {
+        auto operation = Detail::IoOperation();
+        operation.Kind = Detail::IoOperationKind::Accept;
+        operation.Fd = fd;
+        return Detail::IoAwaitable<int>(*this, operation);
+    }
+
+    Detail::IoAwaitable<void> IoUringTaskScheduler::ConnectAsync(int fd, sockaddr const * address, socklen_t length)
+    {
+        auto operation = Detail::IoOperation();
+        operation.Kind = Detail::IoOperationKind::Connect;
+        operation.Fd = fd;
+        operation.Address = address;
+        operation.AddressLength = length;
+        return Detail::IoAwaitable<void>(*this, operation);
+    }
+
+    Detail::IoAwaitable<void> IoUringTaskScheduler::FsyncAsync(int fd)
+    {
+        auto operation = Detail::IoOperation();
+        operation.Kind = Detail::IoOperationKind::Fsync;
+        operation.Fd = fd;
+        return Detail::IoAwaitable<void>(*this, operation);
+    }
+
+    size_t IoUringTaskScheduler::RunLoop(bool sleepWhenIdle, clock_type::time_point const * deadline)
+    {
+        [[maybe_unused]] auto previousOwner = owner.exchange(std::this_thread::get_id(), std::memory_order_acq_rel);
+        assert(previousOwner == std::thread::id() && "Only one thread can run the loop at a time");
+
+        auto * previousScheduler = CurrentScheduler();
+        SetCurrentScheduler(this);
+
+        auto count = size_t(0u);
+        while (true)
+        {
+            // Note: each Stop ends exactly one run
+            if (stopping.load(std::memory_order_relaxed) && stopping.exchange(false, std::memory_order_acq_rel))
+            {
+                break;
+            }
+
+            auto ran = size_t(0u);
+            while (ran < ItemsPerIteration && RunOne())
+            {
+                ++ran;
+            }
+
+            // Note: operations started by the items above go out in the same batch
+            ReceiveSubmissions();
+            ran += ProcessIo(false, nullptr);
+            count += ran;
+
+            if (deadline && clock_type::now() >= *deadline)
+            {
+                break;
+            }
+
+            if (ran != 0u || HasWork())
+            {
+                continue;
+            }
+
+            if (!sleepWhenIdle && inFlight == 0u)
+            {
+                break;
+            }
+
+            sleeping.store(true, std::memory_order_relaxed);
+
+            // Note: a later push sees the flag and wakes the backend, an earlier one is seen by HasWork
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            auto wait = !HasWork() && !stopping.load(std::memory_order_relaxed);
+            count += ProcessIo(wait, deadline);
+
+            // Note: a producer that cleared the flag first has woken the backend, the next wait returns early
+            sleeping.store(false, std::memory_order_relaxed);
+        }
+
+        SetCurrentScheduler(previousScheduler);
+        owner.store(std::thread::id(), std::memory_order_release);
+
+        return count;
+    }
+
+    bool IoUringTaskScheduler::RunOne()
+    {
+        auto item = inbox.Pop();
+        if (!item)
+        {
+            return false;
+        }
+
+        item.Run();
+        return true;
+    }
+
+    bool IoUringTaskScheduler::HasWork() const noexcept
+    {
+        return !inbox.Empty() || !submissions.Empty();
+    }
+
+    void IoUringTaskScheduler::Submit(Detail::IoOperation & operation) noexcept
+    {
+        if (IsWorkerThread())
+        {
+            backend->Submit(operation);
+            ++inFlight;
+            return;
+        }
+
+        submissions.Push(operation);
+        Wake();
+    }
+
+    void IoUringTaskScheduler::ReceiveSubmissions() noexcept
+    {
+        while (auto * operation = submissions.Pop())
+        {
+            backend->Submit(*operation);
+            ++inFlight;
+        }
+    }
+
+    size_t IoUringTaskScheduler::ProcessIo(bool wait, clock_type::time_point const * deadline)
+    {
+        if (!wait && inFlight == 0u)
+        {
+            return 0u;
+        }
+
+        auto completed = backend->Process(wait, deadline);
+        auto count = completed.Size();
+        inFlight -= count;
+
+        while (auto * operation = completed.PopFront())
+        {
+            Resume(*operation);
+        }
+
+        return count;
+    }
+
+    void IoUringTaskScheduler::Resume(Detail::IoOperation & operation)
+    {
+        // Note: the operation is in the caller's frame, nothing reads it once the caller is resumed
+        auto & caller = *operation.Caller;
+        auto * scheduler = operation.Scheduler;
+
+        if (!caller.TrySetScheduled())
+        {
+            return;
+        }
+
+        if (scheduler == this)
+        {
+            ScheduleItem(caller).Execute();
+        }
+        else
+        {
+            scheduler->Schedule(ScheduleItem(caller));
+        }
+    }
+
+    void IoUringTaskScheduler::Wake() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (sleeping.load(std::memory_order_relaxed) && sleeping.exchange(false, std::memory_order_acq_rel))
+        {
+            backend->Wake();
+        }
+    }
+
+}  // namespace TaskSystem
+
+#endif
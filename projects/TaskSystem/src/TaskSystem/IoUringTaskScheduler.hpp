@@ -0,0 +1,232 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/Detail/ItemInbox.hpp>
+#include <TaskSystem/Detail/IoOperation.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+#include <type_traits>
+
+
+namespace TaskSystem
+{
+
+    struct IoUringOptions final
+    {
+        // Size of the submission ring, operations beyond it are submitted on a later loop iteration
+        std::uint32_t Entries = 256u;
+
+        // Threads for files, connect and fsync when io_uring is not available
+        std::size_t FallbackThreads = 2u;
+
+        // Uses the epoll and thread pool fallback even when io_uring is available
+        bool ForceFallback = false;
+    };
+
+    class IoUringTaskScheduler;
+
+    namespace Detail
+    {
+
+        class IoAwaitableBase
+        {
+        protected:
+            IoUringTaskScheduler & scheduler;
+            IoOperation operation;
+
+        public:
+            IoAwaitableBase(IoUringTaskScheduler & scheduler, IoOperation const & operation) noexcept
+              : scheduler(scheduler), operation(operation)
+            { }
+
+            IoAwaitableBase(IoAwaitableBase const &) = delete;
+            IoAwaitableBase & operator=(IoAwaitableBase const &) = delete;
+
+            IoAwaitableBase(IoAwaitableBase &&) = delete;
+            IoAwaitableBase & operator=(IoAwaitableBase &&) = delete;
+
+            ~IoAwaitableBase() noexcept = default;
+
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+            // ToDo: use PromiseType concept
+            template <typename TPromise>
+            void await_suspend(std::coroutine_handle<TPromise> callerHandle)
+            {
+                IPromise & callerPromise = callerHandle.promise();
+                await_suspend(callerHandle, callerPromise);
+            }
+
+            void await_suspend(std::coroutine_handle<> callerHandle, IPromise & callerPromise);
+
+        protected:
+            // Throws std::system_error for a failed operation
+            void ThrowIfFailed() const;
+        };
+
+        /// <summary>
+        /// Submits its operation when awaited and resumes the caller from the scheduler's completion processing
+        /// </summary>
+        /// <remarks>
+        /// The operation lives in the awaitable, so in the caller's frame, nothing is allocated per operation
+        /// </remarks>
+        template <typename TResult>
+        class IoAwaitable final : public IoAwaitableBase
+        {
+        public:
+            using IoAwaitableBase::IoAwaitableBase;
+
+            TResult await_resume()
+            {
+                ThrowIfFailed();
+
+                if constexpr (!std::is_void_v<TResult>)
+                {
+                    return static_cast<TResult>(operation.Result);
+                }
+            }
+        };
+
+    }  // namespace Detail
+
+    /// <summary>
+    /// Event loop that runs tasks and their file and socket operations on io_uring
+    /// </summary>
+    /// <remarks>
+    /// Scheduling works as for EventLoopTaskScheduler. Operations started on the loop thread are batched into the
+    /// submission ring and sent, together with waiting for completions, in one io_uring_enter per loop iteration;
+    /// completions resume their caller directly, inline when it was running on this scheduler. When io_uring is not
+    /// available, or ForceFallback is set, sockets are driven by epoll and other operations by a small thread pool.
+    /// Buffers, addresses and fds must stay valid until the operation's co_await returns
+    /// </remarks>
+    class IoUringTaskScheduler final : public ITaskScheduler
+    {
+    private:
+        friend class Detail::IoAwaitableBase;
+
+        using clock_type = std::chrono::steady_clock;
+
+        Detail::MpscItemInbox inbox;
+
+        // Operations started off the loop thread, handed to the backend by the loop
+        Detail::IntrusiveMpscQueue<Detail::IoOperation> submissions;
+
+        std::unique_ptr<Detail::IIoBackend> backend;
+
+        // Operations handed to the backend that have not completed, only touched by the loop thread
+        std::size_t inFlight;
+
+        std::atomic<std::thread::id> owner;
+
+        // Set by the loop before it blocks in the backend, the producer that clears it wakes the backend
+        std::atomic<bool> sleeping;
+
+        std::atomic<bool> stopping;
+
+    public:
+        // Throws std::system_error if neither io_uring nor the fallback can be set up
+        explicit IoUringTaskScheduler(IoUringOptions const & options = IoUringOptions());
+
+        IoUringTaskScheduler(IoUringTaskScheduler const &) = delete;
+        IoUringTaskScheduler & operator=(IoUringTaskScheduler const &) = delete;
+
+        IoUringTaskScheduler(IoUringTaskScheduler &&) = delete;
+        IoUringTaskScheduler & operator=(IoUringTaskScheduler &&) = delete;
+
+        // Items that have not run are discarded, operations in flight are abandoned and never resume their caller
+        ~IoUringTaskScheduler() noexcept override;
+
+        bool IsWorkerThread() const noexcept override;
+
+        void Schedule(ScheduleItem && item) override;
+
+        void ScheduleBatch(std::span<ScheduleItem> batch) override;
+
+        void ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && batch) override;
+
+        /// <summary>
+        /// Runs items and waits for operations in flight until there is nothing left to do, returns the number of
+        /// items run
+        /// </summary>
+        size_t RunUntilIdle();
+
+        /// <summary>
+        /// Runs items and operations, sleeping while there is nothing to do, until duration has elapsed or Stop is
+        /// called
+        /// </summary>
+        size_t RunFor(std::chrono::nanoseconds duration);
+
+        /// <summary>
+        /// Runs items and operations, sleeping while there is nothing to do, until Stop is called
+        /// </summary>
+        size_t RunForever();
+
+        /// <summary>
+        /// Makes the current, or next, run return after the item it is running, can be called from any thread
+        /// </summary>
+        void Stop() noexcept;
+
+        // False when running on the fallback
+        [[nodiscard]] bool UsesIoUring() const noexcept;
+
+        /// <summary>
+        /// co_await to read up to buffer.size() bytes, returns the number read, 0 at end of file
+        /// </summary>
+        /// <remarks>
+        /// Reads at the file's current position unless an offset is given
+        /// </remarks>
+        [[nodiscard]] Detail::IoAwaitable<std::size_t> ReadAsync(
+            int fd, std::span<std::byte> buffer, std::uint64_t offset = Detail::IoOperation::CurrentOffset);
+
+        /// <summary>
+        /// co_await to write up to buffer.size() bytes, returns the number written
+        /// </summary>
+        [[nodiscard]] Detail::IoAwaitable<std::size_t> WriteAsync(
+            int fd, std::span<std::byte const> buffer, std::uint64_t offset = Detail::IoOperation::CurrentOffset);
+
+        /// <summary>
+        /// co_await for the next connection on a listening socket, returns its fd
+        /// </summary>
+        [[nodiscard]] Detail::IoAwaitable<int> AcceptAsync(int fd);
+
+        /// <summary>
+        /// co_await to connect a socket, the address must outlive the co_await
+        /// </summary>
+        [[nodiscard]] Detail::IoAwaitable<void> ConnectAsync(int fd, sockaddr const * address, socklen_t length);
+
+        /// <summary>
+        /// co_await to flush the file's data and metadata to storage
+        /// </summary>
+        [[nodiscard]] Detail::IoAwaitable<void> FsyncAsync(int fd);
+
+    private:
+        size_t RunLoop(bool sleepWhenIdle, clock_type::time_point const * deadline);
+
+        [[nodiscard]] bool RunOne();
+        [[nodiscard]] bool HasWork() const noexcept;
+
+        // Called by the awaitable once its caller is suspended
+        void Submit(Detail::IoOperation & operation) noexcept;
+        void ReceiveSubmissions() noexcept;
+
+        // Hands operations to the backend and resumes the callers of those that completed, returns how many did
+        size_t ProcessIo(bool wait, clock_type::time_point const * deadline);
+        void Resume(Detail::IoOperation & operation);
+
+        void Wake() noexcept;
+    };
+
+}  // namespace TaskSystem
+
+#endif
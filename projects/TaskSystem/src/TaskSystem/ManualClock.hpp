@@ -0,0 +1,59 @@
+#pragma once
+
+#include <TaskSystem/Deadline.hpp>
+#include <TaskSystem/IClock.hpp>
+
+#include <atomic>
+
+
+namespace TaskSystem
+{
+
+    /// <summary>
+    /// Virtual clock that only moves when it is advanced, so timer-driven code runs without waiting on real time
+    /// </summary>
+    /// <remarks>
+    /// Can be read from any thread. Never moves backwards, advancing to an earlier time does nothing. Timers on a
+    /// manual clock fire when their service is polled after the clock has passed their expiry, see
+    /// SynchronousTaskScheduler::RunUntil
+    /// </remarks>
+    class ManualClock final : public IClock
+    {
+    private:
+        std::atomic<DeadlineClock::rep> now;
+
+    public:
+        explicit ManualClock(DeadlineClock::time_point start = DeadlineClock::time_point()) noexcept
+          : now(start.time_since_epoch().count())
+        { }
+
+        ManualClock(ManualClock const &) = delete;
+        ManualClock & operator=(ManualClock const &) = delete;
+
+        ManualClock(ManualClock &&) = delete;
+        ManualClock & operator=(ManualClock &&) = delete;
+
+        [[nodiscard]] DeadlineClock::time_point Now() const noexcept override
+        {
+            return DeadlineClock::time_point(DeadlineClock::duration(now.load(std::memory_order_acquire)));
+        }
+
+        void Advance(DeadlineClock::duration duration) noexcept
+        {
+            if (duration > DeadlineClock::duration::zero())
+            {
+                now.fetch_add(duration.count(), std::memory_order_acq_rel);
+            }
+        }
+
+        void AdvanceTo(DeadlineClock::time_point time) noexcept
+        {
+            auto target = time.time_since_epoch().count();
+            auto current = now.load(std::memory_order_relaxed);
+            while (current < target
+                   && !now.compare_exchange_weak(current, target, std::memory_order_acq_rel, std::memory_order_relaxed))
+            { }
+        }
+    };
+
+}  // namespace TaskSystem
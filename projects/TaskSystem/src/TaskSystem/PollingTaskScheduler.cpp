@@ -0,0 +1,302 @@
+#include <TaskSystem/Detail/SpinWait.hpp>
+#include <TaskSystem/Detail/ThreadAffinity.hpp>
+#include <TaskSystem/PollingTaskScheduler.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <latch>
+#include <utility>
+
+
+namespace TaskSystem
+{
+
+    void SetCurrentScheduler(ITaskScheduler * scheduler);
+
+    thread_local PollingTaskScheduler::Worker * PollingTaskScheduler::currentWorker = nullptr;
+
+    PollingTaskScheduler::Worker::Worker(PollingTaskScheduler & scheduler, size_t index)
+      : scheduler(scheduler)
+      , index(index)
+      , deque()
+      , randomState(0x9E3779B97F4A7C15ull * (index + 1u))
+      , pinned(false)
+      , thread()
+    { }
+
+    size_t PollingTaskScheduler::Worker::NextVictim() noexcept
+    {
+        // xorshift64
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 7;
+        randomState ^= randomState << 17;
+        return static_cast<size_t>(randomState % scheduler.workers.size());
+    }
+
+    PollingTaskScheduler::PollingTaskScheduler(size_t workerCount)
+      : PollingTaskScheduler(workerCount, std::span<size_t const>())
+    { }
+
+    PollingTaskScheduler::PollingTaskScheduler(std::span<size_t const> cpus) : PollingTaskScheduler(cpus.size(), cpus)
+    { }
+
+    PollingTaskScheduler::PollingTaskScheduler(size_t workerCount, std::span<size_t const> cpus)
+      : workers()
+      , injected()
+      , injectionCount(0u)
+      , pollers()
+      , pollerCount(0u)
+      , pollerMutex()
+      , stopping(false)
+    {
+        workerCount = std::max<size_t>(workerCount, 1u);
+
+        workers.reserve(workerCount);
+        for (auto i = 0u; i < workerCount; ++i)
+        {
+            workers.emplace_back(std::make_unique<Worker>(*this, i));
+        }
+
+        // Note: start threads after all workers exist so thieves never see a partially built vector
+        auto started = std::latch(static_cast<std::ptrdiff_t>(workerCount));
+        for (auto & worker : workers)
+        {
+            auto const * cpu = worker->index < cpus.size() ? &cpus[worker->index] : nullptr;
+
+            worker->thread = std::thread([this, &worker = *worker, cpu, &started]() {
+                if (cpu)
+                {
+                    worker.pinned = Detail::PinCurrentThread(*cpu);
+                }
+
+                started.count_down();
+                WorkerLoop(worker);
+            });
+        }
+
+        // Wait for the workers to pin themselves, cpus is not used after this
+        started.wait();
+    }
+
+    PollingTaskScheduler::~PollingTaskScheduler() noexcept { Stop(); }
+
+    size_t PollingTaskScheduler::PinnedWorkerCount() const noexcept
+    {
+        return static_cast<size_t>(
+            std::count_if(workers.begin(), workers.end(), [](auto const & worker) { return worker->pinned; }));
+    }
+
+    bool PollingTaskScheduler::IsWorkerThread() const noexcept
+    {
+        auto * worker = currentWorker;
+        return worker && &worker->scheduler == this;
+    }
+
+    void PollingTaskScheduler::Schedule(ScheduleItem && item)
+    {
+        auto * worker = currentWorker;
+
+        if (worker && &worker->scheduler == this)
+        {
+            worker->deque.Push(ReadyItem::Box(std::move(item)));
+        }
+        else
+        {
+            Inject(std::move(item));
+        }
+    }
+
+    void PollingTaskScheduler::ScheduleBatch(std::span<ScheduleItem> items)
+    {
+        auto * worker = currentWorker;
+
+        if (worker && &worker->scheduler == this)
+        {
+            for (auto & item : items)
+            {
+                worker->deque.Push(ReadyItem::Box(std::move(item)));
+            }
+            return;
+        }
+
+        auto batch = Detail::ItemBatch();
+        for (auto & item : items)
+        {
+            batch.Add(std::move(item));
+        }
+
+        injectionCount.fetch_add(batch.Size(), std::memory_order_relaxed);
+        injected.Push(std::move(batch));
+    }
+
+    void PollingTaskScheduler::ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && promises)
+    {
+        if (promises.Empty())
+        {
+            return;
+        }
+
+        auto * worker = currentWorker;
+
+        if (worker && &worker->scheduler == this)
+        {
+            worker->deque.PushBatch(promises.Size(), [&]() { return ReadyItem(promises.PopFront()); });
+        }
+        else
+        {
+            injectionCount.fetch_add(promises.Size(), std::memory_order_relaxed);
+            injected.Push(std::move(promises));
+        }
+    }
+
+    void PollingTaskScheduler::Requeue(ScheduleItem && item) { Inject(std::move(item)); }
+
+    void PollingTaskScheduler::AddPoller(IPoller & poller)
+    {
+        std::lock_guard lock(pollerMutex);
+
+        auto count = pollerCount.load(std::memory_order_relaxed);
+        if (count == MaxPollers)
+        {
+            throw std::exception("Too many pollers");
+        }
+
+        pollers[count].store(&poller, std::memory_order_relaxed);
+        pollerCount.store(count + 1u, std::memory_order_release);
+    }
+
+    void PollingTaskScheduler::Stop() noexcept
+    {
+        // Note: only the first call stops the workers, a later one faults whatever was scheduled since
+        if (!stopping.exchange(true, std::memory_order_acq_rel))
+        {
+            for (auto & worker : workers)
+            {
+                if (worker->thread.joinable())
+                {
+                    worker->thread.join();
+                }
+            }
+
+            // Note: all workers have exited so the deques can be drained from this thread. Faulting a promise
+            // schedules its continuations, those bound for this scheduler are injected and faulted below
+            for (auto & worker : workers)
+            {
+                while (auto item = worker->deque.Pop())
+                {
+                    item->Reject();
+                }
+            }
+        }
+
+        injected.Reject();
+        injectionCount.store(0u, std::memory_order_relaxed);
+    }
+
+    void PollingTaskScheduler::Inject(ScheduleItem && item)
+    {
+        // Note: boxed first so a failed allocation leaves the count alone, then counted before the push as workers
+        // only look at the inbox while the count is non-zero
+        auto batch = Detail::ItemBatch();
+        batch.Add(std::move(item));
+
+        injectionCount.fetch_add(1u, std::memory_order_relaxed);
+        injected.Push(std::move(batch));
+    }
+
+    void PollingTaskScheduler::WorkerLoop(Worker & worker)
+    {
+        currentWorker = &worker;
+        SetCurrentScheduler(this);
+
+        auto sincePoll = size_t(0u);
+
+        while (!stopping.load(std::memory_order_acquire))
+        {
+            auto ran = RunOne(worker);
+            if (ran && ++sincePoll < PollInterval)
+            {
+                continue;
+            }
+
+            // Pollers are checked whenever the worker runs out of work, and every PollInterval items while it has work
+            // so a busy worker does not starve them
+            sincePoll = 0u;
+            if (Poll(worker) == 0u && !ran)
+            {
+                Detail::CpuRelax();
+            }
+        }
+
+        SetCurrentScheduler(nullptr);
+        currentWorker = nullptr;
+    }
+
+    bool PollingTaskScheduler::RunOne(Worker & worker) noexcept
+    {
+        if (auto item = worker.deque.Pop())
+        {
+            item->Run();
+            return true;
+        }
+
+        if (injectionCount.load(std::memory_order_relaxed) != 0u)
+        {
+            if (auto item = injected.Pop())
+            {
+                injectionCount.fetch_sub(1u, std::memory_order_relaxed);
+                item.Run();
+                return true;
+            }
+        }
+
+        if (auto item = Steal(worker))
+        {
+            item.Run();
+            return true;
+        }
+
+        return false;
+    }
+
+    PollingTaskScheduler::ReadyItem PollingTaskScheduler::Steal(Worker & worker) noexcept
+    {
+        auto count = workers.size();
+        if (count < 2u)
+        {
+            return ReadyItem();
+        }
+
+        // Start at a random victim and walk all the others once
+        auto start = worker.NextVictim();
+        for (auto i = 0u; i < count; ++i)
+        {
+            auto & victim = *workers[(start + i) % count];
+            if (&victim == &worker)
+            {
+                continue;
+            }
+
+            if (auto item = victim.deque.Steal())
+            {
+                return *item;
+            }
+        }
+
+        return ReadyItem();
+    }
+
+    size_t PollingTaskScheduler::Poll(Worker & worker) noexcept
+    {
+        auto count = pollerCount.load(std::memory_order_acquire);
+        auto events = size_t(0u);
+
+        for (auto i = worker.index; i < count; i += workers.size())
+        {
+            events += pollers[i].load(std::memory_order_relaxed)->Poll();
+        }
+
+        return events;
+    }
+
+}  // namespace TaskSystem
\ No newline at end of file
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/Detail/ItemInbox.hpp>
+#include <TaskSystem/Detail/ReadyItem.hpp>
+#include <TaskSystem/Detail/WorkStealingDeque.hpp>
+#include <TaskSystem/IPoller.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+
+namespace TaskSystem
+{
+
+    /// <summary>
+    /// Multi-threaded scheduler whose workers never sleep, for latency critical work on dedicated cores
+    /// </summary>
+    /// <remarks>
+    /// Workers continuously poll their own deque, the injection queues, their pollers and the other workers' deques.
+    /// Nothing on the schedule or run path makes a system call: the queues are lock-free or spin locked and no worker
+    /// is ever woken, so an item is picked up as soon as a worker next looks. Every worker keeps its core busy until
+    /// Stop is called; pin the workers to isolated cores so they do not compete with other threads
+    /// </remarks>
+    class PollingTaskScheduler final : public ITaskScheduler
+    {
+    public:
+        static inline constexpr size_t MaxPollers = 16u;
+
+        // Items a worker runs between polls while it has work
+        static inline constexpr size_t PollInterval = 61u;
+
+    private:
+        using ReadyItem = Detail::ReadyItem;
+
+        struct Worker final
+        {
+            PollingTaskScheduler & scheduler;
+            size_t index;
+            Detail::WorkStealingDeque<ReadyItem> deque;
+
+            // Note: only accessed by the owning worker
+            std::uint64_t randomState;
+            bool pinned;
+            std::thread thread;
+
+            Worker(PollingTaskScheduler & scheduler, size_t index);
+
+            [[nodiscard]] size_t NextVictim() noexcept;
+        };
+
+        static thread_local Worker * currentWorker;
+
+        std::vector<std::unique_ptr<Worker>> workers;
+
+        Detail::MpmcItemInbox injected;
+
+        // Note: checked before popping so idle workers do not contend on the queues' spin locks
+        std::atomic<size_t> injectionCount;
+
+        // Poller i is only polled by worker i % WorkerCount so pollers do not need to be thread-safe
+        std::array<std::atomic<IPoller *>, MaxPollers> pollers;
+        std::atomic<size_t> pollerCount;
+        std::mutex pollerMutex;
+
+        std::atomic<bool> stopping;
+
+    public:
+        /// <summary>
+        /// Starts workerCount workers that are free to run on any core
+        /// </summary>
+        explicit PollingTaskScheduler(size_t workerCount);
+
+        /// <summary>
+        /// Starts one worker per cpu, worker i is pinned to cpus[i]
+        /// </summary>
+        explicit PollingTaskScheduler(std::span<size_t const> cpus);
+
+        PollingTaskScheduler(PollingTaskScheduler const &) = delete;
+        PollingTaskScheduler & operator=(PollingTaskScheduler const &) = delete;
+
+        PollingTaskScheduler(PollingTaskScheduler &&) = delete;
+        PollingTaskScheduler & operator=(PollingTaskScheduler &&) = delete;
+
+        ~PollingTaskScheduler() noexcept override;
+
+        [[nodiscard]] size_t WorkerCount() const noexcept { return workers.size(); }
+
+        // Workers the operating system agreed to pin, fixed once the constructor returns
+        [[nodiscard]] size_t PinnedWorkerCount() const noexcept;
+
+        bool IsWorkerThread() const noexcept override;
+
+        void Schedule(ScheduleItem && item) override;
+
+        void ScheduleBatch(std::span<ScheduleItem> items) override;
+
+        void ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && promises) override;
+
+        // Goes through the injection queue, behind everything already waiting, rather than the worker's own deque
+        void Requeue(ScheduleItem && item) override;
+
+        /// <summary>
+        /// Adds a poller for the workers to check alongside their queues, throws when MaxPollers have been added
+        /// </summary>
+        /// <remarks>
+        /// The poller must outlive the workers, i.e. until Stop returns or the scheduler is destroyed
+        /// </remarks>
+        void AddPoller(IPoller & poller);
+
+        /// <summary>
+        /// Ends the polling loops and joins their threads, queued items are discarded without running
+        /// </summary>
+        /// <remarks>
+        /// Promises are faulted with SchedulerStopped so their awaiters resume rather than hang. Calling it again
+        /// faults the promises scheduled since
+        /// </remarks>
+        void Stop() noexcept;
+
+    private:
+        PollingTaskScheduler(size_t workerCount, std::span<size_t const> cpus);
+
+        void Inject(ScheduleItem && item);
+
+        void WorkerLoop(Worker & worker);
+
+        [[nodiscard]] bool RunOne(Worker & worker) noexcept;
+        [[nodiscard]] ReadyItem Steal(Worker & worker) noexcept;
+        size_t Poll(Worker & worker) noexcept;
+    };
+
+}  // namespace TaskSystem
\ No newline at end of file
@@ -0,0 +1,240 @@
+#include <TaskSystem/PriorityTaskScheduler.hpp>
+
+#include <algorithm>
+#include <utility>
+
+
+namespace TaskSystem
+{
+
+    void SetCurrentScheduler(ITaskScheduler * scheduler);
+
+    thread_local PriorityTaskScheduler * PriorityTaskScheduler::workerOf = nullptr;
+    thread_local TaskPriority PriorityTaskScheduler::runningPriority = TaskPriority::Normal;
+
+    PriorityTaskScheduler::PriorityTaskScheduler(size_t workerCount, IdleStrategy idleStrategy)
+      : lanes(), workers(), idleEvent(), idleStrategy(idleStrategy), stopping(false)
+    {
+        workerCount = std::max<size_t>(workerCount, 1u);
+
+        workers.reserve(workerCount);
+        for (auto i = 0u; i < workerCount; ++i)
+        {
+            workers.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    PriorityTaskScheduler::~PriorityTaskScheduler() noexcept { Stop(); }
+
+    bool PriorityTaskScheduler::IsWorkerThread() const noexcept { return workerOf == this; }
+
+    void PriorityTaskScheduler::Schedule(ScheduleItem && item) { Schedule(std::move(item), PriorityOf(item)); }
+
+    void PriorityTaskScheduler::Schedule(ScheduleItem && item, TaskPriority priority)
+    {
+        auto & lane = lanes[LaneIndex(priority)];
+
+        auto batch = Detail::ItemBatch();
+        batch.Add(std::move(item));
+
+        lane.count.fetch_add(1u, std::memory_order_relaxed);
+        lane.inbox.Push(std::move(batch));
+
+        WakeOne();
+    }
+
+    void PriorityTaskScheduler::ScheduleBatch(std::span<ScheduleItem> items)
+    {
+        auto batches = std::array<Detail::ItemBatch, TaskPriorityCount>();
+        for (auto & item : items)
+        {
+            batches[LaneIndex(PriorityOf(item))].Add(std::move(item));
+        }
+
+        for (auto i = 0u; i < TaskPriorityCount; ++i)
+        {
+            lanes[i].count.fetch_add(batches[i].Size(), std::memory_order_relaxed);
+            lanes[i].inbox.Push(std::move(batches[i]));
+        }
+
+        WakeOne();
+    }
+
+    void PriorityTaskScheduler::ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && promises)
+    {
+        if (promises.Empty())
+        {
+            return;
+        }
+
+        // Note: a continuation batch can mix awaiters of every priority
+        auto byLane = std::array<Detail::IntrusiveList<Detail::IPromise>, TaskPriorityCount>();
+        while (auto * promise = promises.PopFront())
+        {
+            byLane[LaneIndex(promise->Priority())].PushBack(*promise);
+        }
+
+        for (auto i = 0u; i < TaskPriorityCount; ++i)
+        {
+            lanes[i].count.fetch_add(byLane[i].Size(), std::memory_order_relaxed);
+            lanes[i].inbox.Push(std::move(byLane[i]));
+        }
+
+        WakeOne();
+    }
+
+    void PriorityTaskScheduler::Stop() noexcept
+    {
+        // Note: only the first call stops the workers, a later one faults whatever was scheduled since
+        if (!stopping.exchange(true, std::memory_order_acq_rel))
+        {
+            idleEvent.NotifyAll();
+
+            for (auto & worker : workers)
+            {
+                if (worker.joinable())
+                {
+                    worker.join();
+                }
+            }
+        }
+
+        // Note: all workers have exited so the lanes can be drained from this thread. A faulted promise can schedule
+        // its continuations into a lane already drained, so the lanes are drained again until all are empty
+        auto drained = false;
+        while (!drained)
+        {
+            for (auto & lane : lanes)
+            {
+                lane.inbox.Reject();
+                lane.count.store(0u, std::memory_order_relaxed);
+            }
+
+            drained = std::ranges::all_of(lanes, [](auto & lane) { return lane.inbox.Empty(); });
+        }
+    }
+
+    void PriorityTaskScheduler::WorkerLoop()
+    {
+        workerOf = this;
+        SetCurrentScheduler(this);
+
+        while (!stopping.load(std::memory_order_acquire))
+        {
+            if (!RunOne())
+            {
+                Sleep();
+            }
+        }
+
+        SetCurrentScheduler(nullptr);
+        workerOf = nullptr;
+    }
+
+    TaskPriority PriorityTaskScheduler::PriorityOf(ScheduleItem const & item) const noexcept
+    {
+        if (auto * promise = item.Promise())
+        {
+            return promise->Priority();
+        }
+
+        // Callables scheduled by a running item inherit its priority
+        return IsWorkerThread() ? runningPriority : TaskPriority::Normal;
+    }
+
+    size_t PriorityTaskScheduler::LaneIndex(TaskPriority priority) noexcept
+    {
+        return std::min(static_cast<size_t>(priority), TaskPriorityCount - 1u);
+    }
+
+    size_t PriorityTaskScheduler::PickLane() noexcept
+    {
+        auto highest = TaskPriorityCount;
+        for (auto i = TaskPriorityCount; i-- > 0u;)
+        {
+            if (lanes[i].count.load(std::memory_order_relaxed) != 0u)
+            {
+                highest = i;
+                break;
+            }
+        }
+
+        if (highest == TaskPriorityCount)
+        {
+            return highest;
+        }
+
+        // Every lower lane with work is passed over once more, the lowest one that reaches the threshold goes instead
+        auto chosen = highest;
+        for (auto i = 0u; i < highest; ++i)
+        {
+            if (lanes[i].count.load(std::memory_order_relaxed) == 0u)
+            {
+                continue;
+            }
+
+            if (lanes[i].skipped.fetch_add(1u, std::memory_order_relaxed) + 1u >= AgingThreshold && chosen == highest)
+            {
+                chosen = i;
+            }
+        }
+
+        if (lanes[chosen].skipped.load(std::memory_order_relaxed) != 0u)
+        {
+            lanes[chosen].skipped.store(0u, std::memory_order_relaxed);
+        }
+
+        return chosen;
+    }
+
+    bool PriorityTaskScheduler::RunOne() noexcept
+    {
+        auto index = PickLane();
+        if (index == TaskPriorityCount)
+        {
+            return false;
+        }
+
+        auto & lane = lanes[index];
+        auto item = lane.inbox.Pop();
+        if (!item)
+        {
+            // Taken by another worker, or a producer is part way through a push
+            return false;
+        }
+
+        // Note: ScheduleBatch wakes a single worker, it wakes the next one while the lane still holds work
+        if (lane.count.fetch_sub(1u, std::memory_order_relaxed) > 1u)
+        {
+            WakeOne();
+        }
+
+        runningPriority = static_cast<TaskPriority>(index);
+        item.Run();
+        return true;
+    }
+
+    bool PriorityTaskScheduler::HasWork() const noexcept
+    {
+        return std::any_of(lanes.begin(), lanes.end(), [](auto const & lane) {
+            return lane.count.load(std::memory_order_relaxed) != 0u;
+        });
+    }
+
+    void PriorityTaskScheduler::WakeOne() noexcept { idleEvent.NotifyOne(); }
+
+    void PriorityTaskScheduler::Sleep() noexcept
+    {
+        auto key = idleEvent.PrepareWait();
+
+        // Note: a push after PrepareWait notifies and cancels the wait below, an earlier one shows in a lane count
+        if (HasWork() || stopping.load(std::memory_order_acquire))
+        {
+            idleEvent.CancelWait();
+            return;
+        }
+
+        idleEvent.Wait(key, idleStrategy.SpinCount, idleStrategy.YieldCount);
+    }
+
+}  // namespace TaskSystem
\ No newline at end of file
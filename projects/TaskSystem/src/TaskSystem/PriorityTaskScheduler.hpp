@@ -0,0 +1,111 @@
+#pragma once
+
+#include <TaskSystem/Detail/CpuQuota.hpp>
+#include <TaskSystem/Detail/EventCount.hpp>
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/Detail/ItemInbox.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+#include <TaskSystem/IdleStrategy.hpp>
+#include <TaskSystem/TaskPriority.hpp>
+
+#include <array>
+#include <atomic>
+#include <span>
+#include <thread>
+#include <vector>
+
+
+namespace TaskSystem
+{
+
+    /// <summary>
+    /// Multi-threaded scheduler with a queue per TaskPriority, workers take from the highest lane that has work
+    /// </summary>
+    /// <remarks>
+    /// Promises are queued in the lane of their own priority, so a continuation is resumed at its awaiter's priority
+    /// whichever task completed it. Other items take the priority of the item that scheduled them when scheduled from
+    /// a worker, otherwise Normal. To stop bulk work in a high lane starving the lanes below it, a lane that has been
+    /// passed over AgingThreshold times while it had work is served once before the higher lanes again
+    /// </remarks>
+    class PriorityTaskScheduler final : public ITaskScheduler
+    {
+    public:
+        static inline constexpr size_t AgingThreshold = 8u;
+
+    private:
+        struct Lane final
+        {
+            Detail::MpmcItemInbox inbox;
+
+            // Note: counted before the push so a worker never sees an item without the count
+            std::atomic<size_t> count = 0u;
+
+            // Times a higher lane was served while this lane had work
+            std::atomic<size_t> skipped = 0u;
+        };
+
+        static thread_local PriorityTaskScheduler * workerOf;
+        static thread_local TaskPriority runningPriority;
+
+        std::array<Lane, TaskPriorityCount> lanes;
+        std::vector<std::thread> workers;
+
+        Detail::EventCount idleEvent;
+        IdleStrategy idleStrategy;
+
+        std::atomic<bool> stopping;
+
+    public:
+        explicit PriorityTaskScheduler(size_t workerCount = Detail::AvailableParallelism(),
+                                       IdleStrategy idleStrategy = IdleStrategy::Balanced());
+
+        PriorityTaskScheduler(PriorityTaskScheduler const &) = delete;
+        PriorityTaskScheduler & operator=(PriorityTaskScheduler const &) = delete;
+
+        PriorityTaskScheduler(PriorityTaskScheduler &&) = delete;
+        PriorityTaskScheduler & operator=(PriorityTaskScheduler &&) = delete;
+
+        ~PriorityTaskScheduler() noexcept override;
+
+        [[nodiscard]] size_t WorkerCount() const noexcept { return workers.size(); }
+
+        bool IsWorkerThread() const noexcept override;
+
+        void Schedule(ScheduleItem && item) override;
+
+        /// <summary>
+        /// Schedules the item in the lane for priority regardless of the priority of its promise
+        /// </summary>
+        void Schedule(ScheduleItem && item, TaskPriority priority);
+
+        void ScheduleBatch(std::span<ScheduleItem> items) override;
+
+        void ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && promises) override;
+
+        /// <summary>
+        /// Wakes and joins the workers, whatever is left in the lanes is discarded without running
+        /// </summary>
+        /// <remarks>
+        /// Promises are faulted with SchedulerStopped so their awaiters resume rather than hang. Calling it again
+        /// faults the promises scheduled since
+        /// </remarks>
+        void Stop() noexcept;
+
+    private:
+        void WorkerLoop();
+
+        [[nodiscard]] TaskPriority PriorityOf(ScheduleItem const & item) const noexcept;
+        [[nodiscard]] static size_t LaneIndex(TaskPriority priority) noexcept;
+
+        // Index of the lane to serve next, TaskPriorityCount when every lane is empty
+        [[nodiscard]] size_t PickLane() noexcept;
+
+        [[nodiscard]] bool RunOne() noexcept;
+        [[nodiscard]] bool HasWork() const noexcept;
+
+        void WakeOne() noexcept;
+        void Sleep() noexcept;
+    };
+
+}  // namespace TaskSystem
\ No newline at end of file
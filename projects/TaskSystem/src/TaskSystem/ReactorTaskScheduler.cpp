@@ -0,0 +1,365 @@
+#include <TaskSystem/ReactorTaskScheduler.hpp>
+
+#if defined(__linux__)
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+
+namespace TaskSystem
+{
+
+    void SetCurrentScheduler(ITaskScheduler * scheduler);
+
+    namespace
+    {
+        // Items run between checks for ready sockets, so a busy loop does not hold back I/O
+        constexpr size_t ItemsPerIteration = 64u;
+
+        constexpr int MaxEvents = 64;
+
+    }  // namespace
+
+    ReactorTaskScheduler::ReactorTaskScheduler()
+      : inbox()
+      , epoll(-1)
+      , wakeFd(-1)
+      , retired()
+      , waiting(0)
+      , owner()
+      , sleeping(false)
+      , stopping(false)
+    {
+        epoll = ::epoll_create1(EPOLL_CLOEXEC);
+        if (epoll < 0)
+        {
+            throw std::system_error(errno, std::system_category(), "epoll_create1");
+        }
+
+        wakeFd = ::eventfd(0u, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (wakeFd < 0)
+        {
+            auto error = errno;
+            ::close(epoll);
+            throw std::system_error(error, std::system_category(), "eventfd");
+        }
+
+        // Note: sockets are registered by their state, the eventfd is the only null entry
+        auto event = epoll_event();
+        event.events = EPOLLIN;
+        event.data.ptr = nullptr;
+        ::epoll_ctl(epoll, EPOLL_CTL_ADD, wakeFd, &event);
+    }
+
+    ReactorTaskScheduler::~ReactorTaskScheduler() noexcept
+    {
+        FreeRetired();
+
+        ::close(wakeFd);
+        ::close(epoll);
+    }
+
+    bool ReactorTaskScheduler::IsWorkerThread() const noexcept
+    {
+        return owner.load(std::memory_order_acquire) == std::this_thread::get_id();
+    }
+
+    void ReactorTaskScheduler::Schedule(ScheduleItem && item)
+    {
+        inbox.Push(std::move(item));
+        Wake();
+    }
+
+    void ReactorTaskScheduler::ScheduleBatch(std::span<ScheduleItem> batch)
+    {
+        auto ready = Detail::ItemBatch();
+        for (auto & item : batch)
+        {
+            ready.Add(std::move(item));
+        }
+
+        inbox.Push(std::move(ready));
+        Wake();
+    }
+
+    void ReactorTaskScheduler::ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && batch)
+    {
+        inbox.Push(std::move(batch));
+        Wake();
+    }
+
+    size_t ReactorTaskScheduler::RunUntilIdle() { return RunLoop(false, nullptr); }
+
+    size_t ReactorTaskScheduler::RunFor(std::chrono::nanoseconds duration)
+    {
+        auto deadline = clock_type::now() + std::chrono::duration_cast<clock_type::duration>(duration);
+        return RunLoop(true, &deadline);
+    }
+
+    size_t ReactorTaskScheduler::RunForever() { return RunLoop(true, nullptr); }
+
+    void ReactorTaskScheduler::Stop() noexcept
+    {
+        stopping.store(true, std::memory_order_release);
+        Wake();
+    }
+
+    void ReactorTaskScheduler::Register(Detail::SocketState & state)
+    {
+        auto event = epoll_event();
+        event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+        event.data.ptr = &state;
+
+        if (::epoll_ctl(epoll, EPOLL_CTL_ADD, state.Fd, &event) < 0)
+        {
+            throw std::system_error(errno, std::system_category(), "epoll_ctl");
+        }
+    }
+
+    void ReactorTaskScheduler::Retire(Detail::SocketState & state) noexcept
+    {
+        ::epoll_ctl(epoll, EPOLL_CTL_DEL, state.Fd, nullptr);
+
+        // Note: no event can reach a parked operation once the fd has left the set, so it is failed here instead. Its
+        // caller is queued rather than resumed inline, Close can be called from inside another coroutine
+        for (auto * slot : { &state.Reader, &state.Writer })
+        {
+            auto * operation = slot->exchange(Detail::SocketState::Notified(), std::memory_order_acq_rel);
+            if (operation == nullptr || operation == Detail::SocketState::Notified())
+            {
+                continue;
+            }
+
+            operation->Result = -ECANCELED;
+            waiting.fetch_sub(1, std::memory_order_relaxed);
+            Resume(*operation, false);
+        }
+
+        retired.Push(state);
+    }
+
+    void ReactorTaskScheduler::FreeRetired() noexcept
+    {
+        while (auto * state = retired.Pop())
+        {
+            delete state;
+        }
+    }
+
+    bool ReactorTaskScheduler::TryComplete(
+        Detail::SocketOperation & operation, std::atomic<Detail::SocketOperation *> & slot) noexcept
+    {
+        while (true)
+        {
+            // Consume any edge before the call, one arriving after it is seen by the exchange below
+            slot.store(nullptr, std::memory_order_seq_cst);
+
+            if (operation.TryOnce())
+            {
+                return true;
+            }
+
+            waiting.fetch_add(1, std::memory_order_relaxed);
+
+            auto * expected = static_cast<Detail::SocketOperation *>(nullptr);
+            if (slot.compare_exchange_strong(expected, &operation, std::memory_order_acq_rel))
+            {
+                return false;
+            }
+
+            // The socket became ready after the call, try again
+            waiting.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    size_t ReactorTaskScheduler::OnReady(std::atomic<Detail::SocketOperation *> & slot)
+    {
+        auto * operation = slot.exchange(Detail::SocketState::Notified(), std::memory_order_acq_rel);
+        if (operation == nullptr || operation == Detail::SocketState::Notified())
+        {
+            return 0u;
+        }
+
+        waiting.fetch_sub(1, std::memory_order_relaxed);
+        if (!TryComplete(*operation, slot))
+        {
+            return 0u;
+        }
+
+        Resume(*operation);
+        return 1u;
+    }
+
+    void ReactorTaskScheduler::Resume(Detail::SocketOperation & operation, bool allowInline)
+    {
+        // Note: the operation is in the caller's frame, nothing reads it once the caller is resumed
+        auto & caller = *operation.Caller;
+        auto * scheduler = operation.Scheduler;
+
+        if (!caller.TrySetScheduled())
+        {
+            return;
+        }
+
+        if (scheduler == nullptr || scheduler == this)
+        {
+            if (allowInline)
+            {
+                ScheduleItem(caller).Execute();
+            }
+            else
+            {
+                Schedule(ScheduleItem(caller));
+            }
+        }
+        else
+        {
+            scheduler->Schedule(ScheduleItem(caller));
+        }
+    }
+
+    size_t ReactorTaskScheduler::RunLoop(bool sleepWhenIdle, clock_type::time_point const * deadline)
+    {
+        [[maybe_unused]] auto previousOwner = owner.exchange(std::this_thread::get_id(), std::memory_order_acq_rel);
+        assert(previousOwner == std::thread::id() && "Only one thread can run the loop at a time");
+
+        auto * previousScheduler = CurrentScheduler();
+        SetCurrentScheduler(this);
+
+        auto count = size_t(0u);
+        while (true)
+        {
+            // Note: each Stop ends exactly one run
+            if (stopping.load(std::memory_order_relaxed) && stopping.exchange(false, std::memory_order_acq_rel))
+            {
+                break;
+            }
+
+            auto ran = size_t(0u);
+            while (ran < ItemsPerIteration && RunOne())
+            {
+                ++ran;
+            }
+
+            if (waiting.load(std::memory_order_relaxed) > 0)
+            {
+                ran += Poll(false, nullptr);
+            }
+            count += ran;
+
+            if (deadline && clock_type::now() >= *deadline)
+            {
+                break;
+            }
+
+            if (ran != 0u || HasWork())
+            {
+                continue;
+            }
+
+            if (!sleepWhenIdle && waiting.load(std::memory_order_acquire) <= 0)
+            {
+                break;
+            }
+
+            sleeping.store(true, std::memory_order_relaxed);
+
+            // Note: orders the flag before the inbox check, Wake orders its push before reading the flag
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            auto wait = !HasWork() && !stopping.load(std::memory_order_relaxed);
+            count += Poll(wait, deadline);
+
+            // Note: a producer that cleared the flag first has signalled the eventfd, the next wait returns early
+            sleeping.store(false, std::memory_order_relaxed);
+        }
+
+        FreeRetired();
+
+        SetCurrentScheduler(previousScheduler);
+        owner.store(std::thread::id(), std::memory_order_release);
+
+        return count;
+    }
+
+    bool ReactorTaskScheduler::RunOne()
+    {
+        auto item = inbox.Pop();
+        if (!item)
+        {
+            return false;
+        }
+
+        item.Run();
+        return true;
+    }
+
+    bool ReactorTaskScheduler::HasWork() const noexcept { return !inbox.Empty(); }
+
+    size_t ReactorTaskScheduler::Poll(bool wait, clock_type::time_point const * deadline)
+    {
+        auto timeout = 0;
+        if (wait)
+        {
+            timeout = -1;
+            if (deadline)
+            {
+                auto remaining = std::chrono::ceil<std::chrono::milliseconds>(*deadline - clock_type::now());
+                timeout = static_cast<int>(std::clamp<std::chrono::milliseconds::rep>(remaining.count(), 0, 1 << 30));
+            }
+        }
+
+        epoll_event events[MaxEvents];
+        auto count = ::epoll_wait(epoll, events, MaxEvents, timeout);
+
+        auto resumed = size_t(0u);
+        for (auto i = 0; i < count; ++i)
+        {
+            auto * state = static_cast<Detail::SocketState *>(events[i].data.ptr);
+            if (state == nullptr)
+            {
+                auto value = std::uint64_t(0u);
+                [[maybe_unused]] auto _ = ::read(wakeFd, &value, sizeof(value));
+                continue;
+            }
+
+            // Note: errors and hang ups end both directions, the retried calls report them
+            auto flags = events[i].events;
+            if (flags & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+            {
+                resumed += OnReady(state->Reader);
+            }
+
+            if (flags & (EPOLLOUT | EPOLLHUP | EPOLLERR))
+            {
+                resumed += OnReady(state->Writer);
+            }
+        }
+
+        // Note: sockets closed while resuming the callers above can still be referred to by later events in the batch
+        FreeRetired();
+
+        return resumed;
+    }
+
+    void ReactorTaskScheduler::Wake() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (sleeping.load(std::memory_order_relaxed) && sleeping.exchange(false, std::memory_order_acq_rel))
+        {
+            auto one = std::uint64_t(1u);
+            [[maybe_unused]] auto _ = ::write(wakeFd, &one, sizeof(one));
+        }
+    }
+
+}  // namespace TaskSystem
+
+#endif
@@ -0,0 +1,133 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/Detail/ItemInbox.hpp>
+#include <TaskSystem/Detail/SocketState.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <thread>
+
+
+namespace TaskSystem
+{
+
+    class TcpSocket;
+
+    namespace Detail
+    {
+        class SocketAwaitableBase;
+    }
+
+    /// <summary>
+    /// Event loop that resumes socket operations as their sockets become ready, see TcpSocket
+    /// </summary>
+    /// <remarks>
+    /// Scheduling works as for EventLoopTaskScheduler. Sockets are registered once, edge-triggered, and the loop
+    /// sleeps in epoll_wait; a ready socket retries its waiting call on the loop thread and resumes the caller inline,
+    /// or on the scheduler given to the awaitable's ContinueOn
+    /// </remarks>
+    class ReactorTaskScheduler final : public ITaskScheduler
+    {
+    private:
+        friend class TcpSocket;
+        friend class Detail::SocketAwaitableBase;
+
+        using clock_type = std::chrono::steady_clock;
+
+        Detail::MpscItemInbox inbox;
+
+        int epoll;
+        int wakeFd;
+
+        // Closed sockets, freed by the loop after the events it has already read
+        Detail::IntrusiveMpscQueue<Detail::SocketState> retired;
+
+        // Operations parked waiting for readiness
+        std::atomic<std::int64_t> waiting;
+
+        std::atomic<std::thread::id> owner;
+
+        // Set by the loop before it sleeps in epoll_wait, the producer that clears it signals the eventfd
+        std::atomic<bool> sleeping;
+
+        std::atomic<bool> stopping;
+
+    public:
+        // Throws std::system_error if the epoll instance or eventfd cannot be created
+        ReactorTaskScheduler();
+
+        ReactorTaskScheduler(ReactorTaskScheduler const &) = delete;
+        ReactorTaskScheduler & operator=(ReactorTaskScheduler const &) = delete;
+
+        ReactorTaskScheduler(ReactorTaskScheduler &&) = delete;
+        ReactorTaskScheduler & operator=(ReactorTaskScheduler &&) = delete;
+
+        // Items that have not run are discarded, sockets must be closed first
+        ~ReactorTaskScheduler() noexcept override;
+
+        bool IsWorkerThread() const noexcept override;
+
+        void Schedule(ScheduleItem && item) override;
+
+        void ScheduleBatch(std::span<ScheduleItem> batch) override;
+
+        void ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && batch) override;
+
+        /// <summary>
+        /// Runs items and waits for parked socket operations until there is nothing left to do, returns the number of
+        /// items run
+        /// </summary>
+        size_t RunUntilIdle();
+
+        /// <summary>
+        /// Runs items and socket operations, sleeping while there is nothing to do, until duration has elapsed or Stop
+        /// is called
+        /// </summary>
+        size_t RunFor(std::chrono::nanoseconds duration);
+
+        /// <summary>
+        /// Runs items and socket operations, sleeping while there is nothing to do, until Stop is called
+        /// </summary>
+        size_t RunForever();
+
+        /// <summary>
+        /// Makes the current, or next, run return after the item it is running, can be called from any thread
+        /// </summary>
+        void Stop() noexcept;
+
+    private:
+        // Throws std::system_error if the fd cannot be added
+        void Register(Detail::SocketState & state);
+        // Removes the fd from the set and fails any operation parked on it with ECANCELED
+        void Retire(Detail::SocketState & state) noexcept;
+        void FreeRetired() noexcept;
+
+        // Makes the call until it completes or parks in the slot, returns false if parked
+        [[nodiscard]] bool TryComplete(
+            Detail::SocketOperation & operation, std::atomic<Detail::SocketOperation *> & slot) noexcept;
+        [[nodiscard]] size_t OnReady(std::atomic<Detail::SocketOperation *> & slot);
+
+        // Resumes the caller on the scheduler it asked for, otherwise inline when allowed or queued on this reactor
+        void Resume(Detail::SocketOperation & operation, bool allowInline = true);
+
+        size_t RunLoop(bool sleepWhenIdle, clock_type::time_point const * deadline);
+
+        [[nodiscard]] bool RunOne();
+        [[nodiscard]] bool HasWork() const noexcept;
+
+        // Dispatches ready sockets, returns the number of callers resumed
+        size_t Poll(bool wait, clock_type::time_point const * deadline);
+
+        void Wake() noexcept;
+    };
+
+}  // namespace TaskSystem
+
+#endif
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <TaskSystem/BlockingTaskScheduler.hpp>
+#include <TaskSystem/Detail/Continuation.hpp>
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/Promise.hpp>
+#include <TaskSystem/Detail/Utils.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+#include <TaskSystem/ScheduleItem.hpp>
+
+#include <concepts>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+
+namespace TaskSystem
+{
+
+    namespace Detail
+    {
+
+        struct BlockingCallPromisePolicy final
+        {
+            static inline constexpr bool CanSchedule = false;
+            static inline constexpr bool CanRun = false;
+            static inline constexpr bool CanSuspend = false;
+            static inline constexpr bool AllowSuspendFromCreated = false;
+        };
+
+        /// <summary>
+        /// Runs a function on a blocking pool and resumes the caller with its result on the caller's scheduler
+        /// </summary>
+        /// <remarks>
+        /// The call is a promise completed by the pool thread; its continuation scheduler is the scheduler the caller
+        /// was running on, so publishing the result schedules the caller back there as for any other awaited promise.
+        /// The function, promise and continuation all live in the awaitable, in the caller's frame, so nothing is
+        /// allocated beyond the pool's queue entry
+        /// </remarks>
+        template <typename TFunction>
+        class RunBlockingAwaitable final
+        {
+        public:
+            using value_type = std::invoke_result_t<TFunction &>;
+
+        private:
+            TFunction function;
+            BlockingTaskScheduler & pool;
+
+            Promise<value_type, BlockingCallPromisePolicy> call;
+            ContinuationNode continuation;
+
+        public:
+            template <typename TArg>
+            RunBlockingAwaitable(TArg && function, BlockingTaskScheduler & pool)
+              : function(std::forward<TArg>(function)), pool(pool), call(), continuation()
+            { }
+
+            RunBlockingAwaitable(RunBlockingAwaitable const &) = delete;
+            RunBlockingAwaitable & operator=(RunBlockingAwaitable const &) = delete;
+
+            RunBlockingAwaitable(RunBlockingAwaitable &&) = delete;
+            RunBlockingAwaitable & operator=(RunBlockingAwaitable &&) = delete;
+
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+            // ToDo: use PromiseType concept
+            template <typename TPromise>
+            void await_suspend(std::coroutine_handle<TPromise> callerHandle)
+            {
+                IPromise & callerPromise = callerHandle.promise();
+                await_suspend(callerHandle, callerPromise);
+            }
+
+            void await_suspend(std::coroutine_handle<>, IPromise & callerPromise)
+            {
+                if (!callerPromise.TrySetSuspended())
+                {
+                    throw std::exception("Unable to set caller promise to suspended");
+                }
+
+                call.ContinuationScheduler(FirstOf(CurrentScheduler(), DefaultScheduler()));
+
+                // Note: cannot fail, nothing completes the call until it is queued below
+                continuation = ContinuationNode(Continuation(callerPromise, CurrentScheduler()));
+                [[maybe_unused]] auto _ = call.TryAddContinuation(continuation);
+
+                try
+                {
+                    pool.ScheduleCall(&RunBlockingAwaitable::Invoke, &RunBlockingAwaitable::Reject, this);
+                }
+                catch (...)
+                {
+                    // Note: the queue entry could not be allocated, the caller is resumed to rethrow rather than left
+                    // suspended
+                    [[maybe_unused]] auto _ = call.TrySetException(std::current_exception());
+                }
+            }
+
+            value_type await_resume()
+            {
+                if constexpr (std::is_void_v<value_type>)
+                {
+                    call.ThrowIfFaulted();
+                }
+                else
+                {
+                    return std::move(call).Result();
+                }
+            }
+
+        private:
+            static void Invoke(void * context) noexcept
+            {
+                auto & self = *static_cast<RunBlockingAwaitable *>(context);
+
+                // Note: publishing the result can resume the caller, and destroy this awaitable, before it returns
+                try
+                {
+                    if constexpr (std::is_void_v<value_type>)
+                    {
+                        std::invoke(self.function);
+                        [[maybe_unused]] auto _ = self.call.TrySetCompleted();
+                    }
+                    else
+                    {
+                        [[maybe_unused]] auto _ = self.call.TrySetResult(std::invoke(self.function));
+                    }
+                }
+                catch (...)
+                {
+                    [[maybe_unused]] auto _ = self.call.TrySetException(std::current_exception());
+                }
+            }
+
+            // Called instead of Invoke when the pool is stopped before the call runs
+            static void Reject(void * context) noexcept
+            {
+                auto & self = *static_cast<RunBlockingAwaitable *>(context);
+                [[maybe_unused]] auto _ = self.call.TrySetException(std::make_exception_ptr(SchedulerStopped()));
+            }
+        };
+
+    }  // namespace Detail
+
+    /// <summary>
+    /// co_await to run function on the blocking pool, the caller resumes on the scheduler it was running on
+    /// </summary>
+    /// <remarks>
+    /// For calls that block, e.g. legacy database clients or stat, which would otherwise stall a compute worker.
+    /// Exceptions thrown by function are rethrown by the co_await, as is SchedulerStopped when the pool is stopped
+    /// before the call has started
+    /// </remarks>
+    template <std::invocable TFunction>
+    [[nodiscard]] Detail::RunBlockingAwaitable<std::decay_t<TFunction>> RunBlocking(
+        TFunction && function, BlockingTaskScheduler & pool)
+    {
+        return Detail::RunBlockingAwaitable<std::decay_t<TFunction>>(std::forward<TFunction>(function), pool);
+    }
+
+    template <std::invocable TFunction>
+    [[nodiscard]] Detail::RunBlockingAwaitable<std::decay_t<TFunction>> RunBlocking(TFunction && function)
+    {
+        return RunBlocking(std::forward<TFunction>(function), DefaultBlockingScheduler());
+    }
+
+}  // namespace TaskSystem
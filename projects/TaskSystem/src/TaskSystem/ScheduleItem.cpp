@@ -1,20 +1,51 @@
 #include <TaskSystem/Detail/IPromise.hpp>
 #include <TaskSystem/ScheduleItem.hpp>
+#include <TaskSystem/TimeSlice.hpp>
+
+#include <atomic>
+#include <utility>
 
 
 namespace TaskSystem
 {
 
+    namespace
+    {
+        void TerminateOnUnhandledException(std::exception_ptr) noexcept { std::terminate(); }
+
+        std::atomic<UnhandledExceptionHandler> unhandledExceptionHandler = &TerminateOnUnhandledException;
+
+    }  // namespace
+
+    UnhandledExceptionHandler SetUnhandledExceptionHandler(UnhandledExceptionHandler handler) noexcept
+    {
+        return unhandledExceptionHandler.exchange(handler ? handler : &TerminateOnUnhandledException,
+                                                  std::memory_order_acq_rel);
+    }
+
     ScheduleItem::ScheduleItem(promise_type & promise) noexcept : item(&promise) { }
 
     ScheduleItem::ScheduleItem(promise_type_ptr promise) noexcept : item(promise) { }
 
-    ScheduleItem::ScheduleItem(lambda_type lambda) noexcept : item(lambda) { }
+    ScheduleItem::ScheduleItem(lambda_type lambda) noexcept : item(std::move(lambda)) { }
 
     ScheduleItem::ScheduleItem(function_type function) noexcept : item(function) { }
 
+    ScheduleItem::ScheduleItem(context_function_type function, void * context) noexcept
+      : item(ContextFunction{ function, context })
+    { }
+
+    ScheduleItem::promise_type_ptr ScheduleItem::Promise() const noexcept
+    {
+        auto * ppromise = std::get_if<promise_type_ptr>(&item);
+        return ppromise ? *ppromise : nullptr;
+    }
+
     std::exception_ptr ScheduleItem::Run() noexcept
     {
+        // Note: items run inline from this one share its slice
+        auto slice = Detail::TimeSliceScope();
+
         if (auto * ppromise = std::get_if<promise_type_ptr>(&item))
         {
             if (!(*ppromise))
@@ -62,8 +93,27 @@ namespace TaskSystem
                 return std::current_exception();
             }
         }
+        else if (auto * contextFunction = std::get_if<ContextFunction>(&item))
+        {
+            try
+            {
+                contextFunction->function(contextFunction->context);
+            }
+            catch (...)
+            {
+                return std::current_exception();
+            }
+        }
 
         return nullptr;
     }
 
+    void ScheduleItem::Execute() noexcept
+    {
+        if (auto exception = Run())
+        {
+            unhandledExceptionHandler.load(std::memory_order_acquire)(std::move(exception));
+        }
+    }
+
 }  // namespace TaskSystem
\ No newline at end of file
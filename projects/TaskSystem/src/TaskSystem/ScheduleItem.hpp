@@ -1,8 +1,9 @@
 #pragma once
 
+#include <TaskSystem/Detail/InplaceFunction.hpp>
+
 #include <coroutine>
 #include <exception>
-#include <functional>
 #include <variant>
 
 
@@ -13,15 +14,43 @@ namespace TaskSystem
         class IPromise;
     }
 
+    /// <summary>
+    /// Receives an exception a scheduled callable let escape, called on the thread that ran the callable
+    /// </summary>
+    using UnhandledExceptionHandler = void (*)(std::exception_ptr exception) noexcept;
+
+    /// <summary>
+    /// Replaces the handler schedulers pass escaped exceptions to, returns the previous one
+    /// </summary>
+    /// <remarks>
+    /// The default calls std::terminate, nullptr restores it. Tasks never reach the handler, their exceptions are
+    /// stored in the task for its awaiter
+    /// </remarks>
+    UnhandledExceptionHandler SetUnhandledExceptionHandler(UnhandledExceptionHandler handler) noexcept;
+
+    /// <summary>
+    /// Unit of work passed to a scheduler, a promise to resume or a callable to run
+    /// </summary>
+    /// <remarks>
+    /// Move-only, callables with captures up to lambda_type::Capacity bytes are stored inline so scheduling them does
+    /// not allocate
+    /// </remarks>
     class ScheduleItem
     {
     private:
         using promise_type = Detail::IPromise;
         using promise_type_ptr = Detail::IPromise *;
-        using lambda_type = std::function<void()>;
+        using lambda_type = Detail::InplaceFunction<void()>;
         using function_type = void (*)();
+        using context_function_type = void (*)(void *);
 
-        std::variant<promise_type_ptr, lambda_type, function_type> item;
+        struct ContextFunction final
+        {
+            context_function_type function;
+            void * context;
+        };
+
+        std::variant<promise_type_ptr, lambda_type, function_type, ContextFunction> item;
 
     public:
         ScheduleItem(promise_type & promise) noexcept;
@@ -30,7 +59,25 @@ namespace TaskSystem
         ScheduleItem(lambda_type lambda) noexcept;
         ScheduleItem(function_type function) noexcept;
 
+        // Calls function(context) when run, the caller keeps context alive until then
+        ScheduleItem(context_function_type function, void * context) noexcept;
+
+        ScheduleItem(ScheduleItem const &) = delete;
+        ScheduleItem & operator=(ScheduleItem const &) = delete;
+
+        ScheduleItem(ScheduleItem &&) noexcept = default;
+        ScheduleItem & operator=(ScheduleItem &&) noexcept = default;
+
+        ~ScheduleItem() noexcept = default;
+
+        // Returns the promise if this item resumes one; otherwise nullptr
+        [[nodiscard]] promise_type_ptr Promise() const noexcept;
+
+        // Returns the exception a callable let escape
         std::exception_ptr Run() noexcept;
+
+        // Runs the item for a scheduler, an exception a callable lets escape goes to the unhandled exception handler
+        void Execute() noexcept;
     };
 
 }  // namespace TaskSystem
\ No newline at end of file
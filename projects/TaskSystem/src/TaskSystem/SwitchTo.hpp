@@ -0,0 +1,97 @@
+#pragma once
+
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/Utils.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+#include <TaskSystem/ScheduleItem.hpp>
+
+#include <coroutine>
+#include <exception>
+
+
+namespace TaskSystem
+{
+    namespace Detail
+    {
+
+        /// <summary>
+        /// Suspends the caller and schedules its own promise onto scheduler
+        /// </summary>
+        /// <remarks>
+        /// The caller's frame is what gets scheduled, so hopping does not allocate. A caller already running on
+        /// scheduler carries on without suspending, unless it is yielding, which requeues it behind the waiting work
+        /// </remarks>
+        class SwitchToAwaitable final
+        {
+        private:
+            ITaskScheduler & scheduler;
+            bool yield;
+
+        public:
+            SwitchToAwaitable(ITaskScheduler & scheduler, bool yield) noexcept : scheduler(scheduler), yield(yield)
+            { }
+
+            [[nodiscard]] bool await_ready() const noexcept { return !yield && IsCurrentScheduler(&scheduler); }
+
+            // ToDo: use PromiseType concept
+            template <typename TPromise>
+            void await_suspend(std::coroutine_handle<TPromise> callerHandle)
+            {
+                IPromise & callerPromise = callerHandle.promise();
+                await_suspend(callerHandle, callerPromise);
+            }
+
+            void await_suspend(std::coroutine_handle<>, IPromise & callerPromise)
+            {
+                if (!callerPromise.TrySetSuspended())
+                {
+                    throw std::exception("Unable to set caller promise to suspended");
+                }
+
+                // Note: the caller can resume on another thread, and destroy this, as soon as it is scheduled
+                auto & target = scheduler;
+                auto requeue = yield;
+
+                if (!callerPromise.TrySetScheduled())
+                {
+                    return;
+                }
+
+                if (requeue)
+                {
+                    target.Requeue(ScheduleItem(callerPromise));
+                }
+                else
+                {
+                    target.Schedule(ScheduleItem(callerPromise));
+                }
+            }
+
+            constexpr void await_resume() const noexcept { }
+        };
+
+    }  // namespace Detail
+
+    /// <summary>
+    /// co_await to continue the calling task on scheduler
+    /// </summary>
+    /// <remarks>
+    /// Does nothing if the task is already running on scheduler
+    /// </remarks>
+    [[nodiscard]] inline Detail::SwitchToAwaitable SwitchTo(ITaskScheduler & scheduler) noexcept
+    {
+        return Detail::SwitchToAwaitable(scheduler, false);
+    }
+
+    /// <summary>
+    /// co_await to put the calling task back at the end of its scheduler's queue, letting other items run first
+    /// </summary>
+    /// <remarks>
+    /// windows.h defines a Yield() macro, write (Yield)() where it is included
+    /// </remarks>
+    [[nodiscard]] inline Detail::SwitchToAwaitable Yield() noexcept
+    {
+        return Detail::SwitchToAwaitable(*Detail::FirstOf(CurrentScheduler(), DefaultScheduler()), true);
+    }
+
+}  // namespace TaskSystem
@@ -1,37 +1,91 @@
 #include <TaskSystem/SynchronousTaskScheduler.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
 
 namespace TaskSystem
 {
 
     void SetCurrentScheduler(ITaskScheduler * scheduler);
 
-    SynchronousTaskScheduler::SynchronousTaskScheduler() noexcept : id(std::nullopt) { }
+    SynchronousTaskScheduler::SynchronousTaskScheduler() noexcept
+      : id(std::nullopt), inbox(), timers(nullptr), clock(nullptr)
+    { }
+
+    SynchronousTaskScheduler::SynchronousTaskScheduler(TimerService & timers, ManualClock & clock) noexcept
+      : id(std::nullopt), inbox(), timers(&timers), clock(&clock)
+    {
+        assert(&timers.Clock() == &clock);
+        assert(!timers.Options().DedicatedThread);
+    }
 
     bool SynchronousTaskScheduler::IsWorkerThread() const noexcept { return id && *id == std::this_thread::get_id(); }
 
-    void SynchronousTaskScheduler::Schedule(ScheduleItem && item) { queue.push(std::move(item)); }
+    void SynchronousTaskScheduler::Schedule(ScheduleItem && item) { inbox.Push(std::move(item)); }
 
-    void SynchronousTaskScheduler::Run()
+    void SynchronousTaskScheduler::ScheduleBatch(std::span<ScheduleItem> batch)
+    {
+        for (auto & item : batch)
+        {
+            Schedule(std::move(item));
+        }
+    }
+
+    void SynchronousTaskScheduler::ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && batch)
+    {
+        inbox.Push(std::move(batch));
+    }
+
+    void SynchronousTaskScheduler::Run() { RunUntil(NoDeadline); }
+
+    void SynchronousTaskScheduler::RunUntil(DeadlineClock::time_point time)
     {
         id = std::this_thread::get_id();
         SetCurrentScheduler(this);
 
-        while (!queue.empty())
+        while (true)
         {
-            auto item = std::move(queue.front());
-            queue.pop();
-
-            auto result = item.Run();
-
-            if (result != nullptr)
+            auto item = inbox.Pop();
+            if (!item)
             {
-                // ToDo: unhandled exception
+                if (AdvanceTime(time))
+                {
+                    continue;
+                }
+
+                break;
             }
+
+            item.Run();
         }
 
         id = std::nullopt;
         SetCurrentScheduler(nullptr);
     }
 
+    bool SynchronousTaskScheduler::AdvanceTime(DeadlineClock::time_point until)
+    {
+        if (!timers)
+        {
+            return false;
+        }
+
+        // Note: a timer firing schedules the task waiting on it, usually back onto this scheduler
+        if (timers->Poll() > 0u)
+        {
+            return true;
+        }
+
+        auto next = std::min(timers->NextExpiry(), until);
+        if (next == NoDeadline || next <= clock->Now())
+        {
+            return false;
+        }
+
+        clock->AdvanceTo(next);
+        return true;
+    }
+
 }  // namespace TaskSystem
\ No newline at end of file
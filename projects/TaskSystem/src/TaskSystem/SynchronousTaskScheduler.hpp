@@ -1,31 +1,71 @@
 #pragma once
 
+#include <TaskSystem/Deadline.hpp>
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/Detail/ItemInbox.hpp>
 #include <TaskSystem/ITaskScheduler.hpp>
+#include <TaskSystem/ManualClock.hpp>
+#include <TaskSystem/TimerService.hpp>
 
 #include <optional>
-#include <queue>
+#include <span>
 #include <thread>
 
 
 namespace TaskSystem
 {
 
+    /// <summary>
+    /// Runs scheduled items on the thread that calls Run, for tests and demonstrations
+    /// </summary>
+    /// <remarks>
+    /// Items run in the order they were scheduled, promises and callables alike. Run returns as soon as there is
+    /// nothing left rather than waiting, use EventLoopTaskScheduler when other threads post to the scheduler. Given a
+    /// timer service on a ManualClock it runs on virtual time: whenever it runs out of work the
+    /// clock jumps to the next timer, so delays and timeouts complete without waiting
+    /// </remarks>
     class SynchronousTaskScheduler final : public ITaskScheduler
     {
     private:
         std::optional<std::thread::id> id;
-        std::queue<ScheduleItem> queue;
+
+        Detail::MpscItemInbox inbox;
+
+        // Note: both null unless running on virtual time
+        TimerService * timers;
+        ManualClock * clock;
 
     public:
         SynchronousTaskScheduler() noexcept;
 
+        // The timer service must be polled, not run by a dedicated thread, and read its time from clock
+        SynchronousTaskScheduler(TimerService & timers, ManualClock & clock) noexcept;
+
         ~SynchronousTaskScheduler() noexcept override = default;
 
         bool IsWorkerThread() const noexcept override;
 
         void Schedule(ScheduleItem && item) override;
 
+        void ScheduleBatch(std::span<ScheduleItem> batch) override;
+
+        void ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && batch) override;
+
+        /// <summary>
+        /// Runs items until there are none left, on virtual time also advancing the clock until no timers are armed
+        /// </summary>
         void Run();
+
+        /// <summary>
+        /// Like Run but does not advance the clock past time, on virtual time the clock is left at time
+        /// </summary>
+        void RunUntil(DeadlineClock::time_point time);
+
+    private:
+        // Fires the timers that are due, otherwise moves the clock on to the next one. Returns false when there are
+        // none before until
+        bool AdvanceTime(DeadlineClock::time_point until);
     };
 
 }  // namespace TaskSystem
\ No newline at end of file
@@ -2,20 +2,26 @@
 
 #include <TaskSystem/AtomicLockGuard.hpp>
 #include <TaskSystem/Awaitable.hpp>
+#include <TaskSystem/Deadline.hpp>
 #include <TaskSystem/Detail/Continuation.hpp>
+#include <TaskSystem/Detail/FrameAllocator.hpp>
 #include <TaskSystem/Detail/Promise.hpp>
 #include <TaskSystem/Detail/TaskStates.hpp>
 #include <TaskSystem/Detail/Utils.hpp>
 #include <TaskSystem/ITask.hpp>
 #include <TaskSystem/ITaskScheduler.hpp>
 #include <TaskSystem/ScheduleItem.hpp>
+#include <TaskSystem/TaskPriority.hpp>
 #include <TaskSystem/TaskState.hpp>
+#include <TaskSystem/TimeSlice.hpp>
 #include <TaskSystem/ValueTask.hpp>
 
 #include <atomic>
 #include <cassert>
 #include <coroutine>
+#include <cstddef>
 #include <exception>
+#include <memory>
 #include <type_traits>
 #include <variant>
 
@@ -25,13 +31,40 @@ namespace TaskSystem
 
     namespace Detail
     {
-        template <typename TResult>
+        struct TaskPromisePolicy final
+        {
+            static inline constexpr bool CanSchedule = true;
+            static inline constexpr bool CanRun = true;
+            static inline constexpr bool CanSuspend = true;
+            static inline constexpr bool AllowSuspendFromCreated = false;
+        };
+
+        /// <summary>
+        /// Task promise policy that packs the promise bookkeeping into a single cache line
+        /// </summary>
+        /// <remarks>
+        /// Smaller frames for large numbers of short-lived tasks that are rarely awaited from more than one thread,
+        /// contended tasks are better off with the default padded layout
+        /// </remarks>
+        struct CompactTaskPromisePolicy final
+        {
+            static inline constexpr bool CanSchedule = true;
+            static inline constexpr bool CanRun = true;
+            static inline constexpr bool CanSuspend = true;
+            static inline constexpr bool AllowSuspendFromCreated = false;
+            static inline constexpr bool CompactLayout = true;
+        };
+
+        template <typename TResult, PromisePolicy TPolicy = TaskPromisePolicy>
         class TaskPromise;
-    }
+    }  // namespace Detail
 
     template <typename TResult = void, typename TPromise = Detail::TaskPromise<TResult>>
     class Task;
 
+    template <typename TResult = void>
+    using CompactTask = Task<TResult, Detail::TaskPromise<TResult, Detail::CompactTaskPromisePolicy>>;
+
     namespace Detail
     {
 
@@ -97,26 +130,31 @@ namespace TaskSystem
 
             std::coroutine_handle<> await_suspend(std::coroutine_handle<>) const noexcept
             {
-                promise.ScheduleContinuations();
-                return std::noop_coroutine();
+                // Note: the result is only published once the coroutine is suspended, after this the frame can be
+                // destroyed by whoever observes the completed state
+                auto next = promise.PublishCompletionWithHandoff();
+
+                // An awaiter on this scheduler resumes straight away on this thread, skipping the queue round-trip
+                return next ? next : std::noop_coroutine();
             }
 
             constexpr void await_resume() const noexcept { }
         };
 
-        template <typename TResult, bool MoveResult>
+        template <typename TResult, bool MoveResult, PromisePolicy TPolicy = TaskPromisePolicy>
         class TaskAwaitable final
         {
         public:
             using value_type = TResult;
-            using promise_type = TaskPromise<TResult>;
+            using promise_type = TaskPromise<TResult, TPolicy>;
             using handle_type = std::coroutine_handle<promise_type>;
 
         private:
             handle_type handle;
+            Detail::ContinuationNode continuation;
 
         public:
-            TaskAwaitable(handle_type handle) noexcept : handle(handle) { }
+            TaskAwaitable(handle_type handle) noexcept : handle(handle), continuation() { }
 
             constexpr bool await_ready() const noexcept { return false; }
 
@@ -132,6 +170,13 @@ namespace TaskSystem
             {
                 if (!handle || handle.done() || handle.promise().State().IsCompleted())
                 {
+                    // Note: the caller carries on inline, unless the slice is used up and it has to give way
+                    if (TimeSliceExhausted() && callerPromise.TrySetSuspended())
+                    {
+                        Preempt(callerPromise);
+                        return std::noop_coroutine();
+                    }
+
                     return callerHandle;
                 }
 
@@ -140,10 +185,25 @@ namespace TaskSystem
                     throw std::exception("Unable to set caller promise to suspended");
                 }
 
-                if (!handle.promise().TryAddContinuation(Detail::Continuation(callerPromise)))
+                // Priority inheritance, the caller waits on this task so it must not queue behind lower priority work
+                if (callerPromise.Priority() > handle.promise().Priority())
                 {
-                    // throw std::exception("Unable to set continuation");
-                    assert(false);
+                    handle.promise().Priority(callerPromise.Priority());
+                }
+
+                // Capture the current scheduler so the caller is resumed where it was running
+                continuation = Detail::ContinuationNode(Detail::Continuation(callerPromise, CurrentScheduler()));
+                if (!handle.promise().TryAddContinuation(continuation))
+                {
+                    if (TimeSliceExhausted())
+                    {
+                        Preempt(callerPromise);
+                        return std::noop_coroutine();
+                    }
+
+                    // Completed after the check above, nothing will schedule the caller so resume it inline
+                    [[maybe_unused]] auto _ = callerPromise.TrySetRunning();
+                    return callerHandle;
                 }
 
                 auto * scheduler = handle.promise().TaskScheduler();
@@ -156,6 +216,13 @@ namespace TaskSystem
                     return std::noop_coroutine();
                 }
 
+                // Symmetric transfer keeps the task on this thread's slice, once that is used up it queues instead
+                if (TimeSliceExhausted())
+                {
+                    Preempt(handle.promise());
+                    return std::noop_coroutine();
+                }
+
                 if (handle.promise().TrySetRunning())
                 {
                     return handle;
@@ -190,25 +257,25 @@ namespace TaskSystem
             }
         };
 
+        static_assert(AwaitableFitsInline<TaskAwaitable<int, false>>, "co_await through ITask must not allocate");
+
 #pragma endregion
 
 #pragma region TaskPromise
 
-        struct TaskPromisePolicy final
-        {
-            static inline constexpr bool CanSchedule = true;
-            static inline constexpr bool CanRun = true;
-            static inline constexpr bool CanSuspend = true;
-            static inline constexpr bool AllowSuspendFromCreated = false;
-        };
-
-        template <typename TResult, typename TImpl>
-        class TaskPromiseBase : public Promise<TResult, TaskPromisePolicy>
+        // Note: TFrameAllocator allocates the coroutine frames unless the coroutine is passed an allocator, promises
+        // that derive from this can supply their own
+        template <typename TResult,
+                  typename TImpl,
+                  FrameAllocator TFrameAllocator = PooledFrameAllocator,
+                  PromisePolicy TPolicy = TaskPromisePolicy>
+        class TaskPromiseBase : public Promise<TResult, TPolicy>
         {
         public:
             using value_type = TResult;
             using promise_type = TaskPromiseBase;
             using handle_type = std::coroutine_handle<promise_type>;
+            using frame_allocator_type = TFrameAllocator;
 
         private:
             ITaskScheduler * taskScheduler = nullptr;
@@ -216,6 +283,29 @@ namespace TaskSystem
         public:
             ~TaskPromiseBase() noexcept override = default;
 
+            [[nodiscard]] static void * operator new(std::size_t size)
+            {
+                return PolicyFrame<TFrameAllocator>::Allocate(size);
+            }
+
+            // Coroutines taking std::allocator_arg_t, alloc as their leading parameters allocate the frame from alloc
+            template <typename TAlloc, typename... TArgs>
+            [[nodiscard]] static void * operator new(
+                std::size_t size, std::allocator_arg_t, TAlloc const & alloc, TArgs const &...)
+            {
+                return AllocateFrame(size, alloc);
+            }
+
+            // Member function coroutines, the first argument is the object
+            template <typename TThis, typename TAlloc, typename... TArgs>
+            [[nodiscard]] static void * operator new(
+                std::size_t size, TThis const &, std::allocator_arg_t, TAlloc const & alloc, TArgs const &...)
+            {
+                return AllocateFrame(size, alloc);
+            }
+
+            static void operator delete(void * ptr, std::size_t size) noexcept { DeallocateFrame(ptr, size); }
+
             TaskInitialSuspend<promise_type> initial_suspend() noexcept
             {
                 return TaskInitialSuspend<promise_type>(*this);
@@ -225,7 +315,7 @@ namespace TaskSystem
 
             void unhandled_exception() noexcept
             {
-                [[maybe_unused]] auto _ = this->TrySetException(std::current_exception());
+                [[maybe_unused]] auto _ = this->TryStoreException(std::current_exception());
             }
 
             [[nodiscard]] ITaskScheduler * TaskScheduler() const noexcept override { return taskScheduler; }
@@ -233,11 +323,12 @@ namespace TaskSystem
             void TaskScheduler(ITaskScheduler * value) noexcept override { taskScheduler = value; }
         };
 
-        template <typename TResult>
-        class TaskPromise final : public TaskPromiseBase<TResult, TaskPromise<TResult>>
+        template <typename TResult, PromisePolicy TPolicy>
+        class TaskPromise final
+          : public TaskPromiseBase<TResult, TaskPromise<TResult, TPolicy>, PooledFrameAllocator, TPolicy>
         {
         public:
-            using promise_type = TaskPromise<TResult>;
+            using promise_type = TaskPromise<TResult, TPolicy>;
             using handle_type = std::coroutine_handle<promise_type>;
             using task_type = Task<TResult, promise_type>;
 
@@ -251,17 +342,18 @@ namespace TaskSystem
 
             void return_value(std::convertible_to<TResult> auto && value) noexcept
             {
-                [[maybe_unused]] auto _ = this->TrySetResult(std::forward<decltype(value)>(value));
+                [[maybe_unused]] auto _ = this->TryStoreResult(std::forward<decltype(value)>(value));
             }
         };
 
-        template <typename TResult>
-        class TaskPromise<TResult &> final : public TaskPromiseBase<TResult &, TaskPromise<TResult &>>
+        template <typename TResult, PromisePolicy TPolicy>
+        class TaskPromise<TResult &, TPolicy> final
+          : public TaskPromiseBase<TResult &, TaskPromise<TResult &, TPolicy>, PooledFrameAllocator, TPolicy>
         {
         public:
-            using promise_type = TaskPromise<TResult &>;
+            using promise_type = TaskPromise<TResult &, TPolicy>;
             using handle_type = std::coroutine_handle<promise_type>;
-            using task_type = Task<TResult &, TaskPromise<TResult &>>;
+            using task_type = Task<TResult &, promise_type>;
 
         public:
             [[nodiscard]] std::coroutine_handle<> Handle() noexcept override
@@ -271,15 +363,17 @@ namespace TaskSystem
 
             task_type get_return_object() noexcept { return task_type(handle_type::from_promise(*this)); }
 
-            void return_value(TResult & value) noexcept { [[maybe_unused]] auto _ = this->TrySetResult(value); }
+            void return_value(TResult & value) noexcept { [[maybe_unused]] auto _ = this->TryStoreResult(value); }
         };
 
-        template <>
-        class TaskPromise<void> final : public TaskPromiseBase<void, TaskPromise<void>>
+        template <PromisePolicy TPolicy>
+        class TaskPromise<void, TPolicy> final
+          : public TaskPromiseBase<void, TaskPromise<void, TPolicy>, PooledFrameAllocator, TPolicy>
         {
         public:
-            using promise_type = TaskPromise;
+            using promise_type = TaskPromise<void, TPolicy>;
             using handle_type = std::coroutine_handle<promise_type>;
+            using task_type = Task<void, promise_type>;
 
         public:
             [[nodiscard]] std::coroutine_handle<> Handle() noexcept override
@@ -287,11 +381,11 @@ namespace TaskSystem
                 return handle_type::from_promise(*this);
             }
 
-            Task<void, TaskPromise<void>> get_return_object() noexcept;
+            task_type get_return_object() noexcept { return task_type(handle_type::from_promise(*this)); }
 
             void return_void() noexcept
             {
-                [[maybe_unused]] auto _ = this->TrySetCompleted();
+                [[maybe_unused]] auto _ = this->TryStoreCompleted();
             }
         };
 
@@ -299,12 +393,12 @@ namespace TaskSystem
 
 #pragma region Task
 
-        template <typename TResult>
+        template <typename TResult, PromisePolicy TPolicy>
         class TaskBase : public ITask<TResult>
         {
         public:
             using value_type = TResult;
-            using promise_type = TaskPromise<TResult>;
+            using promise_type = TaskPromise<TResult, TPolicy>;
             using handle_type = std::coroutine_handle<promise_type>;
 
         protected:
@@ -376,8 +470,8 @@ namespace TaskSystem
                 return ScheduleItem(handle.promise());
             }
 
-            auto operator co_await() const & noexcept { return TaskAwaitable<TResult, false>(handle); }
-            auto operator co_await() const && noexcept { return TaskAwaitable<TResult, true>(handle); }
+            auto operator co_await() const & noexcept { return TaskAwaitable<TResult, false, TPolicy>(handle); }
+            auto operator co_await() const && noexcept { return TaskAwaitable<TResult, true, TPolicy>(handle); }
 
             [[nodiscard]] TaskState State() const noexcept override final
             {
@@ -408,30 +502,50 @@ namespace TaskSystem
                 handle.promise().ContinuationScheduler(&taskScheduler);
             }
 
-            AddContinuationResult ContinueWith(Detail::Continuation && continuation)
+            // Awaiters on the completing thread's scheduler are resumed inline, see ContinuationOptions. Must be called
+            // before the task completes
+            void ContinueSynchronously() &
             {
-                return handle.promise().TryAddContinuation(std::move(continuation));
+                handle.promise().ContinuationOptions(ContinuationOptions::ExecuteSynchronously);
+            }
+
+            [[nodiscard]] TaskPriority Priority() const noexcept { return handle.promise().Priority(); }
+
+            // Lane the task is queued in by priority schedulers, must be called before the task is scheduled
+            void WithPriority(TaskPriority priority) & { handle.promise().Priority(priority); }
+
+            [[nodiscard]] DeadlineClock::time_point Deadline() const noexcept { return handle.promise().Deadline(); }
+
+            // Deadline schedulers fault the task with DeadlineExceeded rather than start it after deadline, must be
+            // called before the task is scheduled
+            void WithDeadline(DeadlineClock::time_point deadline) & { handle.promise().Deadline(deadline); }
+
+            // Adds without allocating, the node must stay alive until the continuation is scheduled
+            AddContinuationResult ContinueWith(Detail::ContinuationNode & node)
+            {
+                return handle.promise().TryAddContinuation(node);
             }
 
         protected:
             [[nodiscard]] Awaitable<TResult> GetAwaitable() & noexcept override
             {
-                return Awaitable<TResult>(TaskAwaitable<TResult, false>(handle));
+                return Awaitable<TResult>(TaskAwaitable<TResult, false, TPolicy>(handle));
             }
 
             [[nodiscard]] Awaitable<TResult> GetAwaitable() && noexcept override
             {
-                return Awaitable<TResult>(TaskAwaitable<TResult, true>(handle));
+                return Awaitable<TResult>(TaskAwaitable<TResult, true, TPolicy>(handle));
             }
         };
 
     }  // namespace Detail
 
-    template <typename TResult>
-    class [[nodiscard]] Task<TResult, Detail::TaskPromise<TResult>> final : public Detail::TaskBase<TResult>
+    template <typename TResult, Detail::PromisePolicy TPolicy>
+    class [[nodiscard]] Task<TResult, Detail::TaskPromise<TResult, TPolicy>> final
+      : public Detail::TaskBase<TResult, TPolicy>
     {
     public:
-        using base_type = Detail::TaskBase<TResult>;
+        using base_type = Detail::TaskBase<TResult, TPolicy>;
 
         using value_type = base_type::value_type;
         using promise_type = base_type::promise_type;
@@ -453,25 +567,11 @@ namespace TaskSystem
 
         // ToDo: use concept
         template <typename TFunc, std::enable_if_t<std::is_same_v<TResult, std::invoke_result_t<TFunc>>> * = nullptr>
-        [[nodiscard]] static Task<TResult, Detail::TaskPromise<TResult>> From(TFunc && func)
+        [[nodiscard]] static Task From(TFunc && func)
         {
             co_return std::forward<TFunc>(func)();
         }
 
-        // ToDo: use concept
-        template <typename TFunc, std::enable_if_t<std::is_same_v<TResult, std::invoke_result_t<TFunc>>> * = nullptr>
-        static void Run(TFunc && func)
-        {
-            Run(std::forward<TFunc>(func), DefaultScheduler());
-        }
-
-        // ToDo: use concept
-        template <typename TFunc, std::enable_if_t<std::is_same_v<TResult, std::invoke_result_t<TFunc>>> * = nullptr>
-        static void Run(TFunc && func, ITaskScheduler & scheduler)
-        {
-            scheduler.Schedule(ScheduleItem(From(std::forward<TFunc>(func))));
-        }
-
         [[nodiscard]] static ValueTask<TResult> FromResult(TResult const & result)
         {
             return ValueTask<TResult>(result);
@@ -537,13 +637,26 @@ namespace TaskSystem
             this->handle.promise().ContinuationScheduler(&taskScheduler);
             return std::move(*this);
         }
+
+        [[nodiscard]] Task && WithPriority(TaskPriority priority) &&
+        {
+            this->handle.promise().Priority(priority);
+            return std::move(*this);
+        }
+
+        [[nodiscard]] Task && WithDeadline(DeadlineClock::time_point deadline) &&
+        {
+            this->handle.promise().Deadline(deadline);
+            return std::move(*this);
+        }
     };
 
-    template <typename TResult>
-    class [[nodiscard]] Task<TResult &, Detail::TaskPromise<TResult &>> final : public Detail::TaskBase<TResult &>
+    template <typename TResult, Detail::PromisePolicy TPolicy>
+    class [[nodiscard]] Task<TResult &, Detail::TaskPromise<TResult &, TPolicy>> final
+      : public Detail::TaskBase<TResult &, TPolicy>
     {
     public:
-        using base_type = Detail::TaskBase<TResult &>;
+        using base_type = Detail::TaskBase<TResult &, TPolicy>;
 
         using value_type = base_type::value_type;
         using promise_type = base_type::promise_type;
@@ -565,25 +678,11 @@ namespace TaskSystem
 
         // ToDo: use concept
         template <typename TFunc, std::enable_if_t<std::is_same_v<TResult &, std::invoke_result_t<TFunc>>> * = nullptr>
-        [[nodiscard]] static Task<TResult &, Detail::TaskPromise<TResult &>> From(TFunc && func)
+        [[nodiscard]] static Task From(TFunc && func)
         {
             co_return std::forward<TFunc>(func)();
         }
 
-        // ToDo: use concept
-        template <typename TFunc, std::enable_if_t<std::is_same_v<TResult, std::invoke_result_t<TFunc>>> * = nullptr>
-        static void Run(TFunc && func)
-        {
-            Run(std::forward<TFunc>(func), DefaultScheduler());
-        }
-
-        // ToDo: use concept
-        template <typename TFunc, std::enable_if_t<std::is_same_v<TResult, std::invoke_result_t<TFunc>>> * = nullptr>
-        static void Run(TFunc && func, ITaskScheduler & scheduler)
-        {
-            scheduler.Schedule(ScheduleItem(From(std::forward<TFunc>(func))));
-        }
-
         [[nodiscard]] static ValueTask<TResult &> FromResult(TResult const & result)
         {
             return ValueTask<TResult &>(result);
@@ -627,13 +726,25 @@ namespace TaskSystem
             this->handle.promise().ContinuationScheduler(&taskScheduler);
             return std::move(*this);
         }
+
+        [[nodiscard]] Task && WithPriority(TaskPriority priority) &&
+        {
+            this->handle.promise().Priority(priority);
+            return std::move(*this);
+        }
+
+        [[nodiscard]] Task && WithDeadline(DeadlineClock::time_point deadline) &&
+        {
+            this->handle.promise().Deadline(deadline);
+            return std::move(*this);
+        }
     };
 
-    template <>
-    class [[nodiscard]] Task<void, Detail::TaskPromise<void>> final : public Detail::TaskBase<void>
+    template <Detail::PromisePolicy TPolicy>
+    class [[nodiscard]] Task<void, Detail::TaskPromise<void, TPolicy>> final : public Detail::TaskBase<void, TPolicy>
     {
     public:
-        using base_type = Detail::TaskBase<void>;
+        using base_type = Detail::TaskBase<void, TPolicy>;
 
         using value_type = base_type::value_type;
         using promise_type = base_type::promise_type;
@@ -645,7 +756,7 @@ namespace TaskSystem
         Task(Task const &) = delete;
         Task & operator=(Task const &) = delete;
 
-        Task(Task<void, Detail::TaskPromise<void>> && other) noexcept : base_type(std::move(other)) { }
+        Task(Task && other) noexcept : base_type(std::move(other)) { }
 
         Task & operator=(Task && other) noexcept
         {
@@ -655,26 +766,12 @@ namespace TaskSystem
 
         // ToDo: use concept
         template <typename TFunc, std::enable_if_t<std::is_void_v<std::invoke_result_t<TFunc>>> * = nullptr>
-        [[nodiscard]] static Task<void, Detail::TaskPromise<void>> From(TFunc && func)
+        [[nodiscard]] static Task From(TFunc && func)
         {
             std::forward<TFunc>(func)();
             co_return;
         }
 
-        // ToDo: use concept
-        template <typename TFunc, std::enable_if_t<std::is_void_v<std::invoke_result_t<TFunc>>> * = nullptr>
-        static void Run(TFunc && func)
-        {
-            Run(std::forward<TFunc>(func), DefaultScheduler());
-        }
-
-        // ToDo: use concept
-        template <typename TFunc, std::enable_if_t<std::is_void_v<std::invoke_result_t<TFunc>>> * = nullptr>
-        static void Run(TFunc && func, ITaskScheduler & scheduler)
-        {
-            scheduler.Schedule(ScheduleItem(From(std::forward<TFunc>(func))));
-        }
-
         void ThrowIfFaulted() const override
         {
             if (!this->handle)
@@ -697,6 +794,18 @@ namespace TaskSystem
             this->handle.promise().ContinuationScheduler(&taskScheduler);
             return std::move(*this);
         }
+
+        [[nodiscard]] Task && WithPriority(TaskPriority priority) &&
+        {
+            this->handle.promise().Priority(priority);
+            return std::move(*this);
+        }
+
+        [[nodiscard]] Task && WithDeadline(DeadlineClock::time_point deadline) &&
+        {
+            this->handle.promise().Deadline(deadline);
+            return std::move(*this);
+        }
     };
 
     // Maybe: Task::FromResult() task with no coroutine/promise
@@ -705,14 +814,4 @@ namespace TaskSystem
 
 #pragma endregion
 
-    namespace Detail
-    {
-
-        inline Task<void, TaskPromise<void>> TaskPromise<void>::get_return_object() noexcept
-        {
-            return Task<void, TaskPromise<void>>(handle_type::from_promise(*this));
-        }
-
-    }  // namespace Detail
-
 }  // namespace TaskSystem
\ No newline at end of file
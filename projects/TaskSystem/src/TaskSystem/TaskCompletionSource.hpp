@@ -2,6 +2,7 @@
 
 #include <TaskSystem/AtomicLockGuard.hpp>
 #include <TaskSystem/Awaitable.hpp>
+#include <TaskSystem/ContinuationOptions.hpp>
 #include <TaskSystem/Detail/Continuation.hpp>
 #include <TaskSystem/Detail/Promise.hpp>
 #include <TaskSystem/Detail/TaskStates.hpp>
@@ -45,9 +46,10 @@ namespace TaskSystem
 
         private:
             promise_type & promise;
+            Detail::ContinuationNode continuation;
 
         public:
-            TaskCompletionSourceAwaitable(promise_type & promise) noexcept : promise(promise) { }
+            TaskCompletionSourceAwaitable(promise_type & promise) noexcept : promise(promise), continuation() { }
 
             constexpr bool await_ready() const noexcept { return false; }
 
@@ -72,10 +74,12 @@ namespace TaskSystem
                 }
 
                 // Suspend the caller and don't schedule anything new
-                if (!promise.TryAddContinuation(Detail::Continuation(callerPromise, CurrentScheduler())))
+                continuation = Detail::ContinuationNode(Detail::Continuation(callerPromise, CurrentScheduler()));
+                if (!promise.TryAddContinuation(continuation))
                 {
-                    // Maybe: check is status is completed and return caller handle;
-                    throw std::exception("Unable to schedule continuation");
+                    // Completed after the check above, nothing will schedule the caller so resume it inline
+                    [[maybe_unused]] auto _ = callerPromise.TrySetRunning();
+                    return callerHandle;
                 }
 
                 return std::noop_coroutine();
@@ -97,6 +101,9 @@ namespace TaskSystem
             }
         };
 
+        static_assert(AwaitableFitsInline<TaskCompletionSourceAwaitable<int, false>>,
+                      "co_await through ITask must not allocate");
+
 #pragma region Task
 
         template <typename TResult>
@@ -129,9 +136,12 @@ namespace TaskSystem
 
             void ContinueOn(ITaskScheduler & taskScheduler) & { promise.ContinuationScheduler(&taskScheduler); }
 
-            AddContinuationResult ContinueWith(Detail::Continuation && continuation)
+            void ContinueSynchronously() & { promise.ContinuationOptions(ContinuationOptions::ExecuteSynchronously); }
+
+            // Adds without allocating, the node must stay alive until the continuation is scheduled
+            AddContinuationResult ContinueWith(Detail::ContinuationNode & node)
             {
-                return promise.TryAddContinuation(std::move(continuation));
+                return promise.TryAddContinuation(node);
             }
 
         protected:
@@ -276,6 +286,11 @@ namespace TaskSystem
         public:
             TaskCompletionSourceBase() noexcept = default;
 
+            explicit TaskCompletionSourceBase(ContinuationOptions options) noexcept
+            {
+                promise.ContinuationOptions(options);
+            }
+
             TaskCompletionSourceBase(TaskCompletionSourceBase const &) = delete;
             TaskCompletionSourceBase & operator=(TaskCompletionSourceBase const &) = delete;
 
@@ -323,6 +338,8 @@ namespace TaskSystem
     class TaskCompletionSource final : public Detail::TaskCompletionSourceBase<TResult>
     {
     public:
+        using Detail::TaskCompletionSourceBase<TResult>::TaskCompletionSourceBase;
+
         template <typename TValue, std::enable_if_t<std::is_convertible_v<TValue &&, TResult>> * = nullptr>
         [[nodiscard]] bool TrySetResult(TValue && value) noexcept(
             std::is_nothrow_constructible_v<TResult, decltype(value)>)
@@ -344,6 +361,8 @@ namespace TaskSystem
     class TaskCompletionSource<void> final : public Detail::TaskCompletionSourceBase<void>
     {
     public:
+        using Detail::TaskCompletionSourceBase<void>::TaskCompletionSourceBase;
+
         [[nodiscard]] bool TrySetCompleted() noexcept { return this->promise.TrySetCompleted(); }
 
         void SetCompleted()
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace TaskSystem
+{
+
+    /// <summary>
+    /// Lane a task is queued in by schedulers that support priorities, others ignore it
+    /// </summary>
+    /// <remarks>
+    /// A task awaited by a higher priority task is raised to the awaiter's priority so the awaiter is not held up
+    /// behind lower priority work
+    /// </remarks>
+    enum class TaskPriority : std::uint8_t
+    {
+        Low,
+        Normal,
+        High,
+    };
+
+    inline constexpr std::size_t TaskPriorityCount = 3u;
+
+}  // namespace TaskSystem
\ No newline at end of file
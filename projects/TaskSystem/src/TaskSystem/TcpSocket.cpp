@@ -0,0 +1,199 @@
+#include <TaskSystem/TcpSocket.hpp>
+
+#if defined(__linux__)
+
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace TaskSystem
+{
+
+    namespace
+    {
+        [[noreturn]] void ThrowLastError(char const * what)
+        {
+            throw std::system_error(errno, std::system_category(), what);
+        }
+
+    }  // namespace
+
+    namespace Detail
+    {
+
+        std::coroutine_handle<> SocketAwaitableBase::await_suspend(
+            std::coroutine_handle<> callerHandle, IPromise & callerPromise)
+        {
+            if (!callerPromise.TrySetSuspended())
+            {
+                throw std::runtime_error("Unable to set caller promise to suspended");
+            }
+
+            operation.Caller = &callerPromise;
+
+            if (!reactor.TryComplete(operation, slot))
+            {
+                // Note: parked, the reactor can resume the caller, and destroy this awaitable, at any point from here
+                return std::noop_coroutine();
+            }
+
+            auto * scheduler = operation.Scheduler;
+            if (scheduler == nullptr || IsCurrentScheduler(scheduler))
+            {
+                [[maybe_unused]] auto _ = callerPromise.TrySetRunning();
+                return callerHandle;
+            }
+
+            if (callerPromise.TrySetScheduled())
+            {
+                scheduler->Schedule(ScheduleItem(callerPromise));
+            }
+
+            return std::noop_coroutine();
+        }
+
+        void SocketAwaitableBase::ThrowIfFailed() const
+        {
+            if (operation.Result < 0)
+            {
+                throw std::system_error(-operation.Result, std::system_category());
+            }
+        }
+
+    }  // namespace Detail
+
+    TcpSocket::TcpSocket(ReactorTaskScheduler & reactor, int fd) : reactor(&reactor), state(nullptr)
+    {
+        auto flags = ::fcntl(fd, F_GETFL);
+        if (flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)
+        {
+            auto error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::system_category(), "fcntl");
+        }
+
+        auto * newState = new Detail::SocketState();
+        newState->Fd = fd;
+
+        try
+        {
+            reactor.Register(*newState);
+        }
+        catch (...)
+        {
+            delete newState;
+            ::close(fd);
+            throw;
+        }
+
+        state = newState;
+    }
+
+    TcpSocket::TcpSocket(TcpSocket && other) noexcept
+      : reactor(other.reactor), state(std::exchange(other.state, nullptr))
+    { }
+
+    TcpSocket & TcpSocket::operator=(TcpSocket && other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+            reactor = other.reactor;
+            state = std::exchange(other.state, nullptr);
+        }
+        return *this;
+    }
+
+    TcpSocket::~TcpSocket() noexcept { Close(); }
+
+    TcpSocket TcpSocket::Open(ReactorTaskScheduler & reactor, int family)
+    {
+        auto fd = ::socket(family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0)
+        {
+            ThrowLastError("socket");
+        }
+
+        return TcpSocket(reactor, fd);
+    }
+
+    TcpSocket TcpSocket::Listen(ReactorTaskScheduler & reactor, sockaddr const * address, socklen_t length, int backlog)
+    {
+        auto socket = Open(reactor, address->sa_family);
+
+        auto reuse = 1;
+        ::setsockopt(socket.Fd(), SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        if (::bind(socket.Fd(), address, length) < 0)
+        {
+            ThrowLastError("bind");
+        }
+
+        if (::listen(socket.Fd(), backlog) < 0)
+        {
+            ThrowLastError("listen");
+        }
+
+        return socket;
+    }
+
+    int TcpSocket::Fd() const noexcept { return state ? state->Fd : -1; }
+
+    void TcpSocket::Close() noexcept
+    {
+        if (auto * closing = std::exchange(state, nullptr))
+        {
+            auto fd = closing->Fd;
+
+            // Note: the state is freed by the reactor thread, an event it has already read can still refer to it
+            reactor->Retire(*closing);
+            ::close(fd);
+        }
+    }
+
+    Detail::SocketAwaitable<std::size_t> TcpSocket::ReadAsync(std::span<std::byte> buffer)
+    {
+        auto operation = Detail::SocketOperation();
+        operation.Kind = Detail::SocketOperationKind::Read;
+        operation.Fd = state->Fd;
+        operation.Buffer = buffer.data();
+        operation.Length = buffer.size();
+        return Detail::SocketAwaitable<std::size_t>(*reactor, state->Reader, operation);
+    }
+
+    Detail::SocketAwaitable<std::size_t> TcpSocket::WriteAsync(std::span<std::byte const> buffer)
+    {
+        auto operation = Detail::SocketOperation();
+        operation.Kind = Detail::SocketOperationKind::Write;
+        operation.Fd = state->Fd;
+        // Note: only read from, the operation shares one buffer field for both directions
+        operation.Buffer = const_cast<std::byte *>(buffer.data());
+        operation.Length = buffer.size();
+        return Detail::SocketAwaitable<std::size_t>(*reactor, state->Writer, operation);
+    }
+
+    Detail::SocketAwaitable<TcpSocket> TcpSocket::AcceptAsync()
+    {
+        auto operation = Detail::SocketOperation();
+        operation.Kind = Detail::SocketOperationKind::Accept;
+        operation.Fd = state->Fd;
+        return Detail::SocketAwaitable<TcpSocket>(*reactor, state->Reader, operation);
+    }
+
+    Detail::SocketAwaitable<void> TcpSocket::ConnectAsync(sockaddr const * address, socklen_t length)
+    {
+        auto operation = Detail::SocketOperation();
+        operation.Kind = Detail::SocketOperationKind::Connect;
+        operation.Fd = state->Fd;
+        operation.Address = address;
+        operation.AddressLength = length;
+        return Detail::SocketAwaitable<void>(*reactor, state->Writer, operation);
+    }
+
+}  // namespace TaskSystem
+
+#endif
@@ -0,0 +1,175 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/SocketState.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+#include <TaskSystem/ReactorTaskScheduler.hpp>
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <sys/socket.h>
+
+
+namespace TaskSystem
+{
+
+    namespace Detail
+    {
+
+        class SocketAwaitableBase
+        {
+        protected:
+            ReactorTaskScheduler & reactor;
+            std::atomic<SocketOperation *> & slot;
+            SocketOperation operation;
+
+        public:
+            SocketAwaitableBase(ReactorTaskScheduler & reactor, std::atomic<SocketOperation *> & slot,
+                SocketOperation const & operation) noexcept
+              : reactor(reactor), slot(slot), operation(operation)
+            { }
+
+            SocketAwaitableBase(SocketAwaitableBase const &) = delete;
+            SocketAwaitableBase & operator=(SocketAwaitableBase const &) = delete;
+
+            // Note: only moved before it is awaited, e.g. out of ContinueOn
+            SocketAwaitableBase(SocketAwaitableBase &&) noexcept = default;
+            SocketAwaitableBase & operator=(SocketAwaitableBase &&) = delete;
+
+            ~SocketAwaitableBase() noexcept = default;
+
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+            // ToDo: use PromiseType concept
+            template <typename TPromise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> callerHandle)
+            {
+                IPromise & callerPromise = callerHandle.promise();
+                return await_suspend(callerHandle, callerPromise);
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> callerHandle, IPromise & callerPromise);
+
+        protected:
+            // Throws std::system_error for a failed call
+            void ThrowIfFailed() const;
+        };
+
+        /// <summary>
+        /// Makes a socket call when awaited and, if it would block, parks until the reactor sees the socket ready
+        /// </summary>
+        /// <remarks>
+        /// A call that completes straight away does not suspend. The operation lives in the awaitable, so in the
+        /// caller's frame, nothing is allocated per call
+        /// </remarks>
+        template <typename TResult>
+        class SocketAwaitable final : public SocketAwaitableBase
+        {
+        public:
+            using SocketAwaitableBase::SocketAwaitableBase;
+
+            // Resumes the caller on scheduler instead of inline on the reactor thread
+            [[nodiscard]] SocketAwaitable ContinueOn(ITaskScheduler & scheduler) &&
+            {
+                operation.Scheduler = &scheduler;
+                return std::move(*this);
+            }
+
+            TResult await_resume()
+            {
+                ThrowIfFailed();
+
+                if constexpr (std::is_same_v<TResult, std::size_t>)
+                {
+                    return static_cast<std::size_t>(operation.Result);
+                }
+                else if constexpr (!std::is_void_v<TResult>)
+                {
+                    // Note: an accepted connection, adopted by the same reactor
+                    return TResult(reactor, operation.Result);
+                }
+            }
+        };
+
+    }  // namespace Detail
+
+    /// <summary>
+    /// Non-blocking TCP socket whose calls are awaited on a ReactorTaskScheduler
+    /// </summary>
+    /// <remarks>
+    /// At most one read and one write, an accept counts as a read and a connect as a write, can be outstanding at a
+    /// time. Callers are resumed inline on the reactor thread unless the awaitable is given ContinueOn, e.g.
+    /// co_await socket.ReadAsync(buffer).ContinueOn(pool). Closing the socket fails outstanding calls with ECANCELED
+    /// </remarks>
+    class TcpSocket final
+    {
+    private:
+        ReactorTaskScheduler * reactor;
+        Detail::SocketState * state;
+
+    public:
+        /// <summary>
+        /// Adopts a socket, makes it non-blocking and registers it with the reactor
+        /// </summary>
+        /// <remarks>
+        /// Throws std::system_error if it cannot be registered, the fd is closed
+        /// </remarks>
+        TcpSocket(ReactorTaskScheduler & reactor, int fd);
+
+        TcpSocket(TcpSocket const &) = delete;
+        TcpSocket & operator=(TcpSocket const &) = delete;
+
+        TcpSocket(TcpSocket && other) noexcept;
+        TcpSocket & operator=(TcpSocket && other) noexcept;
+
+        ~TcpSocket() noexcept;
+
+        /// <summary>
+        /// Creates an unconnected socket, throws std::system_error on failure
+        /// </summary>
+        [[nodiscard]] static TcpSocket Open(ReactorTaskScheduler & reactor, int family = AF_INET);
+
+        /// <summary>
+        /// Creates a socket listening on address, throws std::system_error on failure
+        /// </summary>
+        [[nodiscard]] static TcpSocket Listen(
+            ReactorTaskScheduler & reactor, sockaddr const * address, socklen_t length, int backlog = SOMAXCONN);
+
+        [[nodiscard]] int Fd() const noexcept;
+
+        [[nodiscard]] bool IsOpen() const noexcept { return state != nullptr; }
+
+        // A read, write, accept or connect still waiting on the socket fails with ECANCELED
+        void Close() noexcept;
+
+        /// <summary>
+        /// co_await to receive up to buffer.size() bytes, returns the number received, 0 once the peer has shut down
+        /// </summary>
+        [[nodiscard]] Detail::SocketAwaitable<std::size_t> ReadAsync(std::span<std::byte> buffer);
+
+        /// <summary>
+        /// co_await to send up to buffer.size() bytes, returns the number sent
+        /// </summary>
+        [[nodiscard]] Detail::SocketAwaitable<std::size_t> WriteAsync(std::span<std::byte const> buffer);
+
+        /// <summary>
+        /// co_await for the next connection on a listening socket
+        /// </summary>
+        [[nodiscard]] Detail::SocketAwaitable<TcpSocket> AcceptAsync();
+
+        /// <summary>
+        /// co_await to connect, the address must outlive the co_await
+        /// </summary>
+        [[nodiscard]] Detail::SocketAwaitable<void> ConnectAsync(sockaddr const * address, socklen_t length);
+    };
+
+}  // namespace TaskSystem
+
+#endif
@@ -0,0 +1,566 @@
+#include <TaskSystem/Detail/FrameAllocator.hpp>
+#include <TaskSystem/Detail/HillClimbing.hpp>
+#include <TaskSystem/ThreadPoolTaskScheduler.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+
+namespace TaskSystem
+{
+
+    void SetCurrentScheduler(ITaskScheduler * scheduler);
+
+    thread_local ThreadPoolTaskScheduler::Worker * ThreadPoolTaskScheduler::currentWorker = nullptr;
+
+    ThreadPoolTaskScheduler::Worker::Worker(ThreadPoolTaskScheduler & scheduler, size_t index)
+      : scheduler(scheduler)
+      , index(index)
+      , deque()
+      , next()
+      , randomState(0x9E3779B97F4A7C15ull * (index + 1u))
+      , thread()
+      , started(0u)
+      , finished(0u)
+      , retiring(false)
+      , exited(false)
+      , active(false)
+      , blocked(false)
+      , lastStarted(0u)
+      , progressAt()
+    { }
+
+    size_t ThreadPoolTaskScheduler::Worker::NextVictim() noexcept
+    {
+        // xorshift64
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 7;
+        randomState ^= randomState << 17;
+        return static_cast<size_t>(randomState % scheduler.slotCount.load(std::memory_order_acquire));
+    }
+
+    ThreadPoolTaskScheduler::ThreadPoolTaskScheduler(size_t workerCount, IdleStrategy idleStrategy)
+      : ThreadPoolTaskScheduler(workerCount, idleStrategy, 0u, ElasticPoolOptions())
+    { }
+
+    ThreadPoolTaskScheduler::ThreadPoolTaskScheduler(size_t workerCount,
+                                                     IdleStrategy idleStrategy,
+                                                     ElasticPoolOptions const & options)
+      : ThreadPoolTaskScheduler(workerCount, idleStrategy, options.MaxWorkers, options)
+    { }
+
+    ThreadPoolTaskScheduler::ThreadPoolTaskScheduler(size_t workerCount,
+                                                     IdleStrategy idleStrategy,
+                                                     size_t slots,
+                                                     ElasticPoolOptions const & options)
+      : workers()
+      , slotCount(0u)
+      , activeCount(0u)
+      , minWorkers(std::max<size_t>(workerCount, 1u))
+      , injectedPromises()
+      , injectionMutex()
+      , injectionQueue()
+      , injectionCount(0u)
+      , idleEvent()
+      , idleStrategy(idleStrategy)
+      , stopping(false)
+      , elasticOptions(options)
+      , monitorMutex()
+      , monitorWake()
+      , monitor()
+    {
+        slots = std::max(slots, minWorkers);
+
+        workers.reserve(slots);
+        for (auto i = 0u; i < slots; ++i)
+        {
+            workers.emplace_back(std::make_unique<Worker>(*this, i));
+        }
+
+        // Note: start threads after all workers exist so thieves never see a partially built vector
+        for (auto i = 0u; i < minWorkers; ++i)
+        {
+            StartWorker(*workers[i]);
+        }
+
+        if (slots > minWorkers)
+        {
+            monitor = std::thread([this]() { MonitorLoop(); });
+        }
+    }
+
+    ThreadPoolTaskScheduler::~ThreadPoolTaskScheduler() noexcept { Stop(); }
+
+    bool ThreadPoolTaskScheduler::IsWorkerThread() const noexcept
+    {
+        auto * worker = currentWorker;
+        return worker && &worker->scheduler == this;
+    }
+
+    void ThreadPoolTaskScheduler::Schedule(ScheduleItem && item)
+    {
+        auto * worker = currentWorker;
+
+        if (worker && &worker->scheduler == this)
+        {
+            // Note: items other than promises are boxed in pooled memory to fit the deque
+            auto previous = std::exchange(worker->next, ReadyItem::Box(std::move(item)));
+
+            if (!previous)
+            {
+                // Only this worker can run the slot, there is nothing for a sleeping worker to steal
+                return;
+            }
+
+            worker->deque.Push(previous);
+        }
+        else
+        {
+            Inject(std::move(item));
+        }
+
+        WakeOne();
+    }
+
+    void ThreadPoolTaskScheduler::ScheduleBatch(std::span<ScheduleItem> items)
+    {
+        auto * worker = currentWorker;
+
+        if (worker && &worker->scheduler == this)
+        {
+            for (auto & item : items)
+            {
+                worker->deque.Push(ReadyItem::Box(std::move(item)));
+            }
+        }
+        else
+        {
+            auto promises = Detail::IntrusiveList<Detail::IPromise>();
+            auto hasItems = false;
+
+            for (auto & item : items)
+            {
+                if (auto * promise = item.Promise())
+                {
+                    promises.PushBack(*promise);
+                }
+                else
+                {
+                    hasItems = true;
+                }
+            }
+
+            if (!promises.Empty())
+            {
+                injectionCount.fetch_add(promises.Size(), std::memory_order_relaxed);
+                injectedPromises.Push(std::move(promises));
+            }
+
+            if (hasItems)
+            {
+                std::lock_guard lock(injectionMutex);
+                for (auto & item : items)
+                {
+                    if (!item.Promise())
+                    {
+                        injectionQueue.push_back(Detail::PooledNew<Detail::QueuedItem>(std::move(item)));
+                        injectionCount.fetch_add(1u, std::memory_order_relaxed);
+                    }
+                }
+            }
+        }
+
+        WakeOne();
+    }
+
+    void ThreadPoolTaskScheduler::ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && promises)
+    {
+        if (promises.Empty())
+        {
+            return;
+        }
+
+        auto * worker = currentWorker;
+
+        if (worker && &worker->scheduler == this)
+        {
+            worker->deque.PushBatch(promises.Size(), [&]() { return ReadyItem(promises.PopFront()); });
+        }
+        else
+        {
+            injectionCount.fetch_add(promises.Size(), std::memory_order_relaxed);
+            injectedPromises.Push(std::move(promises));
+        }
+
+        WakeOne();
+    }
+
+    void ThreadPoolTaskScheduler::Requeue(ScheduleItem && item)
+    {
+        Inject(std::move(item));
+        WakeOne();
+    }
+
+    void ThreadPoolTaskScheduler::Stop() noexcept
+    {
+        // Note: only the first call stops the workers, a later one faults whatever was scheduled since
+        if (!stopping.exchange(true, std::memory_order_acq_rel))
+        {
+            StopWorkers();
+        }
+
+        while (auto * promise = injectedPromises.Pop())
+        {
+            ReadyItem(promise).Reject();
+        }
+
+        std::lock_guard lock(injectionMutex);
+        for (auto * item : injectionQueue)
+        {
+            Detail::PooledDelete(item);
+        }
+        injectionQueue.clear();
+        injectionCount.store(0u, std::memory_order_relaxed);
+    }
+
+    void ThreadPoolTaskScheduler::StopWorkers() noexcept
+    {
+        // Note: the monitor is joined first so it cannot start workers behind the joins below
+        {
+            std::lock_guard lock(monitorMutex);
+        }
+        monitorWake.notify_all();
+
+        if (monitor.joinable())
+        {
+            monitor.join();
+        }
+
+        idleEvent.NotifyAll();
+
+        for (auto & worker : workers)
+        {
+            if (worker->thread.joinable())
+            {
+                worker->thread.join();
+            }
+        }
+
+        // Note: all workers have exited so the deques can be drained from this thread. Faulting a promise schedules
+        // its continuations, those bound for this pool are injected and faulted by Stop after
+        for (auto & worker : workers)
+        {
+            if (auto item = std::exchange(worker->next, ReadyItem()))
+            {
+                item.Reject();
+            }
+
+            while (auto item = worker->deque.Pop())
+            {
+                item->Reject();
+            }
+        }
+    }
+
+    void ThreadPoolTaskScheduler::Inject(ScheduleItem && item)
+    {
+        if (auto * promise = item.Promise())
+        {
+            // Note: counted before the push so a worker never sees the item without the count
+            injectionCount.fetch_add(1u, std::memory_order_relaxed);
+            injectedPromises.Push(*promise);
+            return;
+        }
+
+        auto * value = Detail::PooledNew<Detail::QueuedItem>(std::move(item));
+
+        std::lock_guard lock(injectionMutex);
+        injectionQueue.push_back(value);
+        injectionCount.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    void ThreadPoolTaskScheduler::StartWorker(Worker & worker)
+    {
+        worker.retiring.store(false, std::memory_order_relaxed);
+        worker.exited.store(false, std::memory_order_relaxed);
+
+        worker.active = true;
+        worker.blocked = false;
+        worker.lastStarted = worker.started.load(std::memory_order_relaxed);
+        worker.progressAt = std::chrono::steady_clock::now();
+
+        // Note: slots only start from the constructor or the monitor, never both at once
+        if (worker.index >= slotCount.load(std::memory_order_relaxed))
+        {
+            slotCount.store(worker.index + 1u, std::memory_order_release);
+        }
+
+        activeCount.fetch_add(1u, std::memory_order_relaxed);
+        worker.thread = std::thread([this, &worker]() { WorkerLoop(worker); });
+    }
+
+    void ThreadPoolTaskScheduler::WorkerLoop(Worker & worker)
+    {
+        currentWorker = &worker;
+        SetCurrentScheduler(this);
+
+        while (!stopping.load(std::memory_order_acquire) && !worker.retiring.load(std::memory_order_relaxed))
+        {
+            auto item = FindWork(worker);
+            if (!item)
+            {
+                Sleep(worker);
+                continue;
+            }
+
+            // Note: while started is ahead of finished the monitor sees the worker as busy with one item
+            worker.started.store(worker.started.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+            item.Run();
+            worker.finished.store(worker.finished.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+        }
+
+        // The LIFO slot cannot be stolen, a retired worker leaves its item on the deque for the others
+        if (auto item = std::exchange(worker.next, ReadyItem()))
+        {
+            worker.deque.Push(item);
+        }
+
+        if (!worker.deque.Empty())
+        {
+            WakeOne();
+        }
+
+        SetCurrentScheduler(nullptr);
+        currentWorker = nullptr;
+
+        worker.exited.store(true, std::memory_order_release);
+    }
+
+    void ThreadPoolTaskScheduler::MonitorLoop()
+    {
+        auto quota = elasticOptions.RespectCpuQuota ? Detail::CpuQuota() : std::nullopt;
+        auto maxRunning = quota ? static_cast<size_t>(std::ceil(*quota)) : workers.size();
+        auto climbing = Detail::HillClimbing(minWorkers, workers.size(), maxRunning);
+
+        auto lastSample = std::chrono::steady_clock::now();
+        auto lastFinished = std::uint64_t(0);
+
+        std::unique_lock lock(monitorMutex);
+        while (!monitorWake.wait_for(
+            lock, elasticOptions.SampleInterval, [this]() { return stopping.load(std::memory_order_acquire); }))
+        {
+            auto now = std::chrono::steady_clock::now();
+            auto sample = Detail::PoolSample();
+            auto finished = std::uint64_t(0);
+
+            for (auto & worker : workers)
+            {
+                auto workerFinished = worker->finished.load(std::memory_order_relaxed);
+                finished += workerFinished;
+
+                if (!worker->active)
+                {
+                    continue;
+                }
+
+                auto started = worker->started.load(std::memory_order_relaxed);
+                auto busy = started != workerFinished;
+                if (!busy || started != worker->lastStarted)
+                {
+                    worker->lastStarted = started;
+                    worker->progressAt = now;
+                }
+
+                worker->blocked = busy && now - worker->progressAt >= elasticOptions.BlockedThreshold;
+
+                ++sample.Workers;
+                sample.Blocked += worker->blocked ? 1u : 0u;
+            }
+
+            auto elapsed = std::chrono::duration<double>(now - lastSample).count();
+            sample.Throughput = elapsed > 0.0 ? static_cast<double>(finished - lastFinished) / elapsed : 0.0;
+            sample.Backlog = HasWork();
+
+            lastSample = now;
+            lastFinished = finished;
+
+            Resize(climbing.Update(sample));
+        }
+    }
+
+    void ThreadPoolTaskScheduler::Resize(size_t target)
+    {
+        auto active = activeCount.load(std::memory_order_relaxed);
+
+        for (auto i = minWorkers; i < workers.size() && active < target; ++i)
+        {
+            auto & worker = *workers[i];
+
+            // Note: a retired worker still finishing its item keeps its slot until it has exited
+            if (worker.active || (worker.thread.joinable() && !worker.exited.load(std::memory_order_acquire)))
+            {
+                continue;
+            }
+
+            if (worker.thread.joinable())
+            {
+                worker.thread.join();
+            }
+
+            StartWorker(worker);
+            ++active;
+        }
+
+        if (target >= active)
+        {
+            return;
+        }
+
+        // Retire the most recently added stand-in that is making progress, base workers are never retired
+        Worker * victim = nullptr;
+        for (auto i = workers.size(); i-- > minWorkers;)
+        {
+            auto & worker = *workers[i];
+            if (!worker.active)
+            {
+                continue;
+            }
+
+            if (!victim || (victim->blocked && !worker.blocked))
+            {
+                victim = &worker;
+            }
+
+            if (!worker.blocked)
+            {
+                break;
+            }
+        }
+
+        if (victim)
+        {
+            victim->active = false;
+            victim->retiring.store(true, std::memory_order_relaxed);
+            activeCount.fetch_sub(1u, std::memory_order_relaxed);
+
+            // Note: the worker may be parked, every sleeper wakes and the retiring one exits
+            idleEvent.NotifyAll();
+        }
+    }
+
+    ThreadPoolTaskScheduler::ReadyItem ThreadPoolTaskScheduler::FindWork(Worker & worker) noexcept
+    {
+        if (auto item = std::exchange(worker.next, ReadyItem()))
+        {
+            return item;
+        }
+
+        if (auto item = worker.deque.Pop())
+        {
+            return *item;
+        }
+
+        if (auto item = PopInjected())
+        {
+            // Batches only wake one worker, pass the wakeup on while there is more to take
+            if (injectionCount.load(std::memory_order_relaxed) != 0u)
+            {
+                WakeOne();
+            }
+            return item;
+        }
+
+        return Steal(worker);
+    }
+
+    ThreadPoolTaskScheduler::ReadyItem ThreadPoolTaskScheduler::PopInjected() noexcept
+    {
+        if (injectionCount.load(std::memory_order_relaxed) == 0u)
+        {
+            return ReadyItem();
+        }
+
+        if (auto * promise = injectedPromises.Pop())
+        {
+            injectionCount.fetch_sub(1u, std::memory_order_relaxed);
+            return ReadyItem(promise);
+        }
+
+        std::lock_guard lock(injectionMutex);
+        if (injectionQueue.empty())
+        {
+            return ReadyItem();
+        }
+
+        auto * item = injectionQueue.front();
+        injectionQueue.pop_front();
+        injectionCount.fetch_sub(1u, std::memory_order_relaxed);
+
+        return ReadyItem(item);
+    }
+
+    ThreadPoolTaskScheduler::ReadyItem ThreadPoolTaskScheduler::Steal(Worker & worker) noexcept
+    {
+        auto count = slotCount.load(std::memory_order_acquire);
+        if (count < 2u)
+        {
+            return ReadyItem();
+        }
+
+        // Start at a random victim and walk all the others once
+        auto start = worker.NextVictim();
+        for (auto i = 0u; i < count; ++i)
+        {
+            auto & victim = *workers[(start + i) % count];
+            if (&victim == &worker)
+            {
+                continue;
+            }
+
+            if (auto item = victim.deque.Steal())
+            {
+                if (!victim.deque.Empty())
+                {
+                    WakeOne();
+                }
+                return *item;
+            }
+        }
+
+        return ReadyItem();
+    }
+
+    bool ThreadPoolTaskScheduler::HasWork() const noexcept
+    {
+        if (injectionCount.load(std::memory_order_relaxed) != 0u)
+        {
+            return true;
+        }
+
+        auto count = slotCount.load(std::memory_order_acquire);
+        return std::any_of(
+            workers.begin(), workers.begin() + count, [](auto const & worker) { return !worker->deque.Empty(); });
+    }
+
+    void ThreadPoolTaskScheduler::WakeOne() noexcept
+    {
+        // Note: a fence and a load when no worker is idle
+        idleEvent.NotifyOne();
+    }
+
+    void ThreadPoolTaskScheduler::Sleep(Worker & worker) noexcept
+    {
+        auto key = idleEvent.PrepareWait();
+
+        // Either this sees the new item or the producer's notify ends the wait
+        if (HasWork() || stopping.load(std::memory_order_acquire) || worker.retiring.load(std::memory_order_relaxed))
+        {
+            idleEvent.CancelWait();
+            return;
+        }
+
+        idleEvent.Wait(key, idleStrategy.SpinCount, idleStrategy.YieldCount);
+    }
+
+}  // namespace TaskSystem
\ No newline at end of file
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <TaskSystem/Detail/CpuQuota.hpp>
+#include <TaskSystem/Detail/EventCount.hpp>
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/Detail/ReadyItem.hpp>
+#include <TaskSystem/Detail/WorkStealingDeque.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+#include <TaskSystem/IdleStrategy.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+
+namespace TaskSystem
+{
+
+    struct ElasticPoolOptions final
+    {
+        // Upper bound on workers, counting those started to stand in for blocked ones
+        size_t MaxWorkers = 64u;
+
+        // A worker busy with the same item for this long counts as blocked
+        std::chrono::milliseconds BlockedThreshold = std::chrono::milliseconds(500);
+
+        // How often the monitor samples the workers and adjusts their number
+        std::chrono::milliseconds SampleInterval = std::chrono::milliseconds(100);
+
+        // Never runs more workers that are not blocked than the cgroup, or job object, CPU quota allows
+        bool RespectCpuQuota = true;
+    };
+
+    /// <summary>
+    /// Multi-threaded work-stealing scheduler
+    /// </summary>
+    /// <remarks>
+    /// Each worker owns a Chase-Lev deque; items scheduled from a worker are pushed onto its own deque, items scheduled
+    /// from any other thread go onto a shared injection queue. Idle workers drain the injection queue then try to steal
+    /// from randomly chosen victims before going to sleep. Promises are queued through their intrusive hook, other
+    /// items are boxed in memory from the pooled frame allocator. The last item a worker schedules for itself waits in
+    /// its LIFO slot and runs next, while its caches are still hot; the slot cannot be stolen, whatever it displaces
+    /// goes onto the deque. A worker with nothing to do spins, yields and then parks as set by its IdleStrategy.
+    ///
+    /// An elastic pool also runs a monitor thread. A worker that has been on the same item for longer than
+    /// BlockedThreshold, e.g. stuck in a blocking call, is stood in for by an extra worker while work is waiting; the
+    /// extra workers are retired again by Detail::HillClimbing once throughput stops improving. Worker slots for
+    /// MaxWorkers are allocated up front so thieves never see the vector change
+    /// </remarks>
+    class ThreadPoolTaskScheduler final : public ITaskScheduler
+    {
+    private:
+        using ReadyItem = Detail::ReadyItem;
+
+        struct Worker final
+        {
+            ThreadPoolTaskScheduler & scheduler;
+            size_t index;
+            Detail::WorkStealingDeque<ReadyItem> deque;
+
+            // Note: only accessed by the owning worker
+            ReadyItem next;
+            std::uint64_t randomState;
+            std::thread thread;
+
+            // Note: only written by the owning worker, sampled by the monitor
+            std::atomic<std::uint64_t> started;
+            std::atomic<std::uint64_t> finished;
+
+            // Set by the monitor, the worker exits after its current item
+            std::atomic<bool> retiring;
+            std::atomic<bool> exited;
+
+            // Note: only accessed by the monitor
+            bool active;
+            bool blocked;
+            std::uint64_t lastStarted;
+            std::chrono::steady_clock::time_point progressAt;
+
+            Worker(ThreadPoolTaskScheduler & scheduler, size_t index);
+
+            [[nodiscard]] size_t NextVictim() noexcept;
+        };
+
+        static thread_local Worker * currentWorker;
+
+        std::vector<std::unique_ptr<Worker>> workers;
+
+        // Slots that have ever had a thread, thieves only look at these
+        std::atomic<size_t> slotCount;
+        std::atomic<size_t> activeCount;
+        size_t minWorkers;
+
+        Detail::IntrusiveMpmcQueue<Detail::IPromise> injectedPromises;
+        std::mutex injectionMutex;
+        std::deque<Detail::QueuedItem *> injectionQueue;
+        std::atomic<size_t> injectionCount;
+
+        // Note: idle workers spin on the eventcount for as long as the idle strategy allows, then park on it
+        Detail::EventCount idleEvent;
+        IdleStrategy idleStrategy;
+
+        std::atomic<bool> stopping;
+
+        ElasticPoolOptions elasticOptions;
+        std::mutex monitorMutex;
+        std::condition_variable monitorWake;
+        std::thread monitor;
+
+    public:
+        explicit ThreadPoolTaskScheduler(size_t workerCount = Detail::AvailableParallelism(),
+                                         IdleStrategy idleStrategy = IdleStrategy::Balanced());
+
+        /// <summary>
+        /// Elastic pool, runs workerCount workers plus stand-ins for blocked ones up to options.MaxWorkers
+        /// </summary>
+        ThreadPoolTaskScheduler(size_t workerCount, IdleStrategy idleStrategy, ElasticPoolOptions const & options);
+
+        ThreadPoolTaskScheduler(ThreadPoolTaskScheduler const &) = delete;
+        ThreadPoolTaskScheduler & operator=(ThreadPoolTaskScheduler const &) = delete;
+
+        ThreadPoolTaskScheduler(ThreadPoolTaskScheduler &&) = delete;
+        ThreadPoolTaskScheduler & operator=(ThreadPoolTaskScheduler &&) = delete;
+
+        ~ThreadPoolTaskScheduler() noexcept override;
+
+        // Workers currently running, changes over time in an elastic pool
+        [[nodiscard]] size_t WorkerCount() const noexcept { return activeCount.load(std::memory_order_relaxed); }
+
+        bool IsWorkerThread() const noexcept override;
+
+        void Schedule(ScheduleItem && item) override;
+
+        // If queuing an item throws, the items before it have been scheduled
+        void ScheduleBatch(std::span<ScheduleItem> items) override;
+
+        void ScheduleBatch(Detail::IntrusiveList<Detail::IPromise> && promises) override;
+
+        // Goes through the injection queue, behind everything already waiting, rather than the worker's own deque
+        void Requeue(ScheduleItem && item) override;
+
+        /// <summary>
+        /// Stops and joins all workers, items that have not started are discarded
+        /// </summary>
+        /// <remarks>
+        /// Promises still queued are faulted with SchedulerStopped so their awaiters resume rather than hang. Calling
+        /// it again faults the promises scheduled since
+        /// </remarks>
+        void Stop() noexcept;
+
+    private:
+        ThreadPoolTaskScheduler(size_t workerCount,
+                                IdleStrategy idleStrategy,
+                                size_t slots,
+                                ElasticPoolOptions const & options);
+
+        void Inject(ScheduleItem && item);
+
+        void StartWorker(Worker & worker);
+        void WorkerLoop(Worker & worker);
+
+        // Joins the monitor and every worker, then faults the promises left on their deques
+        void StopWorkers() noexcept;
+
+        void MonitorLoop();
+        void Resize(size_t target);
+
+        [[nodiscard]] ReadyItem FindWork(Worker & worker) noexcept;
+        [[nodiscard]] ReadyItem PopInjected() noexcept;
+        [[nodiscard]] ReadyItem Steal(Worker & worker) noexcept;
+        [[nodiscard]] bool HasWork() const noexcept;
+
+        void WakeOne() noexcept;
+        void Sleep(Worker & worker) noexcept;
+    };
+
+}  // namespace TaskSystem
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/Utils.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+#include <TaskSystem/ScheduleItem.hpp>
+#include <TaskSystem/TimeSlice.hpp>
+
+#include <cassert>
+
+
+namespace TaskSystem
+{
+    namespace
+    {
+        // Note: preemptions are rare, a shared counter costs nothing on the paths that don't preempt
+        std::atomic<std::size_t> preemptions = 0u;
+
+        thread_local std::size_t threadPreemptions = 0u;
+
+    }  // namespace
+
+    void TimeSlice::Budget(clock_type::duration value) noexcept
+    {
+        Detail::timeSliceBudget.store(value.count(), std::memory_order_relaxed);
+    }
+
+    TimeSlice::clock_type::duration TimeSlice::Budget() noexcept
+    {
+        return clock_type::duration(Detail::timeSliceBudget.load(std::memory_order_relaxed));
+    }
+
+    std::size_t TimeSlice::ThreadPreemptions() noexcept { return threadPreemptions; }
+
+    std::size_t TimeSlice::Preemptions() noexcept { return preemptions.load(std::memory_order_relaxed); }
+
+    namespace Detail
+    {
+
+        void Preempt(IPromise & promise) noexcept
+        {
+            auto * scheduler = FirstOf(CurrentScheduler(), DefaultScheduler());
+            assert(scheduler);
+
+            if (!promise.TrySetScheduled())
+            {
+                return;
+            }
+
+            ++threadPreemptions;
+            preemptions.fetch_add(1u, std::memory_order_relaxed);
+
+            scheduler->Requeue(ScheduleItem(promise));
+        }
+
+    }  // namespace Detail
+
+}  // namespace TaskSystem
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+
+namespace TaskSystem
+{
+    namespace Detail
+    {
+        class IPromise;
+    }
+
+    /// <summary>
+    /// Cooperative time-slice budget for the items a worker runs
+    /// </summary>
+    /// <remarks>
+    /// Every item a scheduler runs starts a slice on its worker thread, items run inline from it, e.g. synchronous
+    /// continuations, share the slice. Once a slice has lasted longer than Budget, a task that co_awaits another task
+    /// re-queues whichever of the two would have run next on this thread instead of transferring to it, so a long
+    /// chain of awaits that never really suspends gives other queued work a turn. Off until a budget is set
+    /// </remarks>
+    class TimeSlice final
+    {
+    public:
+        using clock_type = std::chrono::steady_clock;
+
+        // Zero turns the budget off
+        static void Budget(clock_type::duration value) noexcept;
+
+        [[nodiscard]] static clock_type::duration Budget() noexcept;
+
+        // Times the budget forced a task to re-queue on the calling thread
+        [[nodiscard]] static std::size_t ThreadPreemptions() noexcept;
+
+        // Times the budget forced a task to re-queue, over all threads
+        [[nodiscard]] static std::size_t Preemptions() noexcept;
+    };
+
+    namespace Detail
+    {
+
+        // Note: in ticks of the clock so the check is one relaxed load while the budget is off
+        inline std::atomic<TimeSlice::clock_type::rep> timeSliceBudget = 0;
+
+        // Note: start of the slice running on this thread, zero while no slice is running
+        inline thread_local TimeSlice::clock_type::time_point timeSliceStart{};
+
+        /// <summary>
+        /// True once the slice running on this thread has used up the budget
+        /// </summary>
+        [[nodiscard]] inline bool TimeSliceExhausted() noexcept
+        {
+            auto budget = timeSliceBudget.load(std::memory_order_relaxed);
+            if (budget == 0 || timeSliceStart == TimeSlice::clock_type::time_point())
+            {
+                return false;
+            }
+
+            return TimeSlice::clock_type::now() - timeSliceStart >= TimeSlice::clock_type::duration(budget);
+        }
+
+        /// <summary>
+        /// Schedules promise behind the work queued on the current scheduler and counts the preemption
+        /// </summary>
+        /// <remarks>
+        /// The promise must be Created or Suspended, it can be resumed on another thread before this returns
+        /// </remarks>
+        void Preempt(IPromise & promise) noexcept;
+
+        /// <summary>
+        /// Starts a slice on this thread unless one is already running, the slice ends when the outermost scope does
+        /// </summary>
+        class TimeSliceScope final
+        {
+        private:
+            bool owner;
+
+        public:
+            TimeSliceScope() noexcept
+              : owner(timeSliceBudget.load(std::memory_order_relaxed) != 0
+                      && timeSliceStart == TimeSlice::clock_type::time_point())
+            {
+                if (owner)
+                {
+                    timeSliceStart = TimeSlice::clock_type::now();
+                }
+            }
+
+            TimeSliceScope(TimeSliceScope const &) = delete;
+            TimeSliceScope & operator=(TimeSliceScope const &) = delete;
+
+            TimeSliceScope(TimeSliceScope &&) = delete;
+            TimeSliceScope & operator=(TimeSliceScope &&) = delete;
+
+            ~TimeSliceScope() noexcept
+            {
+                if (owner)
+                {
+                    timeSliceStart = TimeSlice::clock_type::time_point();
+                }
+            }
+        };
+
+    }  // namespace Detail
+
+}  // namespace TaskSystem
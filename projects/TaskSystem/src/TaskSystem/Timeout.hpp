@@ -0,0 +1,278 @@
+#pragma once
+
+#include <TaskSystem/Deadline.hpp>
+#include <TaskSystem/Detail/Continuation.hpp>
+#include <TaskSystem/Detail/Continuations.hpp>
+#include <TaskSystem/Detail/IPromise.hpp>
+#include <TaskSystem/Detail/Promise.hpp>
+#include <TaskSystem/Detail/Timer.hpp>
+#include <TaskSystem/Detail/Utils.hpp>
+#include <TaskSystem/ITaskScheduler.hpp>
+#include <TaskSystem/ScheduleItem.hpp>
+#include <TaskSystem/TaskState.hpp>
+#include <TaskSystem/TimerService.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+
+
+namespace TaskSystem
+{
+
+    /// <summary>
+    /// Thrown by co_await Timeout when the task does not complete in time
+    /// </summary>
+    class TimeoutExceeded final : public std::exception
+    {
+    public:
+        [[nodiscard]] char const * what() const noexcept override { return "Timeout exceeded"; }
+    };
+
+    namespace Detail
+    {
+
+        struct TimeoutPromisePolicy final
+        {
+            static inline constexpr bool CanSchedule = true;
+            static inline constexpr bool CanRun = true;
+            static inline constexpr bool CanSuspend = true;
+            static inline constexpr bool AllowSuspendFromCreated = true;
+        };
+
+        /// <summary>
+        /// Races a task against a timer, whichever finishes first schedules the caller
+        /// </summary>
+        /// <remarks>
+        /// Added to the task as a continuation so the task's completion is seen through TrySetScheduled, like
+        /// WhenAnyPromise. Allocated once per co_await since the task and the timer can both outlive the caller's
+        /// frame; held by the awaitable, the task's continuation and the timer, the last to let go deletes it
+        /// </remarks>
+        class TimeoutRace final : public Promise<void, TimeoutPromisePolicy>, private Timer
+        {
+        private:
+            enum class Outcome : std::uint8_t
+            {
+                Pending,
+                Completed,
+                TimedOut
+            };
+
+            TimerService & service;
+            IPromise & caller;
+            ITaskScheduler * scheduler;
+
+            std::atomic<Outcome> outcome;
+            std::atomic<std::uint32_t> references;
+
+            ContinuationNode continuation;
+
+        public:
+            TimeoutRace(TimerService & service, IPromise & caller, ITaskScheduler * scheduler) noexcept
+              : service(service)
+              , caller(caller)
+              , scheduler(scheduler)
+              , outcome(Outcome::Pending)
+              , references(3u)
+              , continuation(Continuation(*this))
+            {
+                assert(scheduler);
+            }
+
+            [[nodiscard]] std::coroutine_handle<> Handle() noexcept override { return std::noop_coroutine(); }
+
+            [[nodiscard]] ContinuationNode & TaskContinuation() noexcept { return continuation; }
+
+            [[nodiscard]] bool TimedOut() const noexcept
+            {
+                return outcome.load(std::memory_order_acquire) == Outcome::TimedOut;
+            }
+
+            // Called by the task's continuations when it completes, nothing is scheduled
+            [[nodiscard]] SetScheduledResult TrySetScheduled() noexcept override
+            {
+                OnTaskCompleted();
+                return SetScheduledError::CannotSchedule;
+            }
+
+            void Arm(DeadlineClock::time_point expiry) noexcept { service.Arm(*this, expiry); }
+
+            // The task completed before the continuation was added, the timer is never armed
+            void Completed() noexcept
+            {
+                outcome.store(Outcome::Completed, std::memory_order_release);
+                Release(2u);
+            }
+
+            void Release(std::uint32_t count = 1u) noexcept
+            {
+                if (references.fetch_sub(count, std::memory_order_acq_rel) == count)
+                {
+                    delete this;
+                }
+            }
+
+        private:
+            [[nodiscard]] bool TryDecide(Outcome value) noexcept
+            {
+                auto expected = Outcome::Pending;
+                return outcome.compare_exchange_strong(expected, value, std::memory_order_acq_rel);
+            }
+
+            void ResumeCaller() noexcept
+            {
+                if (caller.TrySetScheduled())
+                {
+                    scheduler->Schedule(ScheduleItem(caller));
+                }
+            }
+
+            void OnTaskCompleted() noexcept
+            {
+                if (TryDecide(Outcome::Completed))
+                {
+                    // Note: the timer holds its reference until the service drops it, at the latest when it expires
+                    [[maybe_unused]] auto _ = service.Cancel(*this);
+                    ResumeCaller();
+                }
+
+                Release();
+            }
+
+            void OnExpired() noexcept override
+            {
+                if (TryDecide(Outcome::TimedOut))
+                {
+                    ResumeCaller();
+                }
+
+                Release();
+            }
+
+            void OnCancelled() noexcept override { Release(); }
+        };
+
+        /// <summary>
+        /// Resumes the caller with the task's result, or throws TimeoutExceeded if the timer fires first
+        /// </summary>
+        /// <remarks>
+        /// The task is not stopped by a timeout, it keeps running and must outlive it
+        /// </remarks>
+        template <typename TTask>
+        class TimeoutAwaitable final
+        {
+        public:
+            using value_type = typename TTask::value_type;
+
+        private:
+            TTask & task;
+            TimerService & service;
+            DeadlineClock::time_point expiry;
+
+            TimeoutRace * race = nullptr;
+
+        public:
+            TimeoutAwaitable(TTask & task, TimerService & service, DeadlineClock::time_point expiry) noexcept
+              : task(task), service(service), expiry(expiry)
+            { }
+
+            TimeoutAwaitable(TimeoutAwaitable const &) = delete;
+            TimeoutAwaitable & operator=(TimeoutAwaitable const &) = delete;
+
+            TimeoutAwaitable(TimeoutAwaitable &&) = delete;
+            TimeoutAwaitable & operator=(TimeoutAwaitable &&) = delete;
+
+            ~TimeoutAwaitable() noexcept
+            {
+                if (race)
+                {
+                    race->Release();
+                }
+            }
+
+            [[nodiscard]] bool await_ready() const noexcept { return task.State().IsCompleted(); }
+
+            // ToDo: use PromiseType concept
+            template <typename TPromise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> callerHandle)
+            {
+                IPromise & callerPromise = callerHandle.promise();
+                return await_suspend(callerHandle, callerPromise);
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> callerHandle, IPromise & callerPromise)
+            {
+                if (!callerPromise.TrySetSuspended())
+                {
+                    throw std::exception("Unable to set caller promise to suspended");
+                }
+
+                race = new TimeoutRace(service, callerPromise, FirstOf(CurrentScheduler(), DefaultScheduler()));
+
+                if (!task.ContinueWith(race->TaskContinuation()))
+                {
+                    // Completed after the check above, nothing will schedule the caller so resume it inline
+                    race->Completed();
+                    [[maybe_unused]] auto _ = callerPromise.TrySetRunning();
+                    return callerHandle;
+                }
+
+                if constexpr (TTask::CanSchedule)
+                {
+                    if (task.State() == TaskState::Created)
+                    {
+                        auto * scheduler = FirstOf(task.TaskScheduler(), CurrentScheduler(), DefaultScheduler());
+
+                        // Note: TrySetScheduled is called when cast to ScheduleItem
+                        scheduler->Schedule(task);
+                    }
+                }
+
+                // Note: the race can be decided, and the caller resumed, before Arm returns
+                race->Arm(expiry);
+                return std::noop_coroutine();
+            }
+
+            decltype(auto) await_resume()
+            {
+                if (race && race->TimedOut())
+                {
+                    throw TimeoutExceeded();
+                }
+
+                if constexpr (std::is_void_v<value_type>)
+                {
+                    task.ThrowIfFaulted();
+                }
+                else
+                {
+                    return task.Result();
+                }
+            }
+        };
+
+    }  // namespace Detail
+
+    /// <summary>
+    /// co_await for the task's result, throws TimeoutExceeded if it does not complete within timeout
+    /// </summary>
+    /// <remarks>
+    /// Schedules the task if it has not been. A task that times out keeps running, the caller still owns it
+    /// </remarks>
+    template <typename TTask>
+    [[nodiscard]] Detail::TimeoutAwaitable<TTask> Timeout(
+        TTask & task, DeadlineClock::duration timeout, TimerService & service)
+    {
+        return Detail::TimeoutAwaitable<TTask>(task, service, service.Now() + timeout);
+    }
+
+    template <typename TTask>
+    [[nodiscard]] Detail::TimeoutAwaitable<TTask> Timeout(TTask & task, DeadlineClock::duration timeout)
+    {
+        return Timeout(task, timeout, DefaultTimerService());
+    }
+
+}  // namespace TaskSystem
@@ -0,0 +1,305 @@
+#include <TaskSystem/TimerService.hpp>
+
+#include <TaskSystem/AtomicLockGuard.hpp>
+
+#include <algorithm>
+
+
+namespace TaskSystem
+{
+
+    namespace
+    {
+        // Keeps rounding up to the slack from overflowing for expiries that never come
+        constexpr auto MaxTick = Detail::TimingWheel::NoExpiry / 2u;
+
+        // Longest the dedicated thread sleeps for in one go
+        constexpr auto MaxSleep = std::chrono::hours(1);
+
+    }  // namespace
+
+    TimerService::TimerService(TimerOptions options)
+      : options(options)
+      , clock(options.Clock ? *options.Clock : DefaultClock())
+      , slackTicks(1u)
+      , epoch(clock.Now())
+      , armed()
+      , cancelled()
+      , polling()
+      , wheel()
+      , sleepingUntil(0u)
+      , sleepMutex()
+      , sleepCondition()
+      , stopping(false)
+      , thread()
+    {
+        if (this->options.Resolution <= std::chrono::nanoseconds(0))
+        {
+            this->options.Resolution = std::chrono::nanoseconds(1);
+        }
+
+        auto resolution = this->options.Resolution;
+        if (this->options.Slack > resolution)
+        {
+            slackTicks = static_cast<std::uint64_t>(
+                (this->options.Slack + resolution - std::chrono::nanoseconds(1)) / resolution);
+        }
+
+        if (this->options.DedicatedThread)
+        {
+            thread = std::thread([this]() { Run(); });
+        }
+    }
+
+    TimerService::~TimerService() noexcept { Stop(); }
+
+    void TimerService::Arm(Detail::Timer & timer, DeadlineClock::time_point expiry) noexcept
+    {
+        auto tick = ExpiryTick(expiry);
+
+        timer.Expiry = tick;
+        armed.Push(timer.armHook);
+
+        WakeBefore(tick);
+    }
+
+    bool TimerService::Cancel(Detail::Timer & timer) noexcept
+    {
+        auto expected = Timer::TimerState::Armed;
+        if (!timer.state.compare_exchange_strong(expected, Timer::TimerState::Cancelled, std::memory_order_acq_rel))
+        {
+            return false;
+        }
+
+        // Note: dropped, and OnCancelled called, the next time the service polls
+        cancelled.Push(timer.cancelHook);
+        return true;
+    }
+
+    size_t TimerService::Poll() noexcept
+    {
+        if (polling.test_and_set(std::memory_order_acquire))
+        {
+            return 0u;
+        }
+
+        std::lock_guard lock(polling, std::adopt_lock);
+        return Drive();
+    }
+
+    DeadlineClock::time_point TimerService::NextExpiry() noexcept
+    {
+        if (polling.test_and_set(std::memory_order_acquire))
+        {
+            return NoDeadline;
+        }
+
+        std::lock_guard lock(polling, std::adopt_lock);
+
+        ReceiveArmed();
+        ReceiveCancelled();
+
+        // Note: expiries clamped to MaxTick, and any beyond the range of the clock, are treated as never
+        auto next = wheel.NextTick();
+        if (next >= MaxTick || next >= static_cast<std::uint64_t>((NoDeadline - epoch) / options.Resolution))
+        {
+            return NoDeadline;
+        }
+
+        return epoch + options.Resolution * static_cast<std::int64_t>(next);
+    }
+
+    void TimerService::Stop() noexcept
+    {
+        if (stopping.exchange(true, std::memory_order_acq_rel))
+        {
+            return;
+        }
+
+        if (thread.joinable())
+        {
+            {
+                std::lock_guard lock(sleepMutex);
+                sleepCondition.notify_all();
+            }
+
+            thread.join();
+        }
+    }
+
+    std::uint64_t TimerService::ExpiryTick(DeadlineClock::time_point expiry) const noexcept
+    {
+        if (expiry <= epoch)
+        {
+            return 0u;
+        }
+
+        // Note: rounded up, a timer never fires before its expiry
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(expiry - epoch);
+        auto tick = static_cast<std::uint64_t>(elapsed / options.Resolution)
+                  + (elapsed % options.Resolution != std::chrono::nanoseconds(0) ? 1u : 0u);
+
+        tick = std::min(tick, MaxTick);
+        return (tick + slackTicks - 1u) / slackTicks * slackTicks;
+    }
+
+    std::uint64_t TimerService::CurrentTick() const noexcept
+    {
+        auto now = clock.Now();
+        if (now <= epoch)
+        {
+            return 0u;
+        }
+
+        return static_cast<std::uint64_t>((now - epoch) / options.Resolution);
+    }
+
+    size_t TimerService::Drive() noexcept
+    {
+        ReceiveArmed();
+        ReceiveCancelled();
+
+        auto fired = size_t(0u);
+        wheel.Advance(CurrentTick(), [&](Detail::TimerNode & node) {
+            auto & timer = static_cast<Timer &>(node);
+            timer.placement = Timer::Placement::Removed;
+
+            // Note: a timer cancelled while in the wheel is dropped when its cancellation is received
+            auto expected = Timer::TimerState::Armed;
+            if (timer.state.compare_exchange_strong(expected, Timer::TimerState::Expired, std::memory_order_acq_rel))
+            {
+                ++fired;
+                timer.OnExpired();
+            }
+        });
+
+        return fired;
+    }
+
+    void TimerService::ReceiveArmed() noexcept
+    {
+        while (auto * hook = armed.Pop())
+        {
+            auto & timer = *hook->Owner;
+
+            if (timer.cancelReceived)
+            {
+                timer.placement = Timer::Placement::Removed;
+                timer.OnCancelled();
+            }
+            else if (timer.state.load(std::memory_order_acquire) == Timer::TimerState::Cancelled)
+            {
+                // The cancellation is still in its inbox, it drops the timer when it is received
+                timer.placement = Timer::Placement::Removed;
+            }
+            else
+            {
+                timer.placement = Timer::Placement::Wheel;
+                wheel.Insert(timer);
+            }
+        }
+    }
+
+    void TimerService::ReceiveCancelled() noexcept
+    {
+        while (auto * hook = cancelled.Pop())
+        {
+            auto & timer = *hook->Owner;
+
+            switch (timer.placement)
+            {
+            case Timer::Placement::Inbox:
+                // Cancelled before the arm was received, it drops the timer when it is
+                timer.cancelReceived = true;
+                break;
+
+            case Timer::Placement::Wheel:
+                wheel.Remove(timer);
+                timer.placement = Timer::Placement::Removed;
+                timer.OnCancelled();
+                break;
+
+            case Timer::Placement::Removed:
+                timer.OnCancelled();
+                break;
+            }
+        }
+    }
+
+    void TimerService::Run() noexcept
+    {
+        while (!stopping.load(std::memory_order_acquire))
+        {
+            auto next = Detail::TimingWheel::NoExpiry;
+            auto current = std::uint64_t(0u);
+            {
+                std::lock_guard lock(polling);
+                Drive();
+
+                next = wheel.NextTick();
+                current = CurrentTick();
+                if (next <= current)
+                {
+                    continue;
+                }
+
+                // Note: published before checking the inbox, an Arm either sees the tick and wakes this thread or
+                // its timer is seen here
+                sleepingUntil.store(next, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (!armed.Empty())
+                {
+                    sleepingUntil.store(0u, std::memory_order_relaxed);
+                    continue;
+                }
+            }
+
+            auto woken = [this]() {
+                return sleepingUntil.load(std::memory_order_relaxed) == 0u || stopping.load(std::memory_order_relaxed);
+            };
+
+            std::unique_lock lock(sleepMutex);
+            if (next == Detail::TimingWheel::NoExpiry)
+            {
+                sleepCondition.wait(lock, woken);
+            }
+            else
+            {
+                // Note: relative to the service's clock rather than DeadlineClock, capped so far off expiries do not
+                // overflow it
+                auto ticks = std::min(next - current, static_cast<std::uint64_t>(MaxSleep / options.Resolution) + 1u);
+                auto remaining = epoch + options.Resolution * static_cast<std::int64_t>(current + ticks) - clock.Now();
+                sleepCondition.wait_for(lock, remaining, woken);
+            }
+
+            sleepingUntil.store(0u, std::memory_order_relaxed);
+        }
+    }
+
+    void TimerService::WakeBefore(std::uint64_t tick) noexcept
+    {
+        if (!options.DedicatedThread)
+        {
+            return;
+        }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (tick >= sleepingUntil.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        std::lock_guard lock(sleepMutex);
+        sleepingUntil.store(0u, std::memory_order_relaxed);
+        sleepCondition.notify_one();
+    }
+
+    TimerService & DefaultTimerService()
+    {
+        // Note: started on first use
+        static TimerService service;
+        return service;
+    }
+
+}  // namespace TaskSystem
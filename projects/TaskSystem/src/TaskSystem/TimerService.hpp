@@ -0,0 +1,141 @@
+#pragma once
+
+#include <TaskSystem/Deadline.hpp>
+#include <TaskSystem/Detail/IntrusiveQueue.hpp>
+#include <TaskSystem/Detail/Timer.hpp>
+#include <TaskSystem/Detail/TimingWheel.hpp>
+#include <TaskSystem/IClock.hpp>
+#include <TaskSystem/IPoller.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+
+namespace TaskSystem
+{
+
+    struct TimerOptions final
+    {
+        // Length of a wheel tick, timers never fire early but can fire up to a tick late
+        std::chrono::nanoseconds Resolution = std::chrono::milliseconds(1);
+
+        // Expiries are rounded up to a multiple of the slack so timers close together fire in one wakeup
+        std::chrono::nanoseconds Slack = std::chrono::nanoseconds(0);
+
+        // Runs a thread that sleeps until the next expiry, otherwise timers only fire when Poll is called, e.g. by a
+        // PollingTaskScheduler the service was added to
+        bool DedicatedThread = true;
+
+        // Source of the current time, DefaultClock when null. A virtual clock such as ManualClock does not wake the
+        // dedicated thread when it is advanced, services on one are polled instead
+        IClock * Clock = nullptr;
+    };
+
+    /// <summary>
+    /// Fires timers from a hierarchical timing wheel, driven by its own thread or by whoever calls Poll
+    /// </summary>
+    /// <remarks>
+    /// Timers are armed and cancelled from any thread through lock-free inboxes; the wheel itself is only touched by
+    /// the driving thread, which picks up the inboxes each time it polls. The dedicated thread sleeps until the next
+    /// expiry and is only woken when a timer is armed that expires before then
+    /// </remarks>
+    class TimerService final : public IPoller
+    {
+    private:
+        using Timer = Detail::Timer;
+
+        TimerOptions options;
+        IClock & clock;
+        std::uint64_t slackTicks;
+        DeadlineClock::time_point epoch;
+
+        Detail::IntrusiveMpscQueue<Detail::TimerHook> armed;
+        Detail::IntrusiveMpscQueue<Detail::TimerHook> cancelled;
+
+        // Note: Poll is a try-lock, the inboxes and the wheel have a single consumer
+        std::atomic_flag polling;
+        Detail::TimingWheel wheel;
+
+        // Tick the dedicated thread is sleeping until, zero while it is awake
+        std::atomic<std::uint64_t> sleepingUntil;
+        std::mutex sleepMutex;
+        std::condition_variable sleepCondition;
+
+        std::atomic<bool> stopping;
+        std::thread thread;
+
+    public:
+        explicit TimerService(TimerOptions options = TimerOptions());
+
+        TimerService(TimerService const &) = delete;
+        TimerService & operator=(TimerService const &) = delete;
+
+        TimerService(TimerService &&) = delete;
+        TimerService & operator=(TimerService &&) = delete;
+
+        // Timers that have not fired are dropped without calling them
+        ~TimerService() noexcept override;
+
+        [[nodiscard]] TimerOptions const & Options() const noexcept { return options; }
+
+        [[nodiscard]] IClock & Clock() const noexcept { return clock; }
+
+        // Current time on the service's clock, expiries are measured against it
+        [[nodiscard]] DeadlineClock::time_point Now() const noexcept { return clock.Now(); }
+
+        /// <summary>
+        /// Fires the timer at or after expiry, can be called from any thread. A timer can only be armed once
+        /// </summary>
+        void Arm(Detail::Timer & timer, DeadlineClock::time_point expiry) noexcept;
+
+        /// <summary>
+        /// Stops an armed timer from firing, can be called from any thread. Returns false if the timer has already
+        /// expired; otherwise the service calls OnCancelled once it has dropped the timer
+        /// </summary>
+        bool Cancel(Detail::Timer & timer) noexcept;
+
+        /// <summary>
+        /// Fires the timers that have expired, returns the number fired. Returns straight away if another thread is
+        /// polling
+        /// </summary>
+        size_t Poll() noexcept override;
+
+        /// <summary>
+        /// Earliest time at which a timer might fire, NoDeadline when none are armed
+        /// </summary>
+        /// <remarks>
+        /// A lower bound, polling at that time can fire nothing. Picks up the inboxes like Poll, and returns NoDeadline
+        /// straight away if another thread is polling
+        /// </remarks>
+        [[nodiscard]] DeadlineClock::time_point NextExpiry() noexcept;
+
+        /// <summary>
+        /// Stops the dedicated thread, can be called from any thread
+        /// </summary>
+        void Stop() noexcept;
+
+    private:
+        [[nodiscard]] std::uint64_t ExpiryTick(DeadlineClock::time_point expiry) const noexcept;
+        [[nodiscard]] std::uint64_t CurrentTick() const noexcept;
+
+        // Receives the inboxes and fires expired timers, the caller holds polling
+        size_t Drive() noexcept;
+
+        void ReceiveArmed() noexcept;
+        void ReceiveCancelled() noexcept;
+
+        void Run() noexcept;
+
+        void WakeBefore(std::uint64_t tick) noexcept;
+    };
+
+    /// <summary>
+    /// Service used by Delay and Timeout when none is given, created with a dedicated thread on first use
+    /// </summary>
+    [[nodiscard]] TimerService & DefaultTimerService();
+
+}  // namespace TaskSystem
@@ -54,6 +54,8 @@ namespace TaskSystem
             constexpr void await_resume() const noexcept { }
         };
 
+        static_assert(AwaitableFitsInline<ValueTaskAwaitable<int>>, "co_await through ITask must not allocate");
+
     }  // namespace Detail
 
     template <typename TResult>
@@ -1,12 +1,15 @@
 #pragma once
 
 #include <TaskSystem/Detail/Promise.hpp>
+#include <TaskSystem/Detail/PromiseBatches.hpp>
 #include <TaskSystem/ValueTask.hpp>
 
+#include <array>
 #include <atomic>
 #include <cassert>
 #include <coroutine>
 #include <memory>
+#include <utility>
 
 
 namespace TaskSystem
@@ -34,24 +37,17 @@ namespace TaskSystem
 
             [[nodiscard]] SetScheduledResult TrySetScheduled() noexcept override
             {
-                std::lock_guard lock(stateFlag);
+                auto current = state.load(std::memory_order_acquire);
 
-                if (!StateIsOneOf<Created, Suspended>())
+                if (!StateIsOneOf<TaskState::Created, TaskState::Suspended>(current))
                 {
-                    if (StateIsOneOf<Running>())
+                    switch (EffectiveState(current))
                     {
-                        return SetScheduledError::PromiseRunning;
+                    case TaskState::Running: return SetScheduledError::PromiseRunning;
+                    case TaskState::Completed: return SetScheduledError::PromiseCompleted;
+                    case TaskState::Error: return SetScheduledError::PromiseFaulted;
+                    default: return SetScheduledError::AlreadyScheduled;
                     }
-                    else if (StateIsOneOf<Completed<void>>())
-                    {
-                        return SetScheduledError::PromiseCompleted;
-                    }
-                    else if (StateIsOneOf<Faulted>())
-                    {
-                        return SetScheduledError::PromiseFaulted;
-                    }
-
-                    return SetScheduledError::AlreadyScheduled;
                 }
 
                 // ToDo: add OnSetScheduled() to Promise
@@ -67,17 +63,30 @@ namespace TaskSystem
                     return SetScheduledError::CannotSchedule;
                 }
 
-                state = Completed<>{};
+                this->EmplaceResult<Completed<>>();
+                state.store(TaskState::Completed, std::memory_order_release);
+                state.notify_all();
                 return SetScheduledError::PromiseCompleted;
             }
         };
 
         using WhenAllPromisePtr = std::shared_ptr<WhenAllPromise>;
 
+        // Allocated once per WhenAll, each child adds its node so completing into the promise does not allocate
+        template <size_t Count>
+        struct WhenAllState final
+        {
+            WhenAllPromise promise;
+            std::array<ContinuationNode, Count> children;
+
+            WhenAllState() noexcept : promise(Count) { }
+        };
+
         class WhenAllAwaitable
         {
         private:
             WhenAllPromisePtr promise;
+            ContinuationNode continuation;
 
         public:
             WhenAllAwaitable(WhenAllPromisePtr promise) noexcept : promise(std::move(promise))
@@ -110,13 +119,17 @@ namespace TaskSystem
                 // Capture the current scheduler to ensure the caller is resumed with a scheduler
                 promise->ContinuationScheduler(CurrentScheduler());
 
-                if (!promise->TryAddContinuation(callerPromise))
+                // Note: set before adding the continuation, once added the caller can be resumed and this destroyed
+                [[maybe_unused]] auto _ = promise->TrySetSuspended();
+
+                continuation = ContinuationNode(Continuation(callerPromise));
+                if (!promise->TryAddContinuation(continuation))
                 {
-                    assert(false);
+                    // Completed after the check above, nothing will schedule the caller so resume it inline
+                    [[maybe_unused]] auto _ = callerPromise.TrySetRunning();
+                    return callerHandle;
                 }
 
-                [[maybe_unused]] auto _ = promise->TrySetSuspended();
-
                 return std::noop_coroutine();
             }
 
@@ -125,7 +138,10 @@ namespace TaskSystem
 
         // Returns 1 if the schedulable is already complete; otherwise 0
         template <typename TSchedulable>  // Maybe: Should be a schedulable with concept
-        size_t WhenAllForEach(WhenAllPromisePtr & promise, TSchedulable & schedulable)
+        size_t WhenAllForEach(WhenAllPromisePtr & promise,
+                              PromiseBatches & batches,
+                              ContinuationNode & node,
+                              TSchedulable & schedulable)
         {
             if constexpr (IsValueTask<TSchedulable>)
             {
@@ -133,7 +149,8 @@ namespace TaskSystem
             }
             else
             {
-                auto result = schedulable.ContinueWith(Continuation(*promise, CurrentScheduler()));
+                node = ContinuationNode(Continuation(*promise, CurrentScheduler()));
+                auto result = schedulable.ContinueWith(node);
 
                 if (!result)
                 {
@@ -149,13 +166,23 @@ namespace TaskSystem
                     {
                         if (schedulable.State() == TaskState::Created)
                         {
+                            // Children without a scheduler of their own fan out across the default thread pool
+                            // rather than queue behind the caller on whichever scheduler it happens to run on
                             auto * scheduler
                                 = FirstOf(schedulable.TaskScheduler(), DefaultScheduler(), CurrentScheduler());
 
                             assert(scheduler);
 
                             // Note: TrySetScheduled is called when cast to ScheduleItem
-                            scheduler->Schedule(schedulable);
+                            ScheduleItem item = schedulable;
+                            if (auto * childPromise = item.Promise())
+                            {
+                                batches.Add(*scheduler, *childPromise);
+                            }
+                            else
+                            {
+                                scheduler->Schedule(std::move(item));
+                            }
                         }
                     }
 
@@ -170,9 +197,16 @@ namespace TaskSystem
     template <typename... TSchedulables>
     Detail::WhenAllAwaitable WhenAll(TSchedulables &&... schedulables)
     {
-        auto promise = std::make_shared<Detail::WhenAllPromise>(sizeof...(TSchedulables));
+        auto state = std::make_shared<Detail::WhenAllState<sizeof...(TSchedulables)>>();
+        auto promise = Detail::WhenAllPromisePtr(state, &state->promise);
+
+        // Note: children are scheduled together once they have all been visited
+        auto batches = Detail::PromiseBatches();
+        auto * child = state->children.data();
+        auto alreadyCompleted = size_t(0);
+        ((alreadyCompleted += Detail::WhenAllForEach(promise, batches, *child++, schedulables)), ...);
+        batches.Flush();
 
-        auto alreadyCompleted = (Detail::WhenAllForEach(promise, schedulables) + ...);
         promise->DecrementCount(alreadyCompleted);
 
         return Detail::WhenAllAwaitable(std::move(promise));
@@ -3,6 +3,7 @@
 #include <TaskSystem/Detail/Promise.hpp>
 #include <TaskSystem/ValueTask.hpp>
 
+#include <array>
 #include <atomic>
 #include <cassert>
 #include <coroutine>
@@ -38,24 +39,17 @@ namespace TaskSystem
 
             [[nodiscard]] SetScheduledResult TrySetScheduled() noexcept override
             {
-                std::lock_guard lock(stateFlag);
+                auto current = state.load(std::memory_order_acquire);
 
-                if (!StateIsOneOf<Created, Suspended>())
+                if (!StateIsOneOf<TaskState::Created, TaskState::Suspended>(current))
                 {
-                    if (StateIsOneOf<Running>())
+                    switch (EffectiveState(current))
                     {
-                        return SetScheduledError::PromiseRunning;
+                    case TaskState::Running: return SetScheduledError::PromiseRunning;
+                    case TaskState::Completed: return SetScheduledError::PromiseCompleted;
+                    case TaskState::Error: return SetScheduledError::PromiseFaulted;
+                    default: return SetScheduledError::AlreadyScheduled;
                     }
-                    else if (StateIsOneOf<Completed<void>>())
-                    {
-                        return SetScheduledError::PromiseCompleted;
-                    }
-                    else if (StateIsOneOf<Faulted>())
-                    {
-                        return SetScheduledError::PromiseFaulted;
-                    }
-
-                    return SetScheduledError::AlreadyScheduled;
                 }
 
                 return CheckResume();
@@ -70,7 +64,9 @@ namespace TaskSystem
                     return SetScheduledError::CannotSchedule;
                 }
 
-                state = Completed<>{};
+                this->EmplaceResult<Completed<>>();
+                state.store(TaskState::Completed, std::memory_order_release);
+                state.notify_all();
 
                 for (auto* promise : continuationOf)
                 {
@@ -88,10 +84,21 @@ namespace TaskSystem
 
         using WhenAnyPromisePtr = std::shared_ptr<WhenAnyPromise>;
 
+        // Allocated once per WhenAny, each child adds its node so completing into the promise does not allocate
+        template <size_t Count>
+        struct WhenAnyState final
+        {
+            WhenAnyPromise promise;
+            std::array<ContinuationNode, Count> children;
+
+            WhenAnyState() : promise(Count) { }
+        };
+
         class WhenAnyAwaitable
         {
         private:
             WhenAnyPromisePtr promise;
+            ContinuationNode continuation;
 
         public:
             WhenAnyAwaitable(WhenAnyPromisePtr promise) noexcept : promise(std::move(promise))
@@ -124,13 +131,17 @@ namespace TaskSystem
                 // Capture the current scheduler to ensure the caller is resumed with a scheduler
                 promise->ContinuationScheduler(CurrentScheduler());
 
-                if (!promise->TryAddContinuation(callerPromise))
+                // Note: set before adding the continuation, once added the caller can be resumed and this destroyed
+                [[maybe_unused]] auto _ = promise->TrySetSuspended();
+
+                continuation = ContinuationNode(Continuation(callerPromise));
+                if (!promise->TryAddContinuation(continuation))
                 {
-                    assert(false);
+                    // Completed after the check above, nothing will schedule the caller so resume it inline
+                    [[maybe_unused]] auto _ = callerPromise.TrySetRunning();
+                    return callerHandle;
                 }
 
-                [[maybe_unused]] auto _ = promise->TrySetSuspended();
-
                 return std::noop_coroutine();
             }
 
@@ -139,7 +150,7 @@ namespace TaskSystem
 
         // Returns 1 if the schedulable is already complete; otherwise 0
         template <typename TSchedulable>  // Maybe: Should be a schedulable with concept
-        size_t WhenAnyForEach(WhenAnyPromisePtr & promise, TSchedulable & schedulable)
+        size_t WhenAnyForEach(WhenAnyPromisePtr & promise, ContinuationNode & node, TSchedulable & schedulable)
         {
             // Maybe: this is similar to WhenAllForEach... might combine
             if constexpr (IsValueTask<TSchedulable>)
@@ -148,7 +159,8 @@ namespace TaskSystem
             }
             else
             {
-                auto result = schedulable.ContinueWith(Continuation(*promise, CurrentScheduler()));
+                node = ContinuationNode(Continuation(*promise, CurrentScheduler()));
+                auto result = schedulable.ContinueWith(node);
                 //promise->AddContinuationOf(schedulable.Promise());
 
                 if (!result)
@@ -165,6 +177,8 @@ namespace TaskSystem
                     {
                         if (schedulable.State() == TaskState::Created)
                         {
+                            // Children without a scheduler of their own fan out across the default thread pool
+                            // rather than queue behind the caller on whichever scheduler it happens to run on
                             auto * scheduler
                                 = FirstOf(schedulable.TaskScheduler(), DefaultScheduler(), CurrentScheduler());
 
@@ -185,9 +199,12 @@ namespace TaskSystem
     template <typename... TSchedulables>
     Detail::WhenAnyAwaitable WhenAny(TSchedulables &&... schedulables)
     {
-        auto promise = std::make_shared<Detail::WhenAnyPromise>(sizeof...(TSchedulables));
+        auto state = std::make_shared<Detail::WhenAnyState<sizeof...(TSchedulables)>>();
+        auto promise = Detail::WhenAnyPromisePtr(state, &state->promise);
 
-        auto alreadyCompleted = (Detail::WhenAnyForEach(promise, schedulables) + ...);
+        auto * child = state->children.data();
+        auto alreadyCompleted = size_t(0);
+        ((alreadyCompleted += Detail::WhenAnyForEach(promise, *child++, schedulables)), ...);
         if (alreadyCompleted > 0u)
         {
             promise->CheckResume();